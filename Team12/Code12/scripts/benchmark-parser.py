@@ -0,0 +1,85 @@
+# Benchmarks the SIMPLE parser on pathological expressions, to check
+# that parse time grows linearly with the number of tokens.
+#
+# For each size, a program is generated with:
+#   - deeply nested brackets:   x = ((((...(a + 1)...) * 2) + 3) ...);
+#   - long operator chains:     x = a * b * c * ... ;
+#   - nested conditions:        while (!(!(...(a < b)...))) { ... }
+# and parsed by spa_bench (with no queries).
+#
+# usage: python3 benchmark-parser.py  (requires a built SPA in ./build,
+#                                      override with BUILD_DIR)
+
+from subprocess import run
+import json
+import os
+import tempfile
+
+num_times = 3
+sizes = [500, 1000, 2000, 4000]
+
+rootdir = (
+    run(["git", "rev-parse", "--show-toplevel"], capture_output=True)
+    .stdout.decode()
+    .strip()
+)
+builddir = os.environ.get("BUILD_DIR", os.path.join(rootdir, "Team12/Code12/build"))
+spaBench = os.path.join(builddir, "src/spa_bench/spa_bench")
+
+
+def nestedBrackets(depth):
+    expr = "a"
+    for i in range(depth):
+        expr = f"({expr} {'+*'[i % 2]} {i})"
+    return expr
+
+
+def operatorChain(length):
+    return " * ".join(f"v{i}" for i in range(length))
+
+
+def nestedCondition(depth):
+    return "!(" * depth + "a < b" + ")" * depth
+
+
+def generateProgram(size):
+    return f"""procedure pathological {{
+    x = {nestedBrackets(size)};
+    y = {operatorChain(size)};
+    while ({nestedCondition(size)}) {{
+        z = z - 1;
+    }}
+}}
+"""
+
+
+def benchmark(size, workdir):
+    sourcefile = os.path.join(workdir, f"nested_{size}_source.txt")
+    queryfile = os.path.join(workdir, f"nested_{size}_queries.txt")
+    with open(sourcefile, "w") as source:
+        source.write(generateProgram(size))
+    open(queryfile, "w").close()
+    result = run([spaBench, sourcefile, queryfile, str(num_times)], capture_output=True)
+    if result.returncode != 0:
+        print(f"spa_bench failed for size {size}: {result.stderr.decode().strip()}")
+        return None
+    return json.loads(result.stdout.decode())["phases"]["parse"]
+
+
+def __main__():
+    if not os.path.exists(spaBench):
+        print(f"spa_bench not found at {spaBench}, please build the SPA first.")
+        return
+    with tempfile.TemporaryDirectory() as workdir:
+        previous = None
+        for size in sizes:
+            samples = benchmark(size, workdir)
+            if samples is None:
+                continue
+            best = min(samples)
+            growth = f", x{best / previous:.2f} vs previous size" if previous else ""
+            print(f"size {size:6}: parse {best:9.2f}ms{growth}")
+            previous = best
+
+
+__main__()
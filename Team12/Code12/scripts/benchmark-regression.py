@@ -0,0 +1,195 @@
+# Benchmark regression gate.
+#
+# Records per-phase (parse, extract, preprocess) and per-query timings, plus peak RSS
+# and the number of heap allocations made by each query,
+# for every <name>_source.txt / <name>_queries.txt pair in Tests12 into a
+# JSON baseline, then compares later runs against that baseline.
+#
+# usage (requires a built SPA in ./build, override with BUILD_DIR):
+#   python3 benchmark-regression.py record  [baseline.json]
+#   python3 benchmark-regression.py compare [baseline.json]
+#
+# Timings come from spa_bench; when the autotester has been run as well,
+# the time_taken of each query in its XML output is recorded alongside,
+# and compared as a single sample with the same thresholds.
+# A query or phase is flagged as a regression only when its mean time grows
+# by more than all of: NOISE_SIGMAS combined standard deviations,
+# RELATIVE_THRESHOLD of the baseline mean, and ABSOLUTE_FLOOR_MS.
+# Allocation counts do not vary between runs, so any growth beyond
+# ALLOCATIONS_RELATIVE_THRESHOLD is flagged.
+
+from subprocess import run, DEVNULL
+import json
+import math
+import os
+import sys
+import xml.etree.ElementTree as ET
+from statistics import mean, stdev
+
+num_times = int(os.environ.get("BENCH_RUNS", "5"))
+NOISE_SIGMAS = 3.0
+RELATIVE_THRESHOLD = 0.10
+ABSOLUTE_FLOOR_MS = 1.0
+RSS_RELATIVE_THRESHOLD = 0.10
+ALLOCATIONS_RELATIVE_THRESHOLD = 0.10
+
+rootdir = (
+    run(["git", "rev-parse", "--show-toplevel"], capture_output=True)
+    .stdout.decode()
+    .strip()
+)
+builddir = os.environ.get("BUILD_DIR", os.path.join(rootdir, "Team12/Code12/build"))
+testdir = os.path.join(rootdir, "Team12/Tests12")
+
+spaBench = os.path.join(builddir, "src/spa_bench/spa_bench")
+autotester = os.path.join(builddir, "src/autotester/autotester")
+outdir = os.path.join(rootdir, "Team12/Code12/tests/output")
+defaultBaseline = os.path.join(rootdir, "Team12/Code12/tests/benchmark-baseline.json")
+
+sourcefiles = sorted(f for f in os.listdir(testdir) if "_source.txt" in f)
+sourceQueryPair = [
+    (sf, sf.replace("source", "queries").replace("Source", "Queries"))
+    for sf in sourcefiles
+]
+
+
+def summarise(samples):
+    return {
+        "mean": mean(samples),
+        "stdev": stdev(samples) if len(samples) > 1 else 0.0,
+        "n": len(samples),
+    }
+
+
+def extractAutotesterTimes(outfile):
+    if not os.path.exists(outfile):
+        return {}
+    times = {}
+    for query in ET.parse(outfile).iter("query"):
+        queryId = query.find("id")
+        timeTaken = query.find("time_taken")
+        if queryId is not None and timeTaken is not None:
+            times[queryId.text.strip()] = float(timeTaken.text)
+    return times
+
+
+def autotest(sourcefile, queryfile, testDesc):
+    if not os.path.exists(autotester):
+        return {}
+    os.makedirs(outdir, exist_ok=True)
+    outfile = os.path.join(outdir, f"{testDesc}.xml")
+    run([autotester, sourcefile, queryfile, outfile], stdout=DEVNULL, stderr=DEVNULL)
+    return extractAutotesterTimes(outfile)
+
+
+def benchmarkPair(sf, qf):
+    sourcefile, queryfile = os.path.join(testdir, sf), os.path.join(testdir, qf)
+    result = run([spaBench, sourcefile, queryfile, str(num_times)], capture_output=True)
+    if result.returncode != 0:
+        print(f"spa_bench failed for {sf}: {result.stderr.decode().strip()}")
+        return None
+    raw = json.loads(result.stdout.decode())
+    entry = {
+        "peak_rss_kb": raw["peak_rss_kb"],
+        "phases": {name: summarise(s) for name, s in raw["phases"].items()},
+        "queries": {q["id"]: summarise(q["samples"]) for q in raw["queries"]},
+        "allocations": {q["id"]: max(q["allocations"]) for q in raw["queries"]},
+    }
+    testDesc = sf.replace("_source", "_output").replace(".txt", "")
+    autotesterTimes = autotest(sourcefile, queryfile, testDesc)
+    if autotesterTimes:
+        entry["autotester_time_taken"] = autotesterTimes
+    return entry
+
+
+def benchmarkAll():
+    results = {}
+    for sf, qf in sourceQueryPair:
+        print(f"Benchmarking {sf} ...")
+        entry = benchmarkPair(sf, qf)
+        if entry is not None:
+            results[sf] = entry
+    return {"runs": num_times, "tests": results}
+
+
+def isRegression(old, new):
+    delta = new["mean"] - old["mean"]
+    noise = NOISE_SIGMAS * math.sqrt(
+        old["stdev"] ** 2 / max(old["n"], 1) + new["stdev"] ** 2 / max(new["n"], 1)
+    )
+    return delta > max(noise, RELATIVE_THRESHOLD * old["mean"], ABSOLUTE_FLOOR_MS)
+
+
+def compareStats(label, old, new, regressions):
+    if old is None or new is None:
+        return
+    if isRegression(old, new):
+        change = (new["mean"] - old["mean"]) / max(old["mean"], 1e-9) * 100
+        regressions.append(
+            f"{label:60} {old['mean']:9.2f}ms -> {new['mean']:9.2f}ms ({change:+.1f}%)"
+        )
+
+
+def compare(baseline, current):
+    regressions = []
+    for sf, old in baseline["tests"].items():
+        new = current["tests"].get(sf)
+        if new is None:
+            print(f"{sf}: missing from current run")
+            continue
+        for phase, stats in old["phases"].items():
+            compareStats(f"{sf} [{phase}]", stats, new["phases"].get(phase), regressions)
+        for queryId, stats in old["queries"].items():
+            compareStats(f"{sf} query {queryId}", stats, new["queries"].get(queryId), regressions)
+        newAutotesterTimes = new.get("autotester_time_taken", {})
+        for queryId, oldTime in old.get("autotester_time_taken", {}).items():
+            newTime = newAutotesterTimes.get(queryId)
+            if newTime is not None:
+                compareStats(
+                    f"{sf} query {queryId} [autotester]",
+                    summarise([oldTime]),
+                    summarise([newTime]),
+                    regressions,
+                )
+        oldRss, newRss = old["peak_rss_kb"], new["peak_rss_kb"]
+        if oldRss > 0 and newRss > oldRss * (1 + RSS_RELATIVE_THRESHOLD):
+            regressions.append(f"{sf + ' [peak rss]':60} {oldRss:9d}kB -> {newRss:9d}kB")
+        newAllocations = new.get("allocations", {})
+        for queryId, oldCount in old.get("allocations", {}).items():
+            newCount = newAllocations.get(queryId)
+            if newCount is not None and newCount > oldCount * (1 + ALLOCATIONS_RELATIVE_THRESHOLD):
+                regressions.append(
+                    f"{sf + ' query ' + queryId + ' [allocations]':60} {oldCount:9d}   -> {newCount:9d}"
+                )
+    return regressions
+
+
+def __main__():
+    mode = sys.argv[1] if len(sys.argv) > 1 else "compare"
+    baselinePath = sys.argv[2] if len(sys.argv) > 2 else defaultBaseline
+    if mode not in ("record", "compare"):
+        print("usage: benchmark-regression.py (record|compare) [baseline.json]")
+        sys.exit(2)
+    if not os.path.exists(spaBench):
+        print(f"spa_bench not found at {spaBench}, please build the SPA first.")
+        sys.exit(2)
+
+    current = benchmarkAll()
+    if mode == "record":
+        with open(baselinePath, "w") as baselineFile:
+            json.dump(current, baselineFile, indent=2, sort_keys=True)
+        print(f"Baseline written to {baselinePath}")
+        return
+
+    with open(baselinePath, "r") as baselineFile:
+        baseline = json.load(baselineFile)
+    regressions = compare(baseline, current)
+    if regressions:
+        print(f"{len(regressions)} regression(s) beyond noise:")
+        for line in regressions:
+            print(line)
+        sys.exit(1)
+    print("No regressions beyond noise.")
+
+
+__main__()
@@ -1,18 +1,15 @@
 #include "TestWrapper.h"
 
 #include <algorithm>
-#include <fstream>
 #include <iostream>
 #include <stdexcept>
-#include <streambuf>
 #include <string>
 
 #include "AbstractWrapper.h"
 #include "Ui.h"
 #include "frontend/FrontendManager.h"
 #include "pql/PqlManager.h"
-#include "pql/projector/FormattedQueryResult.h"
-#include "pql/projector/QueryResultFormatType.h"
+#include "pql/projector/ResultSink.h"
 
 // implementation code of WrapperFactory - do NOT modify the next 5 lines
 AbstractWrapper* WrapperFactory::wrapper = 0;
@@ -45,12 +42,9 @@ class AutotesterUi: public Ui {
 // method for parsing the SIMPLE source
 void TestWrapper::parse(std::string filename)
 {
-    std::ifstream fileStream(filename);
-    std::string program((std::istreambuf_iterator<char>(fileStream)), std::istreambuf_iterator<char>());
-    std::cout << program << std::endl;
-
     AutotesterUi ui;
-    parseSimple(program, ui);
+    // the source file is memory-mapped and parsed procedure by procedure
+    parseSimpleFile(filename, ui);
 }
 
 // method to evaluating a query
@@ -61,23 +55,6 @@ void TestWrapper::evaluate(std::string query, std::list<std::string>& results)
     AutotesterUi ui;
     // store the answers to the query in the results list (it is initially empty)
     // each result must be a string.
-    FormattedQueryResult result = PqlManager::executeQuery(query, AutotesterFormat, ui, true);
-
-    // retrieve String and perform split operation by delimiter "," to add into results
-    std::string::size_type pos_begin, pos_end = 0;
-    std::string input = result.getResults();
-    const char* ws = " \t\n\r\f\v";
-    while ((pos_begin = input.find_first_not_of(',', pos_end)) != std::string::npos) {
-        pos_end = input.find_first_of(',', pos_begin);
-        if (pos_end == std::string::npos)
-            pos_end = input.length();
-        // std::string::iterator end_pos = std::remove(input.begin(), input.end(), ' ');
-
-        // input.erase(end_pos, input.end());
-        // retrieve String and perform split operation by delimiter "," to add into results
-        std::string substring = input.substr(pos_begin, pos_end - pos_begin);
-        substring.erase(substring.find_last_not_of(ws) + 1);
-        substring.erase(0, substring.find_first_not_of(ws));
-        results.push_back(substring);
-    }
+    ListResultSink sink(results);
+    PqlManager::executeQuery(query, sink, ui, true);
 }
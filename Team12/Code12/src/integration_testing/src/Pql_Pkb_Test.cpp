@@ -3323,6 +3323,37 @@ TEST_CASE("Query selecting attributes should not return duplicates - Call # Proc
     REQUIRE(actual3 == expected3);
 }
 
+TEST_CASE("query with With clause, both operands attributes with many equal values")
+{
+    resetPKB();
+    String procName1 = "dusk";
+    String procName2 = "dawn";
+    insertIntoStatementTable(1, procName1);
+    insertIntoStatementTable(2, procName1);
+    insertIntoStatementTable(3, procName2);
+    insertIntoStatementTable(4, PrintStatement);
+    insertIntoProcedureTable(procName1, 4, 4);
+    insertIntoProcedureTable(procName2, 4, 4);
+
+    QueryResultFormatType format = AutotesterFormat;
+    UiStub ui;
+
+    String query1 = "call c1, c2; Select <c1, c2> with c1.procName = c2.procName";
+    FormattedQueryResult actual1 = PqlManager::executeQuery(query1, format, ui, true);
+    FormattedQueryResult expected1("1 1, 1 2, 2 1, 2 2, 3 3");
+    REQUIRE(actual1 == expected1);
+
+    String query2 = "call c; Select c with c.procName = \"dusk\"";
+    FormattedQueryResult actual2 = PqlManager::executeQuery(query2, format, ui, true);
+    FormattedQueryResult expected2("1, 2");
+    REQUIRE(actual2 == expected2);
+
+    String query3 = "stmt s; Select s with s.stmt# = 004";
+    FormattedQueryResult actual3 = PqlManager::executeQuery(query3, format, ui, true);
+    FormattedQueryResult expected3("4");
+    REQUIRE(actual3 == expected3);
+}
+
 TEST_CASE("(vacuously true) query with such that Next clause, left operand line number, right operand synonym")
 {
     // === Test set-up ===
@@ -3468,3 +3499,98 @@ TEST_CASE("(vacuously true) query with such that Affects* clause, left operand l
     REQUIRE(formattedQueryResult.getResults() == expectedResultsStr);
     REQUIRE(formattedQueryResult == expectedFormattedQueryResults);
 }
+
+TEST_CASE("prepared query with such that Next* clause, executed with each left operand line number")
+{
+    // === Test set-up ===
+    String query = "stmt s; Select s such that Next*(?, s)";
+
+    QueryResultFormatType format = AutotesterFormat;
+
+    // Call PKB API to add some dummy relationships
+    resetPKB();
+    insertIntoStatementTable(1, AssignmentStatement);
+    insertIntoStatementTable(2, AssignmentStatement);
+    insertIntoStatementTable(3, AssignmentStatement);
+    insertIntoStatementTable(4, AssignmentStatement);
+
+    addNextRelationships(1, AssignmentStatement, 2, AssignmentStatement);
+    addNextRelationships(2, AssignmentStatement, 3, AssignmentStatement);
+    addNextRelationships(3, AssignmentStatement, 4, AssignmentStatement);
+
+    UiStub ui;
+
+    // === Execute test method ===
+    PreparedQuery preparedQuery = PqlManager::prepareQuery(query, true);
+    FormattedQueryResult firstResult = PqlManager::executePreparedQuery(preparedQuery, {"1"}, format, ui);
+    FormattedQueryResult thirdResult = PqlManager::executePreparedQuery(preparedQuery, {"3"}, format, ui);
+    FormattedQueryResult lastResult = PqlManager::executePreparedQuery(preparedQuery, {"4"}, format, ui);
+
+    // === Check expected test results ===
+    REQUIRE(preparedQuery.getParameterCount() == 1);
+    REQUIRE(firstResult == PqlManager::executeQuery("stmt s; Select s such that Next*(1, s)", format, ui, true));
+    REQUIRE(thirdResult == PqlManager::executeQuery("stmt s; Select s such that Next*(3, s)", format, ui, true));
+    REQUIRE(lastResult == PqlManager::executeQuery("stmt s; Select s such that Next*(4, s)", format, ui, true));
+    REQUIRE(thirdResult.getResults() == "4");
+    REQUIRE(lastResult.getResults().empty());
+}
+
+TEST_CASE("prepared query with placeholders substituted by the optimiser, and a literal placeholder")
+{
+    // === Test set-up ===
+    String query = R"(stmt s; variable v; Select v such that Modifies(s, v) and Modifies(s, "?") with s.stmt# = ?)";
+
+    QueryResultFormatType format = AutotesterFormat;
+
+    // Call PKB API to add some dummy relationships
+    resetPKB();
+    insertIntoStatementTable(1, AssignmentStatement);
+    insertIntoStatementTable(2, ReadStatement);
+
+    addModifiesRelationships(1, AssignmentStatement, {"x"});
+    addModifiesRelationships(2, ReadStatement, {"y"});
+
+    UiStub ui;
+
+    // === Execute test method ===
+    PreparedQuery preparedQuery = PqlManager::prepareQuery(query, true);
+    FormattedQueryResult firstResult = PqlManager::executePreparedQuery(preparedQuery, {"x", "1"}, format, ui);
+    FormattedQueryResult secondResult = PqlManager::executePreparedQuery(preparedQuery, {"y", "2"}, format, ui);
+    FormattedQueryResult mismatchedResult = PqlManager::executePreparedQuery(preparedQuery, {"x", "2"}, format, ui);
+
+    // === Check expected test results ===
+    REQUIRE(preparedQuery.getParameterCount() == 2);
+    REQUIRE(firstResult.getResults() == "x");
+    REQUIRE(secondResult.getResults() == "y");
+    REQUIRE(mismatchedResult.getResults().empty());
+}
+
+TEST_CASE("prepared query executed with invalid parameters returns empty")
+{
+    // === Test set-up ===
+    String query = "stmt s; Select s such that Next*(?, s)";
+
+    QueryResultFormatType format = AutotesterFormat;
+
+    // Call PKB API to add some dummy relationships
+    resetPKB();
+    insertIntoStatementTable(1, AssignmentStatement);
+    insertIntoStatementTable(2, AssignmentStatement);
+
+    addNextRelationships(1, AssignmentStatement, 2, AssignmentStatement);
+
+    UiStub ui;
+
+    // === Execute test method ===
+    PreparedQuery preparedQuery = PqlManager::prepareQuery(query, true);
+    FormattedQueryResult missingResult = PqlManager::executePreparedQuery(preparedQuery, {}, format, ui);
+    FormattedQueryResult extraResult = PqlManager::executePreparedQuery(preparedQuery, {"1", "2"}, format, ui);
+    FormattedQueryResult nameResult = PqlManager::executePreparedQuery(preparedQuery, {"x"}, format, ui);
+    FormattedQueryResult validResult = PqlManager::executePreparedQuery(preparedQuery, {"1"}, format, ui);
+
+    // === Check expected test results ===
+    REQUIRE(missingResult.getResults().empty());
+    REQUIRE(extraResult.getResults().empty());
+    REQUIRE(nameResult.getResults().empty());
+    REQUIRE(validResult.getResults() == "2");
+}
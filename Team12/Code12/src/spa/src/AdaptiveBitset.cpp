@@ -0,0 +1,121 @@
+/**
+ * Implementation of a set of small non-negative
+ * integers that can be stored compressed.
+ */
+
+#include "AdaptiveBitset.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <utility>
+
+// Number of bits a Bitset takes for each integer listed in a compressed set
+const size_t BitsPerListedIndex = 64;
+
+AdaptiveBitset::AdaptiveBitset(): numberOfBits(0), compressed(false) {}
+
+AdaptiveBitset::AdaptiveBitset(size_t size, Boolean compressed):
+    bits(compressed ? 0 : size), numberOfBits(size), compressed(compressed)
+{}
+
+size_t AdaptiveBitset::size() const
+{
+    return numberOfBits;
+}
+
+size_t AdaptiveBitset::count() const
+{
+    return compressed ? indexes.size() : bits.count();
+}
+
+Boolean AdaptiveBitset::any() const
+{
+    return compressed ? !indexes.empty() : bits.any();
+}
+
+Boolean AdaptiveBitset::isCompressed() const
+{
+    return compressed;
+}
+
+Boolean AdaptiveBitset::test(size_t index) const
+{
+    assert(index < numberOfBits); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    if (!compressed) {
+        return bits.test(index);
+    }
+    return std::binary_search(indexes.begin(), indexes.end(), index);
+}
+
+Void AdaptiveBitset::set(size_t index)
+{
+    assert(index < numberOfBits); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    if (!compressed) {
+        bits.set(index);
+        return;
+    }
+    auto position = std::lower_bound(indexes.begin(), indexes.end(), index);
+    if (position == indexes.end() || *position != index) {
+        indexes.insert(position, index);
+        decompressIfLarge();
+    }
+}
+
+AdaptiveBitset& AdaptiveBitset::operator|=(const AdaptiveBitset& other)
+{
+    assert(numberOfBits == other.numberOfBits); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    if (compressed && other.compressed) {
+        Vector<size_t> unionOfIndexes;
+        unionOfIndexes.reserve(indexes.size() + other.indexes.size());
+        std::set_union(indexes.begin(), indexes.end(), other.indexes.begin(), other.indexes.end(),
+                       std::back_inserter(unionOfIndexes));
+        indexes = std::move(unionOfIndexes);
+        decompressIfLarge();
+    } else if (compressed) {
+        // take the bits of the other set, and add the integers listed in this one
+        bits = other.bits;
+        for (size_t index : indexes) {
+            bits.set(index);
+        }
+        indexes = Vector<size_t>();
+        compressed = false;
+    } else if (other.compressed) {
+        for (size_t index : other.indexes) {
+            bits.set(index);
+        }
+    } else {
+        bits |= other.bits;
+    }
+    return *this;
+}
+
+Vector<Integer> AdaptiveBitset::toVector() const
+{
+    if (!compressed) {
+        return bits.toVector();
+    }
+    Vector<Integer> integers;
+    integers.reserve(indexes.size());
+    for (size_t index : indexes) {
+        integers.push_back(static_cast<Integer>(index));
+    }
+    return integers;
+}
+
+/**
+ * Turns a compressed set into a Bitset once listing
+ * its integers takes more memory than the Bitset.
+ */
+Void AdaptiveBitset::decompressIfLarge()
+{
+    if (indexes.size() * BitsPerListedIndex < numberOfBits) {
+        return;
+    }
+    bits = Bitset(numberOfBits);
+    for (size_t index : indexes) {
+        bits.set(index);
+    }
+    indexes = Vector<size_t>();
+    compressed = false;
+}
@@ -0,0 +1,64 @@
+/**
+ * A set of small non-negative integers, such as the indexes
+ * of variables, that can be stored compressed while it
+ * is small compared to the integers it can hold.
+ */
+
+#ifndef SPA_ADAPTIVE_BITSET_H
+#define SPA_ADAPTIVE_BITSET_H
+
+#include "Bitset.h"
+
+/**
+ * An uncompressed AdaptiveBitset is a Bitset. A compressed
+ * AdaptiveBitset lists its integers in ascending order instead,
+ * and only turns into a Bitset once the list would take more
+ * memory than the Bitset, so that a program with thousands of
+ * variables does not need thousands of bits for every statement.
+ */
+class AdaptiveBitset {
+public:
+    /**
+     * Constructs an empty AdaptiveBitset that holds no integers.
+     */
+    AdaptiveBitset();
+
+    /**
+     * Constructs an AdaptiveBitset that can hold the integers
+     * from 0 to size - 1, with none of them in the set.
+     *
+     * @param size Number of integers the set can hold.
+     * @param compressed Whether to list the integers while there are few of them.
+     */
+    AdaptiveBitset(size_t size, Boolean compressed);
+
+    // Gets the number of integers the AdaptiveBitset can hold.
+    size_t size() const;
+    // Counts the integers in the set.
+    size_t count() const;
+    // Checks whether there are any integers in the set.
+    Boolean any() const;
+    // Checks whether the integers are currently listed instead of stored as bits.
+    Boolean isCompressed() const;
+
+    // Checks whether an integer is in the set.
+    Boolean test(size_t index) const;
+    // Adds an integer to the set.
+    Void set(size_t index);
+    // Adds every integer in another AdaptiveBitset of the same size to this set.
+    AdaptiveBitset& operator|=(const AdaptiveBitset& other);
+
+    // Lists the integers in the set, in ascending order.
+    Vector<Integer> toVector() const;
+
+private:
+    Bitset bits;
+    // integers in the set in ascending order, while compressed
+    Vector<size_t> indexes;
+    size_t numberOfBits;
+    Boolean compressed;
+
+    Void decompressIfLarge();
+};
+
+#endif // SPA_ADAPTIVE_BITSET_H
@@ -0,0 +1,151 @@
+/**
+ * Implementation of a set of small non-negative integers.
+ */
+
+#include "Bitset.h"
+
+#include <cassert>
+
+// Number of bits stored in each word of a Bitset
+const size_t BitsPerWord = 64;
+
+/**
+ * Counts the bits set in a word.
+ */
+size_t countBitsInWord(uint64_t word)
+{
+    size_t bits = 0;
+    while (word != 0) {
+        word &= word - 1;
+        bits++;
+    }
+    return bits;
+}
+
+/**
+ * Finds the position of the lowest bit set in a non-zero word.
+ */
+size_t findLowestBitInWord(uint64_t word)
+{
+    size_t position = 0;
+    while ((word & 1u) == 0) {
+        word >>= 1u;
+        position++;
+    }
+    return position;
+}
+
+Bitset::Bitset(): numberOfBits(0) {}
+
+Bitset::Bitset(size_t size): words((size + BitsPerWord - 1) / BitsPerWord, 0), numberOfBits(size) {}
+
+size_t Bitset::size() const
+{
+    return numberOfBits;
+}
+
+size_t Bitset::count() const
+{
+    size_t bits = 0;
+    for (uint64_t word : words) {
+        bits += countBitsInWord(word);
+    }
+    return bits;
+}
+
+Boolean Bitset::any() const
+{
+    for (uint64_t word : words) {
+        if (word != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+Boolean Bitset::test(size_t index) const
+{
+    assert(index < numberOfBits); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    return ((words[index / BitsPerWord] >> (index % BitsPerWord)) & 1u) != 0;
+}
+
+Void Bitset::set(size_t index)
+{
+    assert(index < numberOfBits); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    words[index / BitsPerWord] |= uint64_t(1) << (index % BitsPerWord);
+}
+
+Void Bitset::reset(size_t index)
+{
+    assert(index < numberOfBits); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    words[index / BitsPerWord] &= ~(uint64_t(1) << (index % BitsPerWord));
+}
+
+Bitset& Bitset::operator|=(const Bitset& other)
+{
+    assert(numberOfBits == other.numberOfBits); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    for (size_t i = 0; i < words.size(); i++) {
+        words[i] |= other.words[i];
+    }
+    return *this;
+}
+
+Bitset& Bitset::operator&=(const Bitset& other)
+{
+    assert(numberOfBits == other.numberOfBits); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    for (size_t i = 0; i < words.size(); i++) {
+        words[i] &= other.words[i];
+    }
+    return *this;
+}
+
+Void Bitset::subtract(const Bitset& other)
+{
+    assert(numberOfBits == other.numberOfBits); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    for (size_t i = 0; i < words.size(); i++) {
+        words[i] &= ~other.words[i];
+    }
+}
+
+Boolean Bitset::intersects(const Bitset& other) const
+{
+    assert(numberOfBits == other.numberOfBits); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    for (size_t i = 0; i < words.size(); i++) {
+        if ((words[i] & other.words[i]) != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Bitset::operator==(const Bitset& other) const
+{
+    return numberOfBits == other.numberOfBits && words == other.words;
+}
+
+size_t Bitset::findNext(size_t index) const
+{
+    if (index >= numberOfBits) {
+        return numberOfBits;
+    }
+    size_t wordIndex = index / BitsPerWord;
+    // ignore the bits before the index in the first word
+    uint64_t word = words[wordIndex] & (~uint64_t(0) << (index % BitsPerWord));
+    while (word == 0) {
+        wordIndex++;
+        if (wordIndex == words.size()) {
+            return numberOfBits;
+        }
+        word = words[wordIndex];
+    }
+    return wordIndex * BitsPerWord + findLowestBitInWord(word);
+}
+
+Vector<Integer> Bitset::toVector() const
+{
+    Vector<Integer> integers;
+    for (size_t index = findNext(0); index < numberOfBits; index = findNext(index + 1)) {
+        integers.push_back(static_cast<Integer>(index));
+    }
+    return integers;
+}
@@ -0,0 +1,72 @@
+/**
+ * A fixed-size set of small non-negative integers,
+ * such as statement numbers, stored one bit each.
+ */
+
+#ifndef SPA_BITSET_H
+#define SPA_BITSET_H
+
+#include <cstdint>
+
+#include "Types.h"
+
+/**
+ * Unlike std::bitset, the size of a Bitset is chosen at run
+ * time. Unions and differences of two Bitsets of the same size
+ * work a word of 64 bits at a time, which makes them cheap
+ * enough to compose summaries of whole procedures with.
+ */
+class Bitset {
+public:
+    /**
+     * Constructs an empty Bitset that holds no integers.
+     */
+    Bitset();
+
+    /**
+     * Constructs a Bitset that can hold the integers from
+     * 0 to size - 1, with none of them in the set.
+     */
+    explicit Bitset(size_t size);
+
+    // Gets the number of integers the Bitset can hold.
+    size_t size() const;
+    // Counts the integers in the set.
+    size_t count() const;
+    // Checks whether there are any integers in the set.
+    Boolean any() const;
+
+    // Checks whether an integer is in the set.
+    Boolean test(size_t index) const;
+    // Adds an integer to the set.
+    Void set(size_t index);
+    // Removes an integer from the set.
+    Void reset(size_t index);
+
+    // Adds every integer in another Bitset of the same size to this set.
+    Bitset& operator|=(const Bitset& other);
+    // Removes every integer that is not in another Bitset of the same size.
+    Bitset& operator&=(const Bitset& other);
+    // Removes every integer in another Bitset of the same size from this set.
+    Void subtract(const Bitset& other);
+    // Checks whether this set and another Bitset of the same size share any integer.
+    Boolean intersects(const Bitset& other) const;
+
+    bool operator==(const Bitset& other) const;
+
+    /**
+     * Finds the smallest integer in the set that is
+     * at least the integer given. Returns size() if
+     * there is no such integer.
+     */
+    size_t findNext(size_t index) const;
+
+    // Lists the integers in the set, in ascending order.
+    Vector<Integer> toVector() const;
+
+private:
+    Vector<uint64_t> words;
+    size_t numberOfBits;
+};
+
+#endif // SPA_BITSET_H
@@ -4,21 +4,41 @@
 
 #include "Util.h"
 
-#include <regex>
+#include <algorithm>
 
-Boolean isMatchingRegex(const String& rawInput, const String& regex)
+/**
+ * Checks if a character is an ASCII letter, without
+ * depending on the locale as std::isalpha does.
+ */
+Boolean util::isAsciiLetter(char c)
+{
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+}
+
+// Checks if a character is an ASCII digit.
+Boolean util::isAsciiDigit(char c)
 {
-    return std::regex_match(rawInput, std::regex(regex));
+    return c >= '0' && c <= '9';
 }
 
+/**
+ * Checks if a String matches [A-Za-z]([A-Za-z]|[0-9])*.
+ * This is called for every name in a query, so the
+ * characters are checked directly instead of building
+ * a std::regex each time.
+ */
 Boolean util::isPossibleIdentifier(const String& str)
 {
-    return isMatchingRegex(str, "[A-Za-z]([A-Za-z]|[\\d])*");
+    if (str.empty() || !isAsciiLetter(str[0])) {
+        return false;
+    }
+    return std::all_of(str.begin() + 1, str.end(), [](char c) { return isAsciiLetter(c) || isAsciiDigit(c); });
 }
 
+// Checks if a String matches [0-9]+.
 Boolean util::isPossibleConstant(const String& str)
 {
-    return isMatchingRegex(str, "\\d+");
+    return !str.empty() && std::all_of(str.begin(), str.end(), isAsciiDigit);
 }
 
 Boolean util::isLiteral(const String& str)
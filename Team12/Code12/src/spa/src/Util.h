@@ -50,6 +50,8 @@ Boolean checkVectorOfPointersEqual(const std::vector<T>& first, const std::vecto
     return allMatch;
 }
 
+Boolean isAsciiLetter(char c);
+Boolean isAsciiDigit(char c);
 Boolean isPossibleIdentifier(const String& str);
 Boolean isPossibleConstant(const String& str);
 // Boolean isRelationshipReference(const String& str);
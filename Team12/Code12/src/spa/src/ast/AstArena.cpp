@@ -0,0 +1,141 @@
+/**
+ * Implementation of the arena allocator for
+ * Abstract Syntax Tree and Control Flow Graph nodes.
+ */
+
+#include "AstArena.h"
+
+#include <algorithm>
+
+const size_t AstArena::InitialBlockSize = 16 * 1024;
+const size_t AstArena::MaximumBlockSize = 1024 * 1024;
+const size_t ArenaAllocated::Alignment;
+
+// arena that new nodes are allocated in, on this thread
+static thread_local AstArena* activeArena = nullptr;
+
+/**
+ * Rounds a size up to a multiple of ArenaAllocated::Alignment,
+ * so that consecutive allocations stay aligned.
+ */
+inline size_t roundUpToAlignment(size_t size)
+{
+    return (size + ArenaAllocated::Alignment - 1) / ArenaAllocated::Alignment * ArenaAllocated::Alignment;
+}
+
+AstArena::AstArena():
+    nextFreeByte(nullptr), bytesLeftInBlock(0), nextBlockSize(InitialBlockSize), bytesAllocated(0),
+    parentArena(nullptr)
+{}
+
+AstArena::~AstArena()
+{
+    for (auto cleanup = cleanups.rbegin(); cleanup != cleanups.rend(); ++cleanup) {
+        cleanup->second(cleanup->first);
+    }
+    // the blocks are freed with the vector, all at once
+}
+
+Void AstArena::addBlock(size_t minimumSize)
+{
+    // blocks grow geometrically, so big programs only need a few of them
+    size_t blockSize = std::max(nextBlockSize, minimumSize);
+    nextBlockSize = std::min(nextBlockSize * 2, MaximumBlockSize);
+    blocks.emplace_back(new char[blockSize]);
+    nextFreeByte = blocks.back().get();
+    bytesLeftInBlock = blockSize;
+}
+
+void* AstArena::allocate(size_t size)
+{
+    size_t alignedSize = roundUpToAlignment(size);
+    if (alignedSize > bytesLeftInBlock) {
+        addBlock(alignedSize);
+    }
+    void* memory = nextFreeByte;
+    nextFreeByte += alignedSize;
+    bytesLeftInBlock -= alignedSize;
+    bytesAllocated += alignedSize;
+    return memory;
+}
+
+const String& AstArena::intern(const String& name)
+{
+    return *internedNames.insert(name).first;
+}
+
+AstArena* AstArena::createChildArena()
+{
+    childArenas.emplace_back(new AstArena());
+    childArenas.back()->parentArena = this;
+    return childArenas.back().get();
+}
+
+AstArena* AstArena::getParentArena() const
+{
+    return parentArena;
+}
+
+size_t AstArena::countBlocks() const
+{
+    return blocks.size();
+}
+
+size_t AstArena::getBytesAllocated() const
+{
+    return bytesAllocated;
+}
+
+size_t AstArena::countInternedNames() const
+{
+    return internedNames.size();
+}
+
+AstArena* AstArena::getActiveArena()
+{
+    return activeArena;
+}
+
+AstArena::Scope::Scope(AstArena* arena): previousArena(activeArena)
+{
+    activeArena = arena;
+}
+
+AstArena::Scope::~Scope()
+{
+    activeArena = previousArena;
+}
+
+const String& internName(const String& name, std::unique_ptr<const String>& ownedName)
+{
+    if (activeArena != nullptr) {
+        return activeArena->intern(name);
+    }
+    ownedName = std::unique_ptr<const String>(new String(name));
+    return *ownedName;
+}
+
+void* ArenaAllocated::operator new(size_t size)
+{
+    size_t sizeWithHeader = Alignment + size;
+    void* memory = activeArena != nullptr ? activeArena->allocate(sizeWithHeader) : ::operator new(sizeWithHeader);
+    // record the owner of the node in front of it
+    *static_cast<AstArena**>(memory) = activeArena;
+    return static_cast<char*>(memory) + Alignment;
+}
+
+void ArenaAllocated::operator delete(void* object) noexcept
+{
+    if (object == nullptr) {
+        return;
+    }
+    void* memory = static_cast<char*>(object) - Alignment;
+    if (*static_cast<AstArena**>(memory) == nullptr) {
+        ::operator delete(memory);
+    }
+}
+
+AstArena* ArenaAllocated::getOwningArena(const void* node)
+{
+    return *reinterpret_cast<AstArena* const*>(static_cast<const char*>(node) - Alignment); // NOLINT
+}
@@ -0,0 +1,154 @@
+/**
+ * Arena allocator for the nodes of Abstract Syntax Trees
+ * and Control Flow Graphs, so that the trees of a whole
+ * program live in a few contiguous blocks of memory and
+ * are freed together with the program.
+ */
+
+#ifndef SPA_AST_ARENA_H
+#define SPA_AST_ARENA_H
+
+#include <Types.h>
+#include <cstddef>
+
+class AstArena {
+public:
+    AstArena();
+    ~AstArena();
+    AstArena(const AstArena&) = delete;
+    AstArena& operator=(const AstArena&) = delete;
+    AstArena(AstArena&&) = delete;
+    AstArena& operator=(AstArena&&) = delete;
+
+    /**
+     * Allocates uninitialised memory from the arena, aligned
+     * to ArenaAllocated::Alignment. The memory is only freed
+     * when the arena is destroyed.
+     *
+     * @param size Number of bytes to allocate.
+     * @return Pointer to the allocated memory.
+     */
+    void* allocate(size_t size);
+
+    /**
+     * Interns a name, so that nodes of this arena referring to
+     * the same name share a single String.
+     *
+     * @param name The name to intern.
+     * @return Reference to the interned name, which is valid
+     *         until the arena is destroyed.
+     */
+    const String& intern(const String& name);
+
+    /**
+     * Runs the destructor of an object allocated in this arena
+     * when the arena is destroyed, for objects that own memory
+     * outside of the arena. Objects are destroyed in the reverse
+     * order of registration.
+     *
+     * @param object Object allocated in this arena.
+     */
+    template <typename T>
+    Void destroyOnRelease(T* object)
+    {
+        cleanups.emplace_back(object, [](void* objectToDestroy) { static_cast<T*>(objectToDestroy)->~T(); });
+    }
+
+    /**
+     * Creates an arena owned by this arena, for nodes created on
+     * another thread, as an arena can only be used by one thread
+     * at a time. The child arena is destroyed with this arena.
+     *
+     * @return Pointer to the child arena.
+     */
+    AstArena* createChildArena();
+    // Gets the arena that created this arena, or nullptr
+    // if it is not a child arena.
+    AstArena* getParentArena() const;
+
+    // Gets the number of blocks of memory held by the arena.
+    size_t countBlocks() const;
+    // Gets the number of bytes allocated from the arena.
+    size_t getBytesAllocated() const;
+    // Gets the number of distinct names interned in the arena.
+    size_t countInternedNames() const;
+
+    // Gets the arena that nodes are allocated in on the
+    // current thread, or nullptr if they are allocated
+    // individually on the heap.
+    static AstArena* getActiveArena();
+
+    /**
+     * Allocates new nodes created on the current thread in an
+     * arena, for as long as the Scope is alive. Scopes may be
+     * nested, with the innermost Scope taking effect.
+     */
+    class Scope {
+    public:
+        explicit Scope(AstArena* arena);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        Scope(Scope&&) = delete;
+        Scope& operator=(Scope&&) = delete;
+
+    private:
+        AstArena* previousArena;
+    };
+
+private:
+    static const size_t InitialBlockSize;
+    static const size_t MaximumBlockSize;
+
+    Vector<std::unique_ptr<char[]>> blocks;
+    char* nextFreeByte;
+    size_t bytesLeftInBlock;
+    size_t nextBlockSize;
+    size_t bytesAllocated;
+    std::unordered_set<String> internedNames;
+    Vector<std::pair<void*, void (*)(void*)>> cleanups;
+    Vector<std::unique_ptr<AstArena>> childArenas;
+    AstArena* parentArena;
+
+    Void addBlock(size_t minimumSize);
+};
+
+/**
+ * Interns a name in the active arena. If there is no active
+ * arena, the name is copied into ownedName instead, so that
+ * it is freed along with the node that holds it.
+ *
+ * @param name The name to intern.
+ * @param ownedName The copy of the name owned by the node,
+ *                  which is set only if there is no active arena.
+ * @return Reference to the interned or owned name.
+ */
+const String& internName(const String& name, std::unique_ptr<const String>& ownedName);
+
+/**
+ * Base class for nodes that are allocated in the active arena,
+ * or individually on the heap if there is no active arena.
+ * Deleting a node allocated in an arena only runs its
+ * destructor, as the memory is freed with the arena.
+ *
+ * Each allocation is prefixed with a pointer to the arena that
+ * owns it, so nodes must not need more than Alignment bytes
+ * of alignment.
+ */
+class ArenaAllocated {
+public:
+    static const size_t Alignment = alignof(void*);
+
+    static void* operator new(size_t size);
+    static void operator delete(void* object) noexcept;
+
+    // Gets the arena that a node (given as a pointer to the
+    // complete object) was allocated in, or nullptr if it
+    // was allocated on the heap.
+    static AstArena* getOwningArena(const void* node);
+
+protected:
+    ArenaAllocated() = default;
+};
+
+#endif // SPA_AST_ARENA_H
@@ -7,6 +7,12 @@
 
 #include "Util.h"
 
+// nodes are allocated after a pointer to their arena, see ArenaAllocated
+static_assert(alignof(AssignmentStatementNode) <= ArenaAllocated::Alignment
+                  && alignof(IfStatementNode) <= ArenaAllocated::Alignment
+                  && alignof(ArithmeticExpression) <= ArenaAllocated::Alignment,
+              "AST nodes must fit the alignment of arena allocations");
+
 StatementNumber StatementNode::getStatementNumber() const
 {
     return stmtNum;
@@ -26,8 +32,8 @@ bool StmtlstNode::operator==(const StmtlstNode& sln) const
     return util::checkListValuesEqual<StatementNode>(this->statementList, sln.statementList);
 }
 
-ProcedureNode::ProcedureNode(Name n, const StmtlstNode* stmtLst):
-    procedureName(std::move(n)), statementListNode(stmtLst)
+ProcedureNode::ProcedureNode(const Name& n, const StmtlstNode* stmtLst):
+    ownedName(), procedureName(internName(n, ownedName)), statementListNode(stmtLst)
 {}
 
 ProcedureNode::~ProcedureNode()
@@ -44,6 +50,16 @@ ProgramNode::ProgramNode(Name n, List<ProcedureNode> procLst, StatementNumber to
     programName(std::move(n)), procedureList(std::move(procLst)), totalNumberOfStatements(totalStmts)
 {}
 
+Void ProgramNode::adoptArena(std::unique_ptr<AstArena> nodeArena)
+{
+    arena = std::move(nodeArena);
+}
+
+AstArena* ProgramNode::getArena() const
+{
+    return arena.get();
+}
+
 bool ProgramNode::operator==(const ProgramNode& pgn) const
 {
     return this->totalNumberOfStatements == pgn.totalNumberOfStatements && this->programName == pgn.programName
@@ -82,7 +98,17 @@ bool Constant::compare(const BasicDataType& c) const
     }
 }
 
-Variable::Variable(Name n): varName(std::move(n)) {}
+Variable::Variable(const Name& n): ownedName(), varName(internName(n, ownedName)) {}
+
+Variable::Variable(const Variable& v):
+    BasicDataType(v), ownedName(v.ownedName ? new Name(*v.ownedName) : nullptr),
+    varName(ownedName ? *ownedName : v.varName)
+{}
+
+// the owned name stays at the same address when moved
+Variable::Variable(Variable&& v) noexcept:
+    BasicDataType(std::move(v)), ownedName(std::move(v.ownedName)), varName(v.varName)
+{}
 
 String Variable::toString()
 {
@@ -156,8 +182,8 @@ bool PrintStatementNode::compare(const StatementNode& sn) const
     }
 }
 
-CallStatementNode::CallStatementNode(StatementNumber stmtNum, Name n):
-    StatementNode(stmtNum), procedureName(std::move(n))
+CallStatementNode::CallStatementNode(StatementNumber stmtNum, const Name& n):
+    StatementNode(stmtNum), ownedName(), procedureName(internName(n, ownedName))
 {}
 
 bool CallStatementNode::operator==(const StatementNode& sn) const
@@ -9,10 +9,12 @@
 #include <Types.h>
 #include <utility>
 
+#include "AstArena.h"
+
 typedef String Name;
 typedef Integer StatementNumber;
 
-class StatementNode {
+class StatementNode: public ArenaAllocated {
 public:
     virtual ~StatementNode() = default;
     StatementNode(const StatementNode&) = delete;
@@ -32,19 +34,23 @@ private:
     StatementNumber stmtNum;
 };
 
-class StmtlstNode {
+class StmtlstNode: public ArenaAllocated {
 public:
     List<StatementNode> statementList;
     explicit StmtlstNode(List<StatementNode> stmtLst);
     bool operator==(const StmtlstNode& sln) const;
 };
 
-class ProcedureNode {
+class ProcedureNode: public ArenaAllocated {
+private:
+    // declared first, so that the name is owned before it is referred to
+    std::unique_ptr<const Name> ownedName;
+
 public:
-    const Name procedureName;
+    const Name& procedureName;
     const StmtlstNode* const statementListNode;
 
-    ProcedureNode(Name n, const StmtlstNode* stmtLst);
+    ProcedureNode(const Name& n, const StmtlstNode* stmtLst);
     ~ProcedureNode();
     ProcedureNode(const ProcedureNode&) = delete;
     ProcedureNode& operator=(const ProcedureNode&) = delete;
@@ -54,15 +60,26 @@ public:
 };
 
 class ProgramNode {
+private:
+    // declared first, so that the nodes are destroyed before their arena
+    std::unique_ptr<AstArena> arena;
+
 public:
     const Name programName;
     List<ProcedureNode> procedureList;
     ProgramNode(Name n, List<ProcedureNode> procLst, StatementNumber totalStmts);
     bool operator==(const ProgramNode& pgn) const;
     StatementNumber totalNumberOfStatements;
+
+    // Takes ownership of the arena that the nodes of this program were
+    // allocated in, which is freed together with the program.
+    Void adoptArena(std::unique_ptr<AstArena> nodeArena);
+    // Gets the arena of this program, or nullptr if its
+    // nodes were allocated individually on the heap.
+    AstArena* getArena() const;
 };
 
-class BasicDataType {
+class BasicDataType: public ArenaAllocated {
 public:
     virtual ~BasicDataType() = default;
     virtual String toString() = 0;
@@ -98,14 +115,18 @@ protected:
 };
 
 class Variable: public BasicDataType {
+private:
+    // declared first, so that the name is owned before it is referred to
+    std::unique_ptr<const Name> ownedName;
+
 public:
-    const Name varName;
+    const Name& varName;
 
-    explicit Variable(Name n);
+    explicit Variable(const Name& n);
     ~Variable() override = default;
-    Variable(const Variable&) = default;
+    Variable(const Variable& v);
     Variable& operator=(const Variable&) = delete;
-    Variable(Variable&&) = default;
+    Variable(Variable&& v) noexcept;
     Variable& operator=(Variable&&) = delete;
 
     String toString() override;
@@ -139,9 +160,13 @@ protected:
 };
 
 class CallStatementNode: public StatementNode {
+private:
+    // declared first, so that the name is owned before it is referred to
+    std::unique_ptr<const Name> ownedName;
+
 public:
-    const Name procedureName;
-    CallStatementNode(StatementNumber stmtNum, Name n);
+    const Name& procedureName;
+    CallStatementNode(StatementNumber stmtNum, const Name& n);
     bool operator==(const StatementNode& sn) const override;
     StatementType getStatementType() const override;
 
@@ -156,7 +181,7 @@ enum ConditionalExpressionType : char {
     OrConditionalExpression = 4
 };
 
-class ConditionalExpression {
+class ConditionalExpression: public ArenaAllocated {
 public:
     virtual ~ConditionalExpression() = default;
     virtual ConditionalExpressionType getConditionalType() const noexcept = 0;
@@ -236,7 +261,7 @@ enum ExpressionOperator : char {
     ModuloOperator = '%'
 };
 
-class Expression {
+class Expression: public ArenaAllocated {
 public:
     virtual ~Expression() = default;
     virtual Boolean isArithmetic() const noexcept = 0;
@@ -0,0 +1,329 @@
+/**
+ * Implementation of the Control Flow Graph with
+ * branching into procedures, as a supergraph.
+ */
+
+#include "BipSupergraph.h"
+
+#include <algorithm>
+#include <cassert>
+#include <unordered_map>
+
+// Index of a procedure that does not exist
+const size_t NoProcedure = static_cast<size_t>(-1);
+
+BipSupergraph::BipSupergraph(const Vector<Pair<Name, const FlatCfg*>>& procedureCfgs)
+{
+    // order the procedures by their statements
+    Vector<Pair<Name, const FlatCfg*>> procedures;
+    for (const Pair<Name, const FlatCfg*>& procedure : procedureCfgs) {
+        if (procedure.second->countStatements() > 0) {
+            procedures.push_back(procedure);
+        }
+    }
+    std::sort(procedures.begin(), procedures.end(),
+              [](const Pair<Name, const FlatCfg*>& first, const Pair<Name, const FlatCfg*>& second) {
+                  return first.second->getFirstStatement() < second.second->getFirstStatement();
+              });
+    std::unordered_map<Name, size_t> indexOfProcedure;
+    StatementNumber lastStatement = 0;
+    for (const Pair<Name, const FlatCfg*>& procedure : procedures) {
+        indexOfProcedure.insert({procedure.first, procedureNames.size()});
+        procedureNames.push_back(procedure.first);
+        this->procedureCfgs.push_back(procedure.second);
+        lastStatement = std::max(lastStatement, procedure.second->getLastStatement());
+    }
+
+    // locate the statements, and the calls between procedures
+    size_t numberOfStatements = static_cast<size_t>(lastStatement) + 1;
+    procedureIndexes.assign(numberOfStatements, NoProcedure);
+    calledProcedureIndexes.assign(numberOfStatements, NoProcedure);
+    exitStatements.assign(numberOfStatements, false);
+    Vector<Pair<size_t, StatementNumber>> calls;
+    for (size_t index = 0; index < this->procedureCfgs.size(); index++) {
+        const FlatCfg& cfg = *(this->procedureCfgs[index]);
+        for (StatementNumber stmtNum = cfg.getFirstStatement(); stmtNum <= cfg.getLastStatement(); stmtNum++) {
+            procedureIndexes[stmtNum] = index;
+            if (cfg.getStatementType(stmtNum) == CallStatement) {
+                size_t calledIndex = indexOfProcedure.at(cfg.getCalledProcedure(stmtNum));
+                calledProcedureIndexes[stmtNum] = calledIndex;
+                calls.emplace_back(calledIndex, stmtNum);
+            }
+        }
+        for (StatementNumber exit : cfg.getExitStatements()) {
+            exitStatements[exit] = true;
+        }
+    }
+
+    // group the call statements by the procedure called
+    std::sort(calls.begin(), calls.end());
+    callSiteOffsets.assign(procedureNames.size() + 1, 0);
+    callSites.reserve(calls.size());
+    for (const Pair<size_t, StatementNumber>& call : calls) {
+        callSiteOffsets[call.first + 1]++;
+        callSites.push_back(call.second);
+    }
+    for (size_t index = 0; index < procedureNames.size(); index++) {
+        callSiteOffsets[index + 1] += callSiteOffsets[index];
+    }
+
+    proceduresCallersFirst = sortCallersBeforeCallees();
+    summariseProcedures();
+}
+
+/**
+ * Sorts the procedures such that every procedure comes
+ * before the procedures it calls, which is possible as
+ * the call graph of a SIMPLE program has no cycles.
+ *
+ * @return The indexes of the procedures, callers first.
+ */
+Vector<size_t> BipSupergraph::sortCallersBeforeCallees() const
+{
+    // depth first search, finishing a procedure after its callees
+    Vector<size_t> finishedProcedures;
+    Vector<Boolean> visitedProcedures(procedureNames.size(), false);
+    for (size_t start = 0; start < procedureNames.size(); start++) {
+        if (visitedProcedures[start]) {
+            continue;
+        }
+        visitedProcedures[start] = true;
+        Vector<Pair<size_t, StatementNumber>> procedureStack{{start, getEntryStatement(start)}};
+        while (!procedureStack.empty()) {
+            size_t procedureIndex = procedureStack.back().first;
+            StatementNumber& stmtNum = procedureStack.back().second;
+            const FlatCfg& cfg = *procedureCfgs[procedureIndex];
+            while (stmtNum <= cfg.getLastStatement() && calledProcedureIndexes[stmtNum] == NoProcedure) {
+                stmtNum++;
+            }
+            if (stmtNum > cfg.getLastStatement()) {
+                finishedProcedures.push_back(procedureIndex);
+                procedureStack.pop_back();
+                continue;
+            }
+            size_t calledIndex = calledProcedureIndexes[stmtNum];
+            stmtNum++;
+            if (!visitedProcedures[calledIndex]) {
+                visitedProcedures[calledIndex] = true;
+                procedureStack.emplace_back(calledIndex, getEntryStatement(calledIndex));
+            }
+        }
+    }
+    std::reverse(finishedProcedures.begin(), finishedProcedures.end());
+    return finishedProcedures;
+}
+
+/**
+ * Searches the statements of a procedure from the statements
+ * given, without following its call and return edges. A call
+ * statement is passed over using the summary of the procedure
+ * called, which must already be computed.
+ *
+ * @param procedureIndex The procedure to search.
+ * @param startStatements The statements in the procedure to start from.
+ * @param reachedStatements The statements reached, including those run
+ *                          by the calls passed over.
+ * @return True, if the search can reach the end of the procedure.
+ */
+Boolean BipSupergraph::searchWithinProcedure(size_t procedureIndex, const Vector<StatementNumber>& startStatements,
+                                             Bitset& reachedStatements) const
+{
+    const FlatCfg& cfg = *procedureCfgs[procedureIndex];
+    StatementNumber firstStatement = cfg.getFirstStatement();
+    Vector<Boolean> visited(cfg.countStatements(), false);
+    Vector<StatementNumber> statementsToVisit = startStatements;
+    Boolean canReturn = false;
+    while (!statementsToVisit.empty()) {
+        StatementNumber stmtNum = statementsToVisit.back();
+        statementsToVisit.pop_back();
+        if (visited[stmtNum - firstStatement]) {
+            continue;
+        }
+        visited[stmtNum - firstStatement] = true;
+        reachedStatements.set(stmtNum);
+        size_t calledIndex = calledProcedureIndexes[stmtNum];
+        if (calledIndex != NoProcedure) {
+            reachedStatements |= statementsRunByCall[calledIndex];
+            if (!returningProcedures[calledIndex]) {
+                continue;
+            }
+        }
+        canReturn = canReturn || exitStatements[stmtNum];
+        StatementRange successors = cfg.getNext(stmtNum);
+        statementsToVisit.insert(statementsToVisit.end(), successors.begin(), successors.end());
+    }
+    return canReturn;
+}
+
+/**
+ * Computes the summary of every procedure. The statements run by
+ * a call are found with the procedures called summarised first,
+ * while the statements after a return are found with the
+ * procedures calling it summarised first.
+ */
+Void BipSupergraph::summariseProcedures()
+{
+    size_t numberOfStatements = procedureIndexes.size();
+    size_t numberOfProcedures = procedureNames.size();
+    statementsRunByCall.assign(numberOfProcedures, Bitset(numberOfStatements));
+    returningProcedures.assign(numberOfProcedures, false);
+    statementsAfterReturn.assign(numberOfProcedures, Bitset(numberOfStatements));
+
+    for (auto iterator = proceduresCallersFirst.rbegin(); iterator != proceduresCallersFirst.rend(); iterator++) {
+        size_t procedureIndex = *iterator;
+        returningProcedures[procedureIndex] = searchWithinProcedure(
+            procedureIndex, {getEntryStatement(procedureIndex)}, statementsRunByCall[procedureIndex]);
+    }
+    for (size_t procedureIndex : proceduresCallersFirst) {
+        Bitset& afterReturn = statementsAfterReturn[procedureIndex];
+        for (StatementNumber callSite : getCallSites(procedureIndex)) {
+            size_t callerIndex = getProcedureOf(callSite);
+            StatementRange returnSites = getReturnSites(callSite);
+            Boolean callerCanReturn = searchWithinProcedure(
+                callerIndex, Vector<StatementNumber>(returnSites.begin(), returnSites.end()), afterReturn);
+            if (callerCanReturn || returnSites.empty()) {
+                afterReturn |= statementsAfterReturn[callerIndex];
+            }
+        }
+    }
+}
+
+size_t BipSupergraph::countProcedures() const
+{
+    return procedureNames.size();
+}
+
+const Name& BipSupergraph::getProcedureName(size_t procedureIndex) const
+{
+    return procedureNames[procedureIndex];
+}
+
+const FlatCfg& BipSupergraph::getProcedureCfg(size_t procedureIndex) const
+{
+    return *procedureCfgs[procedureIndex];
+}
+
+StatementNumber BipSupergraph::getEntryStatement(size_t procedureIndex) const
+{
+    return procedureCfgs[procedureIndex]->getFirstStatement();
+}
+
+StatementNumber BipSupergraph::getLastStatement() const
+{
+    return static_cast<StatementNumber>(procedureIndexes.size()) - 1;
+}
+
+Boolean BipSupergraph::containsStatement(StatementNumber stmtNum) const
+{
+    return stmtNum > 0 && static_cast<size_t>(stmtNum) < procedureIndexes.size()
+           && procedureIndexes[stmtNum] != NoProcedure;
+}
+
+size_t BipSupergraph::getProcedureOf(StatementNumber stmtNum) const
+{
+    assert(containsStatement(stmtNum)); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    return procedureIndexes[stmtNum];
+}
+
+StatementType BipSupergraph::getStatementType(StatementNumber stmtNum) const
+{
+    return procedureCfgs[getProcedureOf(stmtNum)]->getStatementType(stmtNum);
+}
+
+Boolean BipSupergraph::isExitStatement(StatementNumber stmtNum) const
+{
+    return containsStatement(stmtNum) && exitStatements[stmtNum];
+}
+
+size_t BipSupergraph::getCalledProcedure(StatementNumber callStmtNum) const
+{
+    assert(getStatementType(callStmtNum) == CallStatement); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    return calledProcedureIndexes[callStmtNum];
+}
+
+StatementRange BipSupergraph::getCallSites(size_t procedureIndex) const
+{
+    return StatementRange(callSites.data() + callSiteOffsets[procedureIndex],
+                          callSites.data() + callSiteOffsets[procedureIndex + 1]);
+}
+
+StatementRange BipSupergraph::getReturnSites(StatementNumber callStmtNum) const
+{
+    // the return sites are the successors of the call in its flat CFG
+    return procedureCfgs[getProcedureOf(callStmtNum)]->getNext(callStmtNum);
+}
+
+const Vector<size_t>& BipSupergraph::getProceduresCallersFirst() const
+{
+    return proceduresCallersFirst;
+}
+
+/**
+ * Finds the return sites of every call of a procedure, going
+ * on to the calls of the procedure containing a call statement
+ * if that call statement has no return sites.
+ *
+ * @param procedureIndex The procedure returned from.
+ * @param visitedProcedures The procedures already returned from.
+ * @param returnSites The return sites found.
+ */
+Void BipSupergraph::findReturnSitesOfCalls(size_t procedureIndex, Vector<Boolean>& visitedProcedures,
+                                           Vector<StatementNumber>& returnSites) const
+{
+    if (visitedProcedures[procedureIndex]) {
+        return;
+    }
+    visitedProcedures[procedureIndex] = true;
+    for (StatementNumber callSite : getCallSites(procedureIndex)) {
+        StatementRange sites = getReturnSites(callSite);
+        if (sites.empty()) {
+            findReturnSitesOfCalls(getProcedureOf(callSite), visitedProcedures, returnSites);
+        } else {
+            returnSites.insert(returnSites.end(), sites.begin(), sites.end());
+        }
+    }
+}
+
+Vector<StatementNumber> BipSupergraph::getNextBip(StatementNumber stmtNum) const
+{
+    if (getStatementType(stmtNum) == CallStatement) {
+        return {getEntryStatement(getCalledProcedure(stmtNum))};
+    }
+    StatementRange successors = procedureCfgs[getProcedureOf(stmtNum)]->getNext(stmtNum);
+    Vector<StatementNumber> nextStatements(successors.begin(), successors.end());
+    if (isExitStatement(stmtNum)) {
+        Vector<Boolean> visitedProcedures(procedureNames.size(), false);
+        findReturnSitesOfCalls(getProcedureOf(stmtNum), visitedProcedures, nextStatements);
+        std::sort(nextStatements.begin(), nextStatements.end());
+        nextStatements.erase(std::unique(nextStatements.begin(), nextStatements.end()), nextStatements.end());
+    }
+    return nextStatements;
+}
+
+Bitset BipSupergraph::findReachableFrom(StatementNumber stmtNum) const
+{
+    Bitset reachedStatements(procedureIndexes.size());
+    if (!containsStatement(stmtNum)) {
+        return reachedStatements;
+    }
+
+    size_t procedureIndex = getProcedureOf(stmtNum);
+    Boolean canReturn = exitStatements[stmtNum];
+    Vector<StatementNumber> startStatements;
+    size_t calledIndex = calledProcedureIndexes[stmtNum];
+    if (calledIndex != NoProcedure) {
+        reachedStatements |= statementsRunByCall[calledIndex];
+        canReturn = canReturn && returningProcedures[calledIndex];
+    }
+    if (calledIndex == NoProcedure || returningProcedures[calledIndex]) {
+        StatementRange successors = procedureCfgs[procedureIndex]->getNext(stmtNum);
+        startStatements.assign(successors.begin(), successors.end());
+    }
+
+    // the statement itself is only reached again through a loop
+    canReturn = searchWithinProcedure(procedureIndex, startStatements, reachedStatements) || canReturn;
+    if (canReturn) {
+        reachedStatements |= statementsAfterReturn[procedureIndex];
+    }
+    return reachedStatements;
+}
@@ -0,0 +1,135 @@
+/**
+ * Control Flow Graph with branching into procedures
+ * (CFG BIP), formed by linking the flat CFGs of the
+ * procedures of a program into a single supergraph.
+ */
+
+#ifndef SPA_CFG_BIP_SUPERGRAPH_H
+#define SPA_CFG_BIP_SUPERGRAPH_H
+
+#include "Bitset.h"
+#include "FlatCfg.h"
+
+/**
+ * Every procedure appears in the supergraph exactly once, no
+ * matter how many times it is called, so the size of the CFG
+ * BIP is linear in the size of the program. Within a procedure,
+ * the edges are those of its flat CFG, except that a call
+ * statement has no edge to the statements after it. Instead,
+ * the call statement has a call edge to the first statement
+ * of the procedure called, and each statement that can be the
+ * last statement executed in the procedure called has a return
+ * edge back to each statement after the call statement (the
+ * return sites of the call). Both edges are labelled by the
+ * call statement, so a traversal that keeps a stack of the call
+ * statements it passed through only returns to the call site
+ * it came from, as if the CFG of the procedure was inlined.
+ *
+ * A call statement at the end of a procedure has no return sites.
+ * Returning through it continues with returning from the procedure
+ * containing the call statement, to the return sites of its calls.
+ *
+ * As SIMPLE has no recursion, the procedures can be summarised
+ * in the order of the call graph when the CFG BIP is built. The
+ * summary of a procedure holds the statements run by a call of
+ * it, whether a call of it can return at all, and the statements
+ * that can run after it returns to any of its calls. Searches over
+ * the CFG BIP then pass over each call statement in a single step,
+ * instead of walking through the procedure called once per call.
+ */
+class BipSupergraph {
+public:
+    /**
+     * Links the flat CFGs of the procedures of a program into
+     * a CFG BIP. The flat CFGs are not copied, and must outlive
+     * the CFG BIP. Every procedure called by a call statement
+     * must be one of the procedures provided.
+     *
+     * @param procedureCfgs The name and flat CFG of each procedure.
+     */
+    explicit BipSupergraph(const Vector<Pair<Name, const FlatCfg*>>& procedureCfgs);
+
+    // Counts the procedures in the CFG BIP.
+    size_t countProcedures() const;
+    // Gets the name of a procedure, by the index of the procedure.
+    const Name& getProcedureName(size_t procedureIndex) const;
+    // Gets the flat CFG of a procedure, by the index of the procedure.
+    const FlatCfg& getProcedureCfg(size_t procedureIndex) const;
+    // Gets the first statement of a procedure, which calls enter.
+    StatementNumber getEntryStatement(size_t procedureIndex) const;
+
+    // Gets the largest statement number in the CFG BIP.
+    StatementNumber getLastStatement() const;
+    // Checks whether the statement is in any procedure of the CFG BIP.
+    Boolean containsStatement(StatementNumber stmtNum) const;
+    // Gets the index of the procedure containing a statement.
+    size_t getProcedureOf(StatementNumber stmtNum) const;
+    // Gets the type of a statement in the CFG BIP.
+    StatementType getStatementType(StatementNumber stmtNum) const;
+    // Checks whether a statement can be the last statement executed in its procedure.
+    Boolean isExitStatement(StatementNumber stmtNum) const;
+
+    // Gets the index of the procedure called by a call statement.
+    size_t getCalledProcedure(StatementNumber callStmtNum) const;
+    // Gets the call statements that call a procedure, in ascending order.
+    StatementRange getCallSites(size_t procedureIndex) const;
+    // Gets the statements returned to after a call statement, in ascending order.
+    StatementRange getReturnSites(StatementNumber callStmtNum) const;
+    // Gets the indexes of all procedures, with each procedure before the procedures it calls.
+    const Vector<size_t>& getProceduresCallersFirst() const;
+
+    /**
+     * Gets the statements directly after a statement in the CFG
+     * BIP (i.e. NextBip), in ascending order. As the call that led
+     * to the procedure of the statement is not known, the last
+     * statements of a procedure return to every call of it.
+     *
+     * @param stmtNum A statement in the CFG BIP.
+     * @return The statements directly after the statement.
+     */
+    Vector<StatementNumber> getNextBip(StatementNumber stmtNum) const;
+
+    /**
+     * Finds every statement that can run after a statement in the
+     * CFG BIP (i.e. NextBip*), by composing the summaries of the
+     * procedures instead of keeping a stack of calls. As with
+     * NextBip, the call that led to the procedure of the statement
+     * is not known, so the statement may return to every call of it.
+     *
+     * @param stmtNum A statement in the CFG BIP.
+     * @return The statements that can run after the statement,
+     *         indexed by statement number.
+     */
+    Bitset findReachableFrom(StatementNumber stmtNum) const;
+
+private:
+    Vector<Name> procedureNames;
+    Vector<const FlatCfg*> procedureCfgs;
+
+    // index of the procedure containing each statement, and the
+    // index of the procedure called by each call statement
+    Vector<size_t> procedureIndexes;
+    Vector<size_t> calledProcedureIndexes;
+    Vector<Boolean> exitStatements;
+
+    // call statements calling each procedure in CSR form
+    Vector<size_t> callSiteOffsets;
+    Vector<StatementNumber> callSites;
+
+    // procedures in the order of the call graph, callers first
+    Vector<size_t> proceduresCallersFirst;
+
+    // summary of each procedure, for searching past its calls
+    Vector<Bitset> statementsRunByCall;
+    Vector<Boolean> returningProcedures;
+    Vector<Bitset> statementsAfterReturn;
+
+    Vector<size_t> sortCallersBeforeCallees() const;
+    Void summariseProcedures();
+    Boolean searchWithinProcedure(size_t procedureIndex, const Vector<StatementNumber>& startStatements,
+                                  Bitset& reachedStatements) const;
+    Void findReturnSitesOfCalls(size_t procedureIndex, Vector<Boolean>& visitedProcedures,
+                                Vector<StatementNumber>& returnSites) const;
+};
+
+#endif // SPA_CFG_BIP_SUPERGRAPH_H
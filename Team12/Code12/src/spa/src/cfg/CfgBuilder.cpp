@@ -4,6 +4,8 @@
 
 #include "CfgBuilder.h"
 
+#include <algorithm>
+
 #include "pkb/PKB.h"
 
 /**
@@ -27,7 +29,13 @@ CfgNode* createCfgNode(size_t stmtListSize, size_t& currentNumberOfNodes)
     children->reserve(2);
     currentNumberOfNodes++;
 
-    return new CfgNode(statements, children, currentNumberOfNodes, ifJoinNode);
+    auto* node = new CfgNode(statements, children, currentNumberOfNodes, ifJoinNode);
+    AstArena* arena = ArenaAllocated::getOwningArena(node);
+    if (arena != nullptr) {
+        // the vectors of the node are on the heap, so its destructor must still run
+        arena->destroyOnRelease(node);
+    }
+    return node;
 }
 
 /**
@@ -149,6 +157,30 @@ CfgNode* buildCfgWithStatementNode(StatementNode* statementNodePtr, CfgNode* cur
     }
 }
 
+/**
+ * Links every node of a CFG to its parent nodes, so that the
+ * CFG can also be traversed backwards, from its exit nodes
+ * (the nodes without children) towards the root node.
+ *
+ * @param rootNode Root node of the CFG
+ */
+Void linkParentNodes(CfgNode* rootNode)
+{
+    Vector<CfgNode*> nodes = rootNode->findAllChildren();
+    if (std::find(nodes.begin(), nodes.end(), rootNode) == nodes.end()) {
+        // the root node is its own descendant if it starts a while loop
+        nodes.push_back(rootNode);
+    }
+    for (CfgNode* node : nodes) {
+        node->parentNodes.clear();
+    }
+    for (CfgNode* node : nodes) {
+        for (CfgNode* child : *node->childrenNodes) {
+            child->parentNodes.push_back(node);
+        }
+    }
+}
+
 /**
  * Builds the CFG of a given program.
  *
@@ -168,5 +200,6 @@ Pair<CfgNode*, size_t> buildCfg(const StmtlstNode* const stmtListNode)
         StatementNode* stmtNode = (stmtListNode->statementList).at(j).get();
         currentCfgNode = buildCfgWithStatementNode(stmtNode, currentCfgNode, currentNumber, stmtListSize);
     }
+    linkParentNodes(cfgRootNode);
     return {cfgRootNode, currentNumber};
 }
@@ -10,5 +10,6 @@
 
 CfgNode* createCfgNode(size_t stmtListSize, size_t& currentNumberOfNodes);
 std::pair<CfgNode*, size_t> buildCfg(const StmtlstNode* const rootNode);
+Void linkParentNodes(CfgNode* rootNode);
 
 #endif // SPA_CFG_BUILDER_H
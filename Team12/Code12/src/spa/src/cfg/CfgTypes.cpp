@@ -14,7 +14,7 @@
 CfgNode::CfgNode(Vector<StatementNode*>* statements, Vector<CfgNode*>* children, size_t cfgNodeNumber,
                  CfgNode* joinNode):
     statementNodes(statements),
-    childrenNodes(children), nodeNumber(cfgNodeNumber), ifJoinNode(joinNode)
+    childrenNodes(children), parentNodes(), nodeNumber(cfgNodeNumber), ifJoinNode(joinNode)
 {}
 
 CfgNode::~CfgNode()
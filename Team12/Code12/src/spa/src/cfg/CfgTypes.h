@@ -12,10 +12,13 @@
 
 typedef String Name;
 
-class CfgNode {
+class CfgNode: public ArenaAllocated {
 public:
     Vector<StatementNode*>* statementNodes;
     Vector<CfgNode*>* childrenNodes;
+    // Nodes which have this node as a child, forming the reverse
+    // CFG. Filled in by linkParentNodes once the CFG is complete.
+    Vector<CfgNode*> parentNodes;
     size_t nodeNumber;
     CfgNode* ifJoinNode;
 
@@ -0,0 +1,346 @@
+/**
+ * Implementation of the flat Control Flow Graph.
+ */
+
+#include "FlatCfg.h"
+
+#include <algorithm>
+#include <cassert>
+#include <unordered_set>
+
+StatementRange::StatementRange(const StatementNumber* first, const StatementNumber* last): first(first), last(last)
+{}
+
+const StatementNumber* StatementRange::begin() const
+{
+    return first;
+}
+
+const StatementNumber* StatementRange::end() const
+{
+    return last;
+}
+
+size_t StatementRange::size() const
+{
+    return static_cast<size_t>(last - first);
+}
+
+Boolean StatementRange::empty() const
+{
+    return first == last;
+}
+
+/**
+ * Collects every node of a CFG, ordered by node number.
+ *
+ * @param rootNode Root node of the CFG.
+ * @return All nodes of the CFG.
+ */
+Vector<const CfgNode*> collectCfgNodes(const CfgNode* rootNode)
+{
+    std::unordered_set<const CfgNode*> visitedNodes{rootNode};
+    Vector<const CfgNode*> nodes{rootNode};
+    for (size_t i = 0; i < nodes.size(); i++) {
+        for (const CfgNode* child : *(nodes[i]->childrenNodes)) {
+            if (visitedNodes.insert(child).second) {
+                nodes.push_back(child);
+            }
+        }
+    }
+    std::sort(nodes.begin(), nodes.end(),
+              [](const CfgNode* first, const CfgNode* second) { return first->nodeNumber < second->nodeNumber; });
+    return nodes;
+}
+
+/**
+ * Finds the first statements of the nodes that can be entered
+ * from a CFG node, skipping over nodes without statements
+ * (e.g. the dummy nodes joining if/else branches).
+ *
+ * @param node The CFG node entered.
+ * @param visitedEmptyNodes Empty nodes already skipped over.
+ * @param entries The first statements found.
+ */
+Void findEntryStatements(const CfgNode* node, std::unordered_set<const CfgNode*>& visitedEmptyNodes,
+                         Vector<StatementNumber>& entries)
+{
+    if (!node->statementNodes->empty()) {
+        entries.push_back(node->statementNodes->front()->getStatementNumber());
+        return;
+    }
+    if (!visitedEmptyNodes.insert(node).second) {
+        return;
+    }
+    for (const CfgNode* child : *(node->childrenNodes)) {
+        findEntryStatements(child, visitedEmptyNodes, entries);
+    }
+}
+
+/**
+ * Finds the last statements of the nodes that can be left to
+ * enter a CFG node, going backwards through the reverse CFG
+ * and skipping over nodes without statements.
+ *
+ * @param node The CFG node left.
+ * @param visitedEmptyNodes Empty nodes already skipped over.
+ * @param exits The last statements found.
+ */
+Void findExitingStatements(const CfgNode* node, std::unordered_set<const CfgNode*>& visitedEmptyNodes,
+                           Vector<StatementNumber>& exits)
+{
+    if (!node->statementNodes->empty()) {
+        exits.push_back(node->statementNodes->back()->getStatementNumber());
+        return;
+    }
+    if (!visitedEmptyNodes.insert(node).second) {
+        return;
+    }
+    for (const CfgNode* parent : node->parentNodes) {
+        findExitingStatements(parent, visitedEmptyNodes, exits);
+    }
+}
+
+/**
+ * Builds the offsets and targets of edges in CSR form,
+ * from edges sorted by their source statement.
+ *
+ * @param edges The (source, target) edges, sorted and without duplicates.
+ * @param firstStatement The statement with index 0.
+ * @param numberOfStatements The number of statements.
+ * @param offsets The offsets of the edges of each statement.
+ * @param targets The targets of the edges.
+ */
+Void buildCompressedRows(const Vector<Pair<StatementNumber, StatementNumber>>& edges, StatementNumber firstStatement,
+                         size_t numberOfStatements, Vector<size_t>& offsets, Vector<StatementNumber>& targets)
+{
+    offsets.assign(numberOfStatements + 1, 0);
+    targets.reserve(edges.size());
+    for (const Pair<StatementNumber, StatementNumber>& edge : edges) {
+        offsets[static_cast<size_t>(edge.first - firstStatement) + 1]++;
+        targets.push_back(edge.second);
+    }
+    for (size_t i = 0; i < numberOfStatements; i++) {
+        offsets[i + 1] += offsets[i];
+    }
+}
+
+FlatCfg::FlatCfg(const CfgNode* rootNode): firstStatement(1), lastStatement(0)
+{
+    Vector<const CfgNode*> nodes = collectCfgNodes(rootNode);
+
+    // lay out the statements by basic block
+    blockOffsets.push_back(0);
+    for (const CfgNode* node : nodes) {
+        if (node->statementNodes->empty()) {
+            continue;
+        }
+        for (const StatementNode* statement : *(node->statementNodes)) {
+            blockStatements.push_back(statement->getStatementNumber());
+        }
+        blockOffsets.push_back(blockStatements.size());
+    }
+    if (blockStatements.empty()) {
+        successorOffsets.assign(1, 0);
+        predecessorOffsets.assign(1, 0);
+        return;
+    }
+    firstStatement = *std::min_element(blockStatements.begin(), blockStatements.end());
+    lastStatement = *std::max_element(blockStatements.begin(), blockStatements.end());
+    size_t numberOfStatements = countStatements();
+    // statements of a procedure are numbered consecutively
+    assert(numberOfStatements == blockStatements.size()); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    blockIndexes.assign(numberOfStatements, 0);
+    statementTypes.assign(numberOfStatements, AnyStatement);
+    size_t block = 0;
+    for (const CfgNode* node : nodes) {
+        if (node->statementNodes->empty()) {
+            continue;
+        }
+        for (const StatementNode* statement : *(node->statementNodes)) {
+            size_t index = toIndex(statement->getStatementNumber());
+            blockIndexes[index] = block;
+            statementTypes[index] = statement->getStatementType();
+            if (statementTypes[index] == CallStatement) {
+                const auto* callStatement = dynamic_cast<const CallStatementNode*>(statement);
+                calledProcedures.emplace_back(statement->getStatementNumber(), callStatement->procedureName);
+            }
+        }
+        block++;
+    }
+    std::sort(calledProcedures.begin(), calledProcedures.end());
+
+    // find the edges within and between basic blocks, going
+    // forwards through the CFG for successors, and backwards
+    // through the reverse CFG for predecessors
+    Vector<Pair<StatementNumber, StatementNumber>> forwardEdges;
+    Vector<Pair<StatementNumber, StatementNumber>> backwardEdges;
+    for (const CfgNode* node : nodes) {
+        const Vector<StatementNode*>& statements = *(node->statementNodes);
+        if (statements.empty()) {
+            if (node->childrenNodes->empty()) {
+                // the procedure ends after this node
+                std::unordered_set<const CfgNode*> visitedEmptyNodes;
+                findExitingStatements(node, visitedEmptyNodes, exitStatements);
+            }
+            continue;
+        }
+        for (size_t i = 0; i + 1 < statements.size(); i++) {
+            StatementNumber current = statements[i]->getStatementNumber();
+            StatementNumber next = statements[i + 1]->getStatementNumber();
+            forwardEdges.emplace_back(current, next);
+            backwardEdges.emplace_back(next, current);
+        }
+
+        StatementNumber lastInBlock = statements.back()->getStatementNumber();
+        Vector<StatementNumber> entries;
+        std::unordered_set<const CfgNode*> visitedEmptyNodes;
+        for (const CfgNode* child : *(node->childrenNodes)) {
+            findEntryStatements(child, visitedEmptyNodes, entries);
+        }
+        for (StatementNumber entry : entries) {
+            forwardEdges.emplace_back(lastInBlock, entry);
+        }
+        if (node->childrenNodes->empty()) {
+            exitStatements.push_back(lastInBlock);
+        }
+
+        StatementNumber firstInBlock = statements.front()->getStatementNumber();
+        Vector<StatementNumber> exits;
+        visitedEmptyNodes.clear();
+        for (const CfgNode* parent : node->parentNodes) {
+            findExitingStatements(parent, visitedEmptyNodes, exits);
+        }
+        for (StatementNumber exit : exits) {
+            backwardEdges.emplace_back(firstInBlock, exit);
+        }
+    }
+    std::sort(forwardEdges.begin(), forwardEdges.end());
+    forwardEdges.erase(std::unique(forwardEdges.begin(), forwardEdges.end()), forwardEdges.end());
+    buildCompressedRows(forwardEdges, firstStatement, numberOfStatements, successorOffsets, successors);
+    std::sort(backwardEdges.begin(), backwardEdges.end());
+    backwardEdges.erase(std::unique(backwardEdges.begin(), backwardEdges.end()), backwardEdges.end());
+    buildCompressedRows(backwardEdges, firstStatement, numberOfStatements, predecessorOffsets, predecessors);
+    // every edge is found in both directions, if the parent nodes are linked
+    assert(successors.size() == predecessors.size()); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    std::sort(exitStatements.begin(), exitStatements.end());
+    exitStatements.erase(std::unique(exitStatements.begin(), exitStatements.end()), exitStatements.end());
+}
+
+size_t FlatCfg::toIndex(StatementNumber stmtNum) const
+{
+    assert(containsStatement(stmtNum)); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    return static_cast<size_t>(stmtNum - firstStatement);
+}
+
+StatementNumber FlatCfg::getFirstStatement() const
+{
+    return firstStatement;
+}
+
+StatementNumber FlatCfg::getLastStatement() const
+{
+    return lastStatement;
+}
+
+Boolean FlatCfg::containsStatement(StatementNumber stmtNum) const
+{
+    return stmtNum >= firstStatement && stmtNum <= lastStatement;
+}
+
+size_t FlatCfg::countStatements() const
+{
+    return static_cast<size_t>(lastStatement + 1 - firstStatement);
+}
+
+StatementType FlatCfg::getStatementType(StatementNumber stmtNum) const
+{
+    return statementTypes[toIndex(stmtNum)];
+}
+
+const Name& FlatCfg::getCalledProcedure(StatementNumber stmtNum) const
+{
+    assert(getStatementType(stmtNum) == CallStatement); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    auto position = std::lower_bound(
+        calledProcedures.begin(), calledProcedures.end(), stmtNum,
+        [](const Pair<StatementNumber, Name>& call, StatementNumber number) { return call.first < number; });
+    return position->second;
+}
+
+StatementRange FlatCfg::getNext(StatementNumber stmtNum) const
+{
+    size_t index = toIndex(stmtNum);
+    return StatementRange(successors.data() + successorOffsets[index],
+                          successors.data() + successorOffsets[index + 1]);
+}
+
+StatementRange FlatCfg::getPrevious(StatementNumber stmtNum) const
+{
+    size_t index = toIndex(stmtNum);
+    return StatementRange(predecessors.data() + predecessorOffsets[index],
+                          predecessors.data() + predecessorOffsets[index + 1]);
+}
+
+size_t FlatCfg::countBlocks() const
+{
+    return blockOffsets.size() - 1;
+}
+
+StatementRange FlatCfg::getBlock(size_t blockIndex) const
+{
+    return StatementRange(blockStatements.data() + blockOffsets[blockIndex],
+                          blockStatements.data() + blockOffsets[blockIndex + 1]);
+}
+
+size_t FlatCfg::getBlockOf(StatementNumber stmtNum) const
+{
+    return blockIndexes[toIndex(stmtNum)];
+}
+
+StatementRange FlatCfg::getExitStatements() const
+{
+    return StatementRange(exitStatements.data(), exitStatements.data() + exitStatements.size());
+}
+
+/**
+ * Finds all statements reachable from a statement by following
+ * one or more edges in CSR form, in a breadth-first search.
+ *
+ * @param stmtNum The statement to start from.
+ * @param offsets The offsets of the edges of each statement.
+ * @param targets The targets of the edges.
+ * @return The statements reached, in no particular order.
+ */
+Vector<StatementNumber> FlatCfg::searchEdges(StatementNumber stmtNum, const Vector<size_t>& offsets,
+                                             const Vector<StatementNumber>& targets) const
+{
+    Vector<Boolean> visited(countStatements(), false);
+    Vector<StatementNumber> reached;
+    size_t startIndex = toIndex(stmtNum);
+    for (size_t edge = offsets[startIndex]; edge < offsets[startIndex + 1]; edge++) {
+        visited[toIndex(targets[edge])] = true;
+        reached.push_back(targets[edge]);
+    }
+    // the statements reached also serve as the queue of the search
+    for (size_t i = 0; i < reached.size(); i++) {
+        size_t currentIndex = toIndex(reached[i]);
+        for (size_t edge = offsets[currentIndex]; edge < offsets[currentIndex + 1]; edge++) {
+            size_t index = toIndex(targets[edge]);
+            if (!visited[index]) {
+                visited[index] = true;
+                reached.push_back(targets[edge]);
+            }
+        }
+    }
+    return reached;
+}
+
+Vector<StatementNumber> FlatCfg::findReachableFrom(StatementNumber stmtNum) const
+{
+    return searchEdges(stmtNum, successorOffsets, successors);
+}
+
+Vector<StatementNumber> FlatCfg::findReachableTo(StatementNumber stmtNum) const
+{
+    return searchEdges(stmtNum, predecessorOffsets, predecessors);
+}
@@ -0,0 +1,144 @@
+/**
+ * Frozen, flat form of the Control Flow Graph of a
+ * procedure. The pointer-based CfgNode graph is only
+ * used while the CFG is being built, and traversals
+ * run on the arrays of the FlatCfg instead.
+ */
+
+#ifndef SPA_CFG_FLAT_CFG_H
+#define SPA_CFG_FLAT_CFG_H
+
+#include "CfgTypes.h"
+
+/**
+ * A read-only view of consecutive statement numbers in
+ * one of the arrays of a FlatCfg.
+ */
+class StatementRange {
+public:
+    StatementRange(const StatementNumber* first, const StatementNumber* last);
+
+    const StatementNumber* begin() const;
+    const StatementNumber* end() const;
+    size_t size() const;
+    Boolean empty() const;
+
+private:
+    const StatementNumber* first;
+    const StatementNumber* last;
+};
+
+/**
+ * The statements of a procedure are numbered consecutively,
+ * so a statement is located in the arrays by its offset from
+ * the first statement of the procedure. The successors and
+ * predecessors of the statements are stored in compressed
+ * sparse row (CSR) form, where the edges of a statement lie
+ * between edgeOffsets[i] and edgeOffsets[i + 1].
+ *
+ * Statements are also laid out basic block by basic block,
+ * in the order of the nodes of the CFG, with the boundaries
+ * of the basic blocks stored as offsets into that layout.
+ */
+class FlatCfg {
+public:
+    /**
+     * Freezes the CFG of a procedure into a FlatCfg.
+     * The CFG is not modified, and is not referenced
+     * by the FlatCfg after construction. The parent
+     * nodes of the CFG must have been linked (see
+     * linkParentNodes), as the predecessors of the
+     * statements are taken from the reverse CFG.
+     *
+     * @param rootNode Root node of the CFG of a procedure.
+     */
+    explicit FlatCfg(const CfgNode* rootNode);
+
+    // Gets the first statement number of the procedure.
+    StatementNumber getFirstStatement() const;
+    // Gets the last statement number of the procedure.
+    StatementNumber getLastStatement() const;
+    // Checks whether the statement is in the procedure.
+    Boolean containsStatement(StatementNumber stmtNum) const;
+    // Counts the statements in the procedure.
+    size_t countStatements() const;
+    // Gets the type of a statement in the procedure.
+    StatementType getStatementType(StatementNumber stmtNum) const;
+    // Gets the procedure called by a call statement in the procedure.
+    const Name& getCalledProcedure(StatementNumber stmtNum) const;
+
+    /**
+     * Gets the statements directly after a statement in
+     * the procedure, in ascending order. The statement
+     * must be in the procedure.
+     */
+    StatementRange getNext(StatementNumber stmtNum) const;
+
+    /**
+     * Gets the statements directly before a statement in
+     * the procedure, in ascending order. The statement
+     * must be in the procedure.
+     */
+    StatementRange getPrevious(StatementNumber stmtNum) const;
+
+    /**
+     * Gets the statements that can be the last statement
+     * executed in the procedure, in ascending order, where
+     * backward traversals of the procedure start from.
+     */
+    StatementRange getExitStatements() const;
+
+    // Counts the basic blocks (CFG nodes with statements).
+    size_t countBlocks() const;
+    // Gets the statements of a basic block, in order.
+    StatementRange getBlock(size_t blockIndex) const;
+    // Gets the index of the basic block containing a statement.
+    size_t getBlockOf(StatementNumber stmtNum) const;
+
+    /**
+     * Finds all statements that can be reached from a statement
+     * through one or more Next relationships (i.e. Next*), by
+     * a breadth-first search over the successor arrays.
+     *
+     * @param stmtNum A statement in the procedure.
+     * @return The statements reached, in no particular order.
+     */
+    Vector<StatementNumber> findReachableFrom(StatementNumber stmtNum) const;
+
+    /**
+     * Finds all statements that can reach a statement through
+     * one or more Next relationships (i.e. Next* with the right
+     * statement known), by a breadth-first search over the
+     * predecessor arrays.
+     *
+     * @param stmtNum A statement in the procedure.
+     * @return The statements reached, in no particular order.
+     */
+    Vector<StatementNumber> findReachableTo(StatementNumber stmtNum) const;
+
+private:
+    StatementNumber firstStatement;
+    StatementNumber lastStatement;
+
+    // statements laid out by basic block
+    Vector<StatementNumber> blockStatements;
+    Vector<size_t> blockOffsets;
+    // index of the basic block and type of each statement
+    Vector<size_t> blockIndexes;
+    Vector<StatementType> statementTypes;
+    // procedure called by each call statement, by statement number
+    Vector<Pair<StatementNumber, Name>> calledProcedures;
+
+    // successors and predecessors in CSR form
+    Vector<size_t> successorOffsets;
+    Vector<StatementNumber> successors;
+    Vector<size_t> predecessorOffsets;
+    Vector<StatementNumber> predecessors;
+    Vector<StatementNumber> exitStatements;
+
+    size_t toIndex(StatementNumber stmtNum) const;
+    Vector<StatementNumber> searchEdges(StatementNumber stmtNum, const Vector<size_t>& offsets,
+                                        const Vector<StatementNumber>& targets) const;
+};
+
+#endif // SPA_CFG_FLAT_CFG_H
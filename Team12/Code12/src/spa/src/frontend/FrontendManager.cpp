@@ -1,16 +1,24 @@
 /**
- * Implementation of parseSimple for the Frontend Manager.
+ * Implementation of parseSimple and parseSimpleFile for the Frontend Manager.
  */
 #include "FrontendManager.h"
 
+#include "SourceFile.h"
 #include "Ui.h"
 #include "designExtractor/DesignExtractor.h"
 #include "parser/Parser.h"
 #include "pkb/PKB.h"
 
-Void parseSimple(const String& rawProgram, Ui& ui)
+/**
+ * Checks the result of parsing a SIMPLE program, then runs
+ * the Design Extractor on it and stores it in the Program
+ * Knowledge Base.
+ *
+ * @param parsedProgram The result of parsing the program.
+ * @param ui UI to display errors.
+ */
+Void processParsedProgram(ParserReturnType<ProgramNode*> parsedProgram, Ui& ui)
 {
-    ParserReturnType<ProgramNode*> parsedProgram = parseSimpleReturnNode(rawProgram);
     if (parsedProgram.hasError()) {
         ui.postUiError(InputError(parsedProgram.getErrorString(), 0, 0, ErrorSource::SimpleProgram, ErrorType::Syntax));
         resetPKB();
@@ -23,8 +31,26 @@ Void parseSimple(const String& rawProgram, Ui& ui)
     if (hasSemanticError) {
         ui.postUiError(InputError("Check called procedures.", 0, 0, ErrorSource::SimpleProgram, ErrorType::Semantic));
         resetPKB();
+        delete abstractSyntaxTree;
         return;
     }
     // if no error, store root node in Program Knowledge Base
     assignRootNode(abstractSyntaxTree);
 }
+
+Void parseSimple(const String& rawProgram, Ui& ui)
+{
+    processParsedProgram(parseSimpleReturnNode(rawProgram), ui);
+}
+
+Void parseSimpleFile(const String& filename, Ui& ui)
+{
+    SourceFile sourceFile(filename);
+    if (!sourceFile.isOpen()) {
+        ui.postUiError(InputError("Unable to open " + filename + ".", 0, 0, ErrorSource::SimpleProgram,
+                                  ErrorType::Unknown));
+        resetPKB();
+        return;
+    }
+    processParsedProgram(parseSimpleReturnNode(sourceFile.data(), sourceFile.size()), ui);
+}
@@ -22,4 +22,16 @@
  */
 Void parseSimple(const String& rawProgram, Ui& ui);
 
+/**
+ * Parses the SIMPLE program in the given file and stores
+ * the result in the Program Knowledge Base. The file is
+ * memory-mapped and parsed one procedure at a time, rather
+ * than being read into a String first. If there is any
+ * error, call the UI to display the error to the user.
+ *
+ * @param filename Path to the SIMPLE source file.
+ * @param ui UI to display errors.
+ */
+Void parseSimpleFile(const String& filename, Ui& ui);
+
 #endif // SPA_FrontendManager_H
@@ -0,0 +1,76 @@
+/**
+ * Implementation of SourceFile, using mmap on POSIX systems
+ * and reading the file into a buffer elsewhere.
+ */
+
+#include "SourceFile.h"
+
+#include <fstream>
+#include <iterator>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+SourceFile::SourceFile(const String& path): contents(nullptr), length(0), isOpened(false), isMapped(false)
+{
+#ifndef _WIN32
+    int fileDescriptor = open(path.c_str(), O_RDONLY);
+    if (fileDescriptor >= 0) {
+        struct stat fileStatus {};
+        if (fstat(fileDescriptor, &fileStatus) == 0 && fileStatus.st_size > 0) {
+            void* mapping = mmap(nullptr, static_cast<size_t>(fileStatus.st_size), PROT_READ, MAP_PRIVATE,
+                                 fileDescriptor, 0);
+            if (mapping != MAP_FAILED) {
+                // the program is read once from start to end
+                madvise(mapping, static_cast<size_t>(fileStatus.st_size), MADV_SEQUENTIAL);
+                contents = static_cast<const char*>(mapping);
+                length = static_cast<size_t>(fileStatus.st_size);
+                isMapped = true;
+            }
+        }
+        // the mapping stays valid after the descriptor is closed
+        close(fileDescriptor);
+        if (isMapped) {
+            isOpened = true;
+            return;
+        }
+    }
+#endif
+    // fall back to reading the whole file (e.g. empty files, pipes, Windows)
+    std::ifstream fileStream(path);
+    if (fileStream) {
+        buffer = String((std::istreambuf_iterator<char>(fileStream)), std::istreambuf_iterator<char>());
+        contents = buffer.data();
+        length = buffer.size();
+        isOpened = true;
+    }
+}
+
+SourceFile::~SourceFile()
+{
+#ifndef _WIN32
+    if (isMapped) {
+        // NOLINTNEXTLINE
+        munmap(const_cast<char*>(contents), length);
+    }
+#endif
+}
+
+Boolean SourceFile::isOpen() const
+{
+    return isOpened;
+}
+
+const char* SourceFile::data() const
+{
+    return contents;
+}
+
+size_t SourceFile::size() const
+{
+    return length;
+}
@@ -0,0 +1,47 @@
+/**
+ * A read-only view of a SIMPLE source file on disk. Where
+ * the platform supports it, the file is memory-mapped, so that
+ * the program text is paged in on demand instead of being
+ * copied into a String.
+ */
+
+#ifndef SPA_FRONTEND_SOURCE_FILE_H
+#define SPA_FRONTEND_SOURCE_FILE_H
+
+#include "Types.h"
+
+class SourceFile {
+public:
+    /**
+     * Opens and maps the file at the given path. If the file
+     * cannot be opened, isOpen() will return false.
+     *
+     * @param path Path to the source file.
+     */
+    explicit SourceFile(const String& path);
+    ~SourceFile();
+    SourceFile(const SourceFile&) = delete;
+    SourceFile& operator=(const SourceFile&) = delete;
+    SourceFile(SourceFile&&) = delete;
+    SourceFile& operator=(SourceFile&&) = delete;
+
+    Boolean isOpen() const;
+
+    /**
+     * Returns a pointer to the contents of the file. The
+     * contents are not null-terminated, use size() to
+     * find the end of the file.
+     */
+    const char* data() const;
+    size_t size() const;
+
+private:
+    const char* contents;
+    size_t length;
+    Boolean isOpened;
+    Boolean isMapped;
+    // fallback buffer, used when the file cannot be memory-mapped
+    String buffer;
+};
+
+#endif // SPA_FRONTEND_SOURCE_FILE_H
@@ -0,0 +1,192 @@
+/**
+ * Implementation of the buffer for relationships
+ * found by the design extractor.
+ */
+
+#include "DesignBuffer.h"
+
+#include "pkb/PKB.h"
+
+// buffer that relationships are added to, on this thread
+static thread_local DesignBuffer* activeBuffer = nullptr;
+
+Void DesignBuffer::addFollows(Integer before, StatementType beforeType, Integer after, StatementType afterType)
+{
+    follows.emplace_back(before, beforeType, after, afterType);
+}
+
+Void DesignBuffer::addFollowsStar(Integer before, StatementType beforeType,
+                                  const Vector<StatementNumWithType>& afterList)
+{
+    followsStar.emplace_back(before, beforeType, afterList);
+}
+
+Void DesignBuffer::addParent(Integer parent, StatementType parentType, Integer child, StatementType childType)
+{
+    parents.emplace_back(parent, parentType, child, childType);
+}
+
+Void DesignBuffer::addParentStar(Integer parent, StatementType parentType,
+                                 const Vector<StatementNumWithType>& childList)
+{
+    parentsStar.emplace_back(parent, parentType, childList);
+}
+
+Void DesignBuffer::addUses(Integer stmtNum, StatementType stmtType, const Vector<String>& varNames)
+{
+    statementUses.emplace_back(stmtNum, stmtType, varNames);
+}
+
+Void DesignBuffer::addUses(const String& procName, const Vector<String>& varNames)
+{
+    procedureUses.emplace_back(procName, varNames);
+}
+
+Void DesignBuffer::addModifies(Integer stmtNum, StatementType stmtType, const Vector<String>& varNames)
+{
+    statementModifies.emplace_back(stmtNum, stmtType, varNames);
+}
+
+Void DesignBuffer::addModifies(const String& procName, const Vector<String>& varNames)
+{
+    procedureModifies.emplace_back(procName, varNames);
+}
+
+Void DesignBuffer::addNext(StatementNumber prev, StatementType prevType, StatementNumber next,
+                           StatementType nextType)
+{
+    nexts.emplace_back(prev, prevType, next, nextType);
+}
+
+Void DesignBuffer::storeInPkb() const
+{
+    for (const StatementPair& relationship : follows) {
+        addFollowsRelationships(std::get<0>(relationship), std::get<1>(relationship), std::get<2>(relationship),
+                                std::get<3>(relationship));
+    }
+    for (const StatementWithList& relationship : followsStar) {
+        addFollowsRelationshipsStar(std::get<0>(relationship), std::get<1>(relationship), std::get<2>(relationship));
+    }
+    for (const StatementPair& relationship : parents) {
+        addParentRelationships(std::get<0>(relationship), std::get<1>(relationship), std::get<2>(relationship),
+                               std::get<3>(relationship));
+    }
+    for (const StatementWithList& relationship : parentsStar) {
+        addParentRelationshipsStar(std::get<0>(relationship), std::get<1>(relationship), std::get<2>(relationship));
+    }
+    for (const StatementVariables& relationship : statementUses) {
+        addUsesRelationships(std::get<0>(relationship), std::get<1>(relationship), std::get<2>(relationship));
+    }
+    for (const ProcedureVariables& relationship : procedureUses) {
+        addUsesRelationships(relationship.first, relationship.second);
+    }
+    for (const StatementVariables& relationship : statementModifies) {
+        addModifiesRelationships(std::get<0>(relationship), std::get<1>(relationship), std::get<2>(relationship));
+    }
+    for (const ProcedureVariables& relationship : procedureModifies) {
+        addModifiesRelationships(relationship.first, relationship.second);
+    }
+    for (const StatementPair& relationship : nexts) {
+        addNextRelationships(std::get<0>(relationship), std::get<1>(relationship), std::get<2>(relationship),
+                             std::get<3>(relationship));
+    }
+}
+
+DesignBuffer* DesignBuffer::getActiveBuffer()
+{
+    return activeBuffer;
+}
+
+DesignBuffer::Scope::Scope(DesignBuffer* buffer): previousBuffer(activeBuffer)
+{
+    activeBuffer = buffer;
+}
+
+DesignBuffer::Scope::~Scope()
+{
+    activeBuffer = previousBuffer;
+}
+
+Void bufferFollowsRelationships(Integer before, StatementType beforeType, Integer after, StatementType afterType)
+{
+    if (activeBuffer == nullptr) {
+        addFollowsRelationships(before, beforeType, after, afterType);
+    } else {
+        activeBuffer->addFollows(before, beforeType, after, afterType);
+    }
+}
+
+Void bufferFollowsRelationshipsStar(Integer before, StatementType beforeType,
+                                    const Vector<StatementNumWithType>& afterList)
+{
+    if (activeBuffer == nullptr) {
+        addFollowsRelationshipsStar(before, beforeType, afterList);
+    } else {
+        activeBuffer->addFollowsStar(before, beforeType, afterList);
+    }
+}
+
+Void bufferParentRelationships(Integer parent, StatementType parentType, Integer child, StatementType childType)
+{
+    if (activeBuffer == nullptr) {
+        addParentRelationships(parent, parentType, child, childType);
+    } else {
+        activeBuffer->addParent(parent, parentType, child, childType);
+    }
+}
+
+Void bufferParentRelationshipsStar(Integer parent, StatementType parentType,
+                                   const Vector<StatementNumWithType>& childList)
+{
+    if (activeBuffer == nullptr) {
+        addParentRelationshipsStar(parent, parentType, childList);
+    } else {
+        activeBuffer->addParentStar(parent, parentType, childList);
+    }
+}
+
+Void bufferUsesRelationships(Integer stmtNum, StatementType stmtType, const Vector<String>& varNames)
+{
+    if (activeBuffer == nullptr) {
+        addUsesRelationships(stmtNum, stmtType, varNames);
+    } else {
+        activeBuffer->addUses(stmtNum, stmtType, varNames);
+    }
+}
+
+Void bufferUsesRelationships(const String& procName, const Vector<String>& varNames)
+{
+    if (activeBuffer == nullptr) {
+        addUsesRelationships(procName, varNames);
+    } else {
+        activeBuffer->addUses(procName, varNames);
+    }
+}
+
+Void bufferModifiesRelationships(Integer stmtNum, StatementType stmtType, const Vector<String>& varNames)
+{
+    if (activeBuffer == nullptr) {
+        addModifiesRelationships(stmtNum, stmtType, varNames);
+    } else {
+        activeBuffer->addModifies(stmtNum, stmtType, varNames);
+    }
+}
+
+Void bufferModifiesRelationships(const String& procName, const Vector<String>& varNames)
+{
+    if (activeBuffer == nullptr) {
+        addModifiesRelationships(procName, varNames);
+    } else {
+        activeBuffer->addModifies(procName, varNames);
+    }
+}
+
+Void bufferNextRelationships(StatementNumber prev, StatementType prevType, StatementNumber next,
+                             StatementType nextType)
+{
+    if (activeBuffer == nullptr) {
+        addNextRelationships(prev, prevType, next, nextType);
+    } else {
+        activeBuffer->addNext(prev, prevType, next, nextType);
+    }
+}
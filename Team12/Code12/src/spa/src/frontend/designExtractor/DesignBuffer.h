@@ -0,0 +1,102 @@
+/**
+ * Buffer for the relationships found by the design
+ * extractor, before they are stored in the PKB.
+ */
+
+#ifndef SPA_FRONTEND_DESIGN_BUFFER_H
+#define SPA_FRONTEND_DESIGN_BUFFER_H
+
+#include <tuple>
+
+#include "Types.h"
+#include "ast/AstTypes.h"
+#include "pkb/PkbTypes.h"
+
+/**
+ * As the PKB is not thread-safe, extractors that run on several
+ * threads at once add their relationships to a DesignBuffer of
+ * their own instead. The buffers are stored in the PKB afterwards,
+ * one at a time, so that the relationships are stored in the same
+ * order no matter how the threads were scheduled.
+ *
+ * Extractors do not take the buffer as an argument. Instead, each
+ * thread has an active buffer, set by a DesignBuffer::Scope, and
+ * relationships are stored in the PKB directly if there is none.
+ */
+class DesignBuffer {
+public:
+    DesignBuffer() = default;
+
+    Void addFollows(Integer before, StatementType beforeType, Integer after, StatementType afterType);
+    Void addFollowsStar(Integer before, StatementType beforeType, const Vector<StatementNumWithType>& afterList);
+    Void addParent(Integer parent, StatementType parentType, Integer child, StatementType childType);
+    Void addParentStar(Integer parent, StatementType parentType, const Vector<StatementNumWithType>& childList);
+    Void addUses(Integer stmtNum, StatementType stmtType, const Vector<String>& varNames);
+    Void addUses(const String& procName, const Vector<String>& varNames);
+    Void addModifies(Integer stmtNum, StatementType stmtType, const Vector<String>& varNames);
+    Void addModifies(const String& procName, const Vector<String>& varNames);
+    Void addNext(StatementNumber prev, StatementType prevType, StatementNumber next, StatementType nextType);
+
+    /**
+     * Stores the relationships in the buffer in the PKB. Relationships
+     * of each kind are stored in the order they were added.
+     */
+    Void storeInPkb() const;
+
+    // Gets the buffer that relationships are added to on the
+    // current thread, or nullptr if they are stored directly.
+    static DesignBuffer* getActiveBuffer();
+
+    /**
+     * Adds relationships found on the current thread to a buffer,
+     * for as long as the Scope is alive.
+     */
+    class Scope {
+    public:
+        explicit Scope(DesignBuffer* buffer);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        Scope(Scope&&) = delete;
+        Scope& operator=(Scope&&) = delete;
+
+    private:
+        DesignBuffer* previousBuffer;
+    };
+
+private:
+    typedef std::tuple<Integer, StatementType, Integer, StatementType> StatementPair;
+    typedef std::tuple<Integer, StatementType, Vector<StatementNumWithType>> StatementWithList;
+    typedef std::tuple<Integer, StatementType, Vector<String>> StatementVariables;
+    typedef Pair<String, Vector<String>> ProcedureVariables;
+
+    Vector<StatementPair> follows;
+    Vector<StatementWithList> followsStar;
+    Vector<StatementPair> parents;
+    Vector<StatementWithList> parentsStar;
+    Vector<StatementVariables> statementUses;
+    Vector<ProcedureVariables> procedureUses;
+    Vector<StatementVariables> statementModifies;
+    Vector<ProcedureVariables> procedureModifies;
+    Vector<StatementPair> nexts;
+};
+
+/*
+ * Adds a relationship to the active buffer of the current
+ * thread, or stores it in the PKB if there is no active buffer.
+ * These take the same arguments as the PKB API.
+ */
+Void bufferFollowsRelationships(Integer before, StatementType beforeType, Integer after, StatementType afterType);
+Void bufferFollowsRelationshipsStar(Integer before, StatementType beforeType,
+                                    const Vector<StatementNumWithType>& afterList);
+Void bufferParentRelationships(Integer parent, StatementType parentType, Integer child, StatementType childType);
+Void bufferParentRelationshipsStar(Integer parent, StatementType parentType,
+                                   const Vector<StatementNumWithType>& childList);
+Void bufferUsesRelationships(Integer stmtNum, StatementType stmtType, const Vector<String>& varNames);
+Void bufferUsesRelationships(const String& procName, const Vector<String>& varNames);
+Void bufferModifiesRelationships(Integer stmtNum, StatementType stmtType, const Vector<String>& varNames);
+Void bufferModifiesRelationships(const String& procName, const Vector<String>& varNames);
+Void bufferNextRelationships(StatementNumber prev, StatementType prevType, StatementNumber next,
+                             StatementType nextType);
+
+#endif // SPA_FRONTEND_DESIGN_BUFFER_H
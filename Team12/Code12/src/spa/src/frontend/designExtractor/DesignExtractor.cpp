@@ -1,13 +1,18 @@
 /**
  * Implementation of SPA frontend design extractor.
  */
+#include "DesignExtractor.h"
+
+#include <algorithm>
+#include <unordered_map>
 #include <iostream>
 #include <utility>
 
-#include "../src/cfg/CfgBipBuilder.h"
 #include "../src/cfg/CfgBuilder.h"
 #include "./pkb/PKB.h"
 #include "CallsExtractor.h"
+#include "DesignBuffer.h"
+#include "ExtractionScheduler.h"
 #include "FollowsExtractor.h"
 #include "ModifiesExtractor.h"
 #include "ParentExtractor.h"
@@ -15,64 +20,157 @@
 #include "UsesExtractor.h"
 #include "next/NextExtractor.h"
 
-Void storeCurrentCfg(CfgNode* cfgRootNode, const Name& procName, std::unordered_map<Name, CfgNode*>* proceduresCfg)
+/**
+ * Groups the procedures of a program into waves by the height of
+ * each procedure in the Calls graph, so that the procedures in a
+ * wave only call procedures in earlier waves, and can be extracted
+ * at the same time. Within a wave, procedures are in call order.
+ *
+ * @param callOrder Procedure indexes in reverse topological order.
+ * @param adjacencyMatrixOfCalls The Calls graph of the program.
+ * @return Lists of procedure indexes, one for each wave.
+ */
+Vector<Vector<size_t>> groupProceduresByCallHeight(const std::vector<int>& callOrder,
+                                                   const Matrix& adjacencyMatrixOfCalls)
 {
-    storeCFG(cfgRootNode, procName);
-
-    proceduresCfg->insert({procName, cfgRootNode});
+    size_t numberOfProcedures = adjacencyMatrixOfCalls.size();
+    Vector<size_t> heights(numberOfProcedures, 0);
+    Vector<Vector<size_t>> waves;
+    for (int procIndex : callOrder) {
+        size_t height = 0;
+        for (size_t calledIndex = 0; calledIndex < numberOfProcedures; calledIndex++) {
+            if (adjacencyMatrixOfCalls.at(procIndex).at(calledIndex)) {
+                // called procedures come earlier in the call order
+                height = std::max(height, heights.at(calledIndex) + 1);
+            }
+        }
+        heights.at(procIndex) = height;
+        if (waves.size() <= height) {
+            waves.resize(height + 1);
+        }
+        waves.at(height).push_back(static_cast<size_t>(procIndex));
+    }
+    return waves;
 }
 
 Boolean extractDesign(ProgramNode& rootNode)
 {
-    SemanticErrorsValidator seValidator(rootNode);
+    return extractDesign(rootNode, countHardwareThreads());
+}
+
+Boolean extractDesign(ProgramNode& rootNode, size_t maximumThreads)
+{
+    // allocate the CFG nodes together with the AST nodes
+    AstArena* arena = rootNode.getArena();
+    AstArena::Scope arenaScope(arena);
+
+    const List<ProcedureNode>& procedures = rootNode.procedureList;
+    size_t numberOfProcedures = procedures.size();
+    // relationships are buffered by each task, and stored in the PKB at the
+    // end in a fixed order, as the PKB cannot be used by several threads
+    Vector<DesignBuffer> structureBuffers(numberOfProcedures);
+    Vector<DesignBuffer> usesBuffers(numberOfProcedures);
+    Vector<DesignBuffer> modifiesBuffers(numberOfProcedures);
+    // what each procedure uses, modifies and calls directly, found in
+    // the same traversal as its Follows and Parent relationships
+    Vector<UsedVariablesCollector> usedVariables(numberOfProcedures);
+    Vector<ModifiedVariablesCollector> modifiedVariables(numberOfProcedures);
+    Vector<CalledProceduresCollector> calledProcedures(numberOfProcedures);
+
+    size_t numberOfThreads = countExtractionThreads(numberOfProcedures, maximumThreads);
+    // an arena can only be used by one thread at a time, so each thread
+    // allocates its CFG nodes in an arena of its own, owned by the program
+    Vector<AstArena*> threadArenas(numberOfThreads, nullptr);
+    if (arena != nullptr) {
+        for (AstArena*& threadArena : threadArenas) {
+            threadArena = arena->createChildArena();
+        }
+    }
+    Vector<std::pair<CfgNode*, size_t>> cfgs(numberOfProcedures);
+    Vector<std::unique_ptr<FlatCfg>> flatCfgs(numberOfProcedures);
+    runExtractionTasks(numberOfProcedures, numberOfThreads, [&](size_t procIndex, size_t threadIndex) {
+        AstArena::Scope threadArenaScope(threadArenas.at(threadIndex));
+        DesignBuffer::Scope bufferScope(&structureBuffers.at(procIndex));
+        const ProcedureNode& procedure = *procedures.at(procIndex);
+        // traverse the AST of the procedure once for all of the extractors
+        FollowsCollector follows;
+        ParentCollector parent;
+        traverseProcedure(procedure, {&follows, &parent, &usedVariables.at(procIndex),
+                                      &modifiedVariables.at(procIndex), &calledProcedures.at(procIndex)});
+        // Build Cfg for the procedure, and freeze it into a flat CFG
+        cfgs.at(procIndex) = buildCfg(procedure.statementListNode);
+        flatCfgs.at(procIndex) = std::unique_ptr<FlatCfg>(new FlatCfg(cfgs.at(procIndex).first));
+        // extract Next relationships from the flat CFG
+        extractNext(*flatCfgs.at(procIndex));
+    });
+
+    // nothing has been stored in the PKB yet, so an invalid program leaves it empty
+    Vector<Vector<Name>> calledProceduresByProcedure;
+    calledProceduresByProcedure.reserve(numberOfProcedures);
+    for (CalledProceduresCollector& collector : calledProcedures) {
+        calledProceduresByProcedure.push_back(std::move(collector.calledProcedures));
+    }
+    SemanticErrorsValidator seValidator(rootNode, std::move(calledProceduresByProcedure));
     Boolean isSemanticallyValid = seValidator.isProgramValid();
-    // CFG of each procedure
-    std::unordered_map<Name, CfgNode*> proceduresCfg;
-    std::unordered_map<Name, size_t> numberOfCfgNodes;
-    // Hash map to check if a Cfg is visited when building CfgBip
-    std::unordered_map<Name, Boolean> visitedProcedureCfg;
 
     if (!isSemanticallyValid) {
         // Terminate program
         return false;
-    } else {
-        extractFollows(rootNode);
-        extractParent(rootNode);
-        extractUses(rootNode, seValidator);
-        extractModifies(rootNode, seValidator);
-        extractCalls(rootNode, seValidator.adjacencyMatrixOfCalls);
-
-        // Build Cfg for each procedure  + extract Next relationships
-        const List<ProcedureNode>* procedureList = &(rootNode.procedureList);
-        for (const std::unique_ptr<ProcedureNode>& i : *procedureList) {
-            Name procName = i->procedureName;
-            const StmtlstNode* const stmtListNode = i->statementListNode;
-            std::pair<CfgNode*, size_t> cfgInfo = buildCfg(stmtListNode);
-            // Add CFG root node into PKB
-            storeCurrentCfg(cfgInfo.first, procName, &proceduresCfg);
-            numberOfCfgNodes.insert({procName, cfgInfo.second});
-
-            // Extract Next relationships
-            extractNext(cfgInfo);
+    }
 
-            // Initialise visitedProcedureCfg to keep track if a procedure
-            // has been visited when building CfgBip
-            visitedProcedureCfg.insert({procName, false});
-        }
+    // give the variables of the program indexes, so that Uses and
+    // Modifies are found as bitsets over the indexes of the variables
+    std::unordered_map<Name, size_t> procedureIndexes;
+    for (size_t procIndex = 0; procIndex < numberOfProcedures; procIndex++) {
+        procedureIndexes.insert({procedures.at(procIndex)->procedureName, procIndex});
+    }
+    VariableIds variableIds;
+    for (size_t procIndex = 0; procIndex < numberOfProcedures; procIndex++) {
+        usedVariables.at(procIndex).resolve(variableIds, procedureIndexes);
+        modifiedVariables.at(procIndex).resolve(variableIds, procedureIndexes);
+    }
 
-        // Ensure that all procedures is included in a CfgBip
-        for (const std::unique_ptr<ProcedureNode>& j : *procedureList) {
-            Name procName = j->procedureName;
-            if (!visitedProcedureCfg.at(procName)) {
-                visitedProcedureCfg.at(procName) = true;
-                CfgNode* currentCfgBipRootNode
-                    = buildCfgBip(&proceduresCfg, procName, &numberOfCfgNodes, &visitedProcedureCfg);
-                // Store root node of the CfgBip with the current procedure as the "top"
-                storeCFGBip(currentCfgBipRootNode, procName);
-                // extract NextBip relationships
-                extractNextBip(currentCfgBipRootNode, currentCfgBipRootNode->size());
+    // Uses and Modifies of a procedure need those of the procedures it calls,
+    // so procedures are extracted in waves, with the procedures called first
+    std::vector<int> callOrder = seValidator.reverseTopologicalSort();
+    Vector<AdaptiveBitset> procedureUses(numberOfProcedures);
+    Vector<AdaptiveBitset> procedureModifies(numberOfProcedures);
+    for (const Vector<size_t>& wave : groupProceduresByCallHeight(callOrder, seValidator.adjacencyMatrixOfCalls)) {
+        size_t numberOfWaveThreads = countExtractionThreads(wave.size(), maximumThreads);
+        runExtractionTasks(wave.size(), numberOfWaveThreads, [&](size_t taskIndex, size_t) {
+            size_t procIndex = wave.at(taskIndex);
+            const ProcedureNode& procedure = *procedures.at(procIndex);
+            {
+                DesignBuffer::Scope usesScope(&usesBuffers.at(procIndex));
+                extractUsesFromProcedure(procedure, procIndex, usedVariables.at(procIndex), variableIds,
+                                         procedureUses);
             }
-        }
-        return true;
+            DesignBuffer::Scope modifiesScope(&modifiesBuffers.at(procIndex));
+            extractModifiesFromProcedure(procedure, procIndex, modifiedVariables.at(procIndex), variableIds,
+                                         procedureModifies);
+        });
+    }
+
+    // store the relationships in the same order as extracting them one by one
+    for (int procIndex : callOrder) {
+        usesBuffers.at(procIndex).storeInPkb();
     }
+    for (int procIndex : callOrder) {
+        modifiesBuffers.at(procIndex).storeInPkb();
+    }
+    extractCalls(rootNode, seValidator.adjacencyMatrixOfCalls);
+    for (size_t procIndex = 0; procIndex < numberOfProcedures; procIndex++) {
+        const Name& procName = procedures.at(procIndex)->procedureName;
+        // Add CFG root node and flat CFG into PKB
+        storeCFG(cfgs.at(procIndex).first, procName);
+        storeFlatCFG(std::move(flatCfgs.at(procIndex)), procName);
+        // Follows, Parent and Next relationships of the procedure
+        structureBuffers.at(procIndex).storeInPkb();
+    }
+
+    // Link the flat CFGs of all procedures into the CFG BIP,
+    // and extract NextBip relationships from the CFG BIP
+    storeCFGBip();
+    extractNextBip(*getCFGBip());
+    return true;
 }
@@ -24,4 +24,17 @@
  */
 Boolean extractDesign(ProgramNode& rootNode);
 
+/**
+ * Attempts to extract relationships from an Abstract
+ * Syntax Tree like extractDesign, but on at most the
+ * given number of threads, even if there are fewer
+ * hardware threads.
+ *
+ * @param rootNode Root node of the AST.
+ * @param maximumThreads Maximum number of threads to use.
+ * @return True, if the extraction is successful.
+ *         Otherwise, false.
+ */
+Boolean extractDesign(ProgramNode& rootNode, size_t maximumThreads);
+
 #endif // SPA_FRONTEND_DESIGN_EXTRACTOR_H
@@ -0,0 +1,142 @@
+/**
+ * Implementation of the single-pass traversal
+ * of procedures for the design extractors.
+ */
+
+#include "DesignTraversal.h"
+
+#include <stdexcept>
+
+Void DesignSink::visitStatementList(const StmtlstNode&, const StatementNode*) {}
+
+Void DesignSink::visitUsedVariable(const StatementNode&, const Name&) {}
+
+Void DesignSink::visitModifiedVariable(const StatementNode&, const Name&) {}
+
+Void DesignSink::visitCall(const CallStatementNode&) {}
+
+Void DesignSink::visitProcedureEnd(const ProcedureNode&) {}
+
+Void traverseExpression(const StatementNode& statement, const Expression* expr, const Vector<DesignSink*>& sinks)
+{
+    if (expr->isArithmetic()) {
+        // NOLINTNEXTLINE
+        const auto* arithExp = static_cast<const ArithmeticExpression*>(expr);
+        traverseExpression(statement, arithExp->leftFactor, sinks);
+        traverseExpression(statement, arithExp->rightFactor, sinks);
+        return;
+    }
+    // NOLINTNEXTLINE
+    const BasicDataType* data = static_cast<const ReferenceExpression*>(expr)->basicData;
+    if (!data->isConstant()) {
+        // NOLINTNEXTLINE
+        const Name& variable = static_cast<const Variable*>(data)->varName;
+        for (DesignSink* sink : sinks) {
+            sink->visitUsedVariable(statement, variable);
+        }
+    }
+}
+
+Void traverseConditionalExpression(const StatementNode& statement, const ConditionalExpression* cond,
+                                   const Vector<DesignSink*>& sinks)
+{
+    switch (cond->getConditionalType()) {
+    case NotConditionalExpression:
+        // NOLINTNEXTLINE
+        traverseConditionalExpression(statement, static_cast<const NotExpression*>(cond)->expression, sinks);
+        break;
+    case AndConditionalExpression: {
+        // NOLINTNEXTLINE
+        const auto* andExpr = static_cast<const AndExpression*>(cond);
+        traverseConditionalExpression(statement, andExpr->leftExpression, sinks);
+        traverseConditionalExpression(statement, andExpr->rightExpression, sinks);
+        break;
+    }
+    case OrConditionalExpression: {
+        // NOLINTNEXTLINE
+        const auto* orExpr = static_cast<const OrExpression*>(cond);
+        traverseConditionalExpression(statement, orExpr->leftExpression, sinks);
+        traverseConditionalExpression(statement, orExpr->rightExpression, sinks);
+        break;
+    }
+    case RelationalConditionalExpression: {
+        // NOLINTNEXTLINE
+        const auto* relExpr = static_cast<const RelationalExpression*>(cond);
+        traverseExpression(statement, relExpr->leftFactor, sinks);
+        traverseExpression(statement, relExpr->rightFactor, sinks);
+        break;
+    }
+    default:
+        throw std::runtime_error("Unknown expression type in DesignTraversal traverseConditionalExpression");
+    }
+}
+
+Void traverseStatementList(const StmtlstNode& stmtLstNode, const StatementNode* container,
+                           const Vector<DesignSink*>& sinks)
+{
+    for (DesignSink* sink : sinks) {
+        sink->visitStatementList(stmtLstNode, container);
+    }
+    for (const std::unique_ptr<StatementNode>& statement : stmtLstNode.statementList) {
+        switch (statement->getStatementType()) {
+        case AssignmentStatement: {
+            // NOLINTNEXTLINE
+            const auto* assign = static_cast<const AssignmentStatementNode*>(statement.get());
+            for (DesignSink* sink : sinks) {
+                sink->visitModifiedVariable(*assign, assign->variable.varName);
+            }
+            traverseExpression(*assign, assign->expression, sinks);
+            break;
+        }
+        case CallStatement: {
+            // NOLINTNEXTLINE
+            const auto* call = static_cast<const CallStatementNode*>(statement.get());
+            for (DesignSink* sink : sinks) {
+                sink->visitCall(*call);
+            }
+            break;
+        }
+        case IfStatement: {
+            // NOLINTNEXTLINE
+            const auto* ifStatement = static_cast<const IfStatementNode*>(statement.get());
+            traverseConditionalExpression(*ifStatement, ifStatement->predicate, sinks);
+            traverseStatementList(*ifStatement->ifStatementList, ifStatement, sinks);
+            traverseStatementList(*ifStatement->elseStatementList, ifStatement, sinks);
+            break;
+        }
+        case PrintStatement: {
+            // NOLINTNEXTLINE
+            const auto* print = static_cast<const PrintStatementNode*>(statement.get());
+            for (DesignSink* sink : sinks) {
+                sink->visitUsedVariable(*print, print->var.varName);
+            }
+            break;
+        }
+        case ReadStatement: {
+            // NOLINTNEXTLINE
+            const auto* read = static_cast<const ReadStatementNode*>(statement.get());
+            for (DesignSink* sink : sinks) {
+                sink->visitModifiedVariable(*read, read->var.varName);
+            }
+            break;
+        }
+        case WhileStatement: {
+            // NOLINTNEXTLINE
+            const auto* whileStatement = static_cast<const WhileStatementNode*>(statement.get());
+            traverseConditionalExpression(*whileStatement, whileStatement->predicate, sinks);
+            traverseStatementList(*whileStatement->statementList, whileStatement, sinks);
+            break;
+        }
+        default:
+            throw std::runtime_error("Unknown statement type in DesignTraversal traverseStatementList");
+        }
+    }
+}
+
+Void traverseProcedure(const ProcedureNode& procedureNode, const Vector<DesignSink*>& sinks)
+{
+    traverseStatementList(*procedureNode.statementListNode, nullptr, sinks);
+    for (DesignSink* sink : sinks) {
+        sink->visitProcedureEnd(procedureNode);
+    }
+}
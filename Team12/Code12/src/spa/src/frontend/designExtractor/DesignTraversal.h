@@ -0,0 +1,67 @@
+/**
+ * Traversal of the Abstract Syntax Tree of a procedure,
+ * which passes each part of the procedure to all of the
+ * design extractors in a single pass.
+ */
+
+#ifndef SPA_FRONTEND_DESIGN_TRAVERSAL_H
+#define SPA_FRONTEND_DESIGN_TRAVERSAL_H
+
+#include "ast/AstTypes.h"
+
+/**
+ * A design extractor that is given the parts of a procedure as
+ * the procedure is traversed, instead of traversing the AST by
+ * itself. Each visit does nothing by default, so an extractor
+ * only overrides the visits that it needs.
+ *
+ * Statements are visited in the order of their statement
+ * numbers, with each container statement visited before
+ * the statements nested in it.
+ */
+class DesignSink {
+public:
+    DesignSink() = default;
+    DesignSink(const DesignSink&) = default;
+    DesignSink(DesignSink&&) = default;
+    virtual ~DesignSink() = default;
+    DesignSink& operator=(const DesignSink&) = default;
+    DesignSink& operator=(DesignSink&&) = default;
+
+    /**
+     * Visits a statement list, before any of the statements in it.
+     *
+     * @param stmtLstNode The statement list.
+     * @param container The if or while statement that the statement
+     *                  list is nested in, or nullptr if the statement
+     *                  list is the body of the procedure.
+     */
+    virtual Void visitStatementList(const StmtlstNode& stmtLstNode, const StatementNode* container);
+
+    /**
+     * Visits a variable used directly by a statement, in its expression,
+     * or in its condition for a container statement. A variable is
+     * visited once for each time it appears in the statement.
+     */
+    virtual Void visitUsedVariable(const StatementNode& statement, const Name& variable);
+
+    // Visits the variable modified by an assignment or read statement.
+    virtual Void visitModifiedVariable(const StatementNode& statement, const Name& variable);
+
+    // Visits a call statement.
+    virtual Void visitCall(const CallStatementNode& call);
+
+    // Visits the end of a procedure, after all of its statements.
+    virtual Void visitProcedureEnd(const ProcedureNode& procedureNode);
+};
+
+/**
+ * Traverses the AST of a procedure once, passing each part
+ * of it to every sink, in the order that the sinks are given.
+ *
+ * @param procedureNode The procedure to traverse.
+ * @param sinks The design extractors to pass the procedure to.
+ */
+Void traverseProcedure(const ProcedureNode& procedureNode, const Vector<DesignSink*>& sinks);
+
+#endif // SPA_FRONTEND_DESIGN_TRAVERSAL_H
@@ -0,0 +1,72 @@
+/**
+ * Implementation of the scheduler for the
+ * tasks of the design extractor.
+ */
+
+#include "ExtractionScheduler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+size_t countHardwareThreads()
+{
+    // hardware_concurrency may return 0 if it cannot be determined
+    return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+size_t countExtractionThreads(size_t numberOfTasks)
+{
+    return countExtractionThreads(numberOfTasks, countHardwareThreads());
+}
+
+size_t countExtractionThreads(size_t numberOfTasks, size_t maximumThreads)
+{
+    return std::max(std::min(maximumThreads, numberOfTasks), static_cast<size_t>(1));
+}
+
+Void runExtractionTasks(size_t numberOfTasks, size_t numberOfThreads, const ExtractionTask& task)
+{
+    if (numberOfThreads <= 1) {
+        for (size_t taskIndex = 0; taskIndex < numberOfTasks; taskIndex++) {
+            task(taskIndex, 0);
+        }
+        return;
+    }
+
+    std::atomic<size_t> nextTask(0);
+    std::atomic<Boolean> hasFailed(false);
+    std::exception_ptr firstException;
+    std::mutex exceptionMutex;
+    auto runTasksOnThread = [&](size_t threadIndex) {
+        size_t taskIndex = nextTask++;
+        while (taskIndex < numberOfTasks && !hasFailed) {
+            try {
+                task(taskIndex, threadIndex);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(exceptionMutex);
+                if (!hasFailed) {
+                    firstException = std::current_exception();
+                    hasFailed = true;
+                }
+            }
+            taskIndex = nextTask++;
+        }
+    };
+
+    Vector<std::thread> threads;
+    threads.reserve(numberOfThreads - 1);
+    for (size_t threadIndex = 1; threadIndex < numberOfThreads; threadIndex++) {
+        threads.emplace_back(runTasksOnThread, threadIndex);
+    }
+    // the current thread takes tasks as well, as thread 0
+    runTasksOnThread(0);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    if (firstException) {
+        std::rethrow_exception(firstException);
+    }
+}
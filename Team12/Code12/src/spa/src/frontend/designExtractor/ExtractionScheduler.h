@@ -0,0 +1,66 @@
+/**
+ * Runs the tasks of the design extractor on several
+ * threads, for parts of the program that can be
+ * extracted independently of each other.
+ */
+
+#ifndef SPA_FRONTEND_EXTRACTION_SCHEDULER_H
+#define SPA_FRONTEND_EXTRACTION_SCHEDULER_H
+
+#include <functional>
+
+#include "Types.h"
+
+/**
+ * A task of the design extractor, given the index of the task
+ * and the index of the thread that it is run on. Tasks run on
+ * the same thread never run at the same time, so they may share
+ * anything that is kept for that thread, like an arena.
+ */
+typedef std::function<Void(size_t taskIndex, size_t threadIndex)> ExtractionTask;
+
+/**
+ * Gets the number of hardware threads.
+ *
+ * @return Number of hardware threads, which is at least 1.
+ */
+size_t countHardwareThreads();
+
+/**
+ * Gets the number of threads to run a number of tasks on,
+ * which is at most the number of hardware threads.
+ *
+ * @param numberOfTasks Number of tasks to run.
+ * @return Number of threads, which is at least 1.
+ */
+size_t countExtractionThreads(size_t numberOfTasks);
+
+/**
+ * Gets the number of threads to run a number of tasks on,
+ * which is at most the given maximum, even if there are
+ * fewer hardware threads.
+ *
+ * @param numberOfTasks Number of tasks to run.
+ * @param maximumThreads Maximum number of threads to use.
+ * @return Number of threads, which is at least 1.
+ */
+size_t countExtractionThreads(size_t numberOfTasks, size_t maximumThreads);
+
+/**
+ * Runs a number of tasks on several threads, and waits for all of
+ * them to finish. Each thread takes the next task that has not
+ * been started, so tasks may finish in any order. If there is only
+ * one thread, the tasks are run in order on the current thread.
+ *
+ * If a task throws an exception, the tasks that have not been
+ * started are skipped, and the first exception thrown is
+ * rethrown on the current thread.
+ *
+ * @param numberOfTasks Number of tasks to run, indexed from 0.
+ * @param numberOfThreads Number of threads to run the tasks on,
+ *                        as given by countExtractionThreads.
+ * @param task The task to run for each index.
+ */
+Void runExtractionTasks(size_t numberOfTasks, size_t numberOfThreads, const ExtractionTask& task);
+
+#endif // SPA_FRONTEND_EXTRACTION_SCHEDULER_H
@@ -7,12 +7,16 @@
 
 #include <ast/AstTypes.h>
 
+#include "DesignTraversal.h"
+
 /**
- * Stores Follows information in the PKB.
- *
- * @param rootNode Root node of the AST.
- * @return Void.
+ * Stores the Follows and Follows* relationships of the
+ * statement lists visited in the PKB, through the active
+ * DesignBuffer if there is one.
  */
-Void extractFollows(const ProgramNode& rootNode);
+class FollowsCollector: public DesignSink {
+public:
+    Void visitStatementList(const StmtlstNode& stmtLstNode, const StatementNode* container) override;
+};
 
 #endif // SPA_FRONTEND_FOLLOWS_EXTRACTOR_H
@@ -3,117 +3,30 @@
  */
 #include "ModifiesExtractor.h"
 
-#include <stdexcept>
-#include <unordered_set>
+#include <utility>
 
-#include "pkb/PKB.h"
+#include "DesignBuffer.h"
 
-typedef std::string ProcedureName;
-/**
- * VariablesVector represents a set of variables,
- * possibly modified by a certain part of the program.
- */
-typedef std::unordered_set<std::string> VariablesSet;
-/**
- * A map of ProcedureName to a list of variables modified by
- * that procedure, in order to find Modifies for call statements.
- */
-typedef std::unordered_map<ProcedureName, VariablesSet> ProcedureModifiesMap;
-
-Void storeModifiesVariablesInPkb(StatementNumber stmt, StatementType type, const VariablesSet& variables)
-{
-    addModifiesRelationships(stmt, type, std::vector<std::string>(variables.begin(), variables.end()));
-}
-
-Void storeModifiesVariablesInPkb(const ProcedureName& proc, const VariablesSet& variables)
-{
-    addModifiesRelationships(proc, std::vector<std::string>(variables.begin(), variables.end()));
-}
-
-/**
- * Helper method to join two std::vectors. Note
- * that order of the elements is not preserved, but
- * output is guaranteed to hold unique elements.
- *
- * @param v1 The first VariableVector.
- * @param v2 The second VariableVector.
- * @return A VariableVector containing unique
- *         elements from both v1 and v2.
- */
-VariablesSet concatenateVectors(const VariablesSet& v1, const VariablesSet& v2)
-{
-    VariablesSet uniqueSet;
-    uniqueSet.reserve(v1.size() + v2.size());
-    for (const std::string& var1 : v1) {
-        uniqueSet.insert(var1);
-    }
-    for (const std::string& var2 : v2) {
-        uniqueSet.insert(var2);
-    }
-    return uniqueSet;
-}
-
-/**
- * Returns all the variables modified in the statement list
- */
-VariablesSet extractModifiesStmtlst(const StmtlstNode* stmtLstNode, ProcedureModifiesMap* procedureModifies)
+Void extractModifiesFromProcedure(const ProcedureNode& procedureNode, size_t procedureIndex,
+                                  const ModifiedVariablesCollector& collector, const VariableIds& variableIds,
+                                  Vector<AdaptiveBitset>& procedureModifies)
 {
-    size_t numberOfStatements = stmtLstNode->statementList.size();
-    VariablesSet allVariablesModified;
-    for (size_t i = 0; i < numberOfStatements; i++) {
-        const std::unique_ptr<StatementNode>& currentStatement = stmtLstNode->statementList.at(i);
-        VariablesSet modifiedInStatement;
-        StatementType currentStatementType = currentStatement->getStatementType();
-        switch (currentStatementType) {
-        case AssignmentStatement: {
-            // NOLINTNEXTLINE
-            const auto* assign = static_cast<const AssignmentStatementNode*>(currentStatement.get());
-            modifiedInStatement.insert(assign->variable.varName);
-            break;
-        }
-        case CallStatement: {
-            // NOLINTNEXTLINE
-            const auto* call = static_cast<const CallStatementNode*>(currentStatement.get());
-            modifiedInStatement = procedureModifies->at(call->procedureName);
-            break;
-        }
-        case IfStatement: {
-            // NOLINTNEXTLINE
-            const auto* ifStatement = static_cast<const IfStatementNode*>(currentStatement.get());
-            VariablesSet modifiedInIf = extractModifiesStmtlst(ifStatement->ifStatementList, procedureModifies);
-            VariablesSet modifiedInElse = extractModifiesStmtlst(ifStatement->elseStatementList, procedureModifies);
-            modifiedInStatement = concatenateVectors(modifiedInIf, modifiedInElse);
-            break;
-        }
-        case PrintStatement: {
-            // PrintStatement does not modify any variables
-            // do nothing
-            break;
-        }
-        case ReadStatement: {
-            // NOLINTNEXTLINE
-            modifiedInStatement.insert(static_cast<const ReadStatementNode*>(currentStatement.get())->var.varName);
-            break;
-        }
-        case WhileStatement: {
-            // NOLINTNEXTLINE
-            const auto* whileStatement = static_cast<const WhileStatementNode*>(currentStatement.get());
-            VariablesSet modifiedInWhileList = extractModifiesStmtlst(whileStatement->statementList, procedureModifies);
-            modifiedInStatement = modifiedInWhileList;
-            break;
-        }
-        default:
-            throw std::runtime_error("Unknown statement type in ModifiesExtractor extractModifiesStmtlst");
+    Vector<Pair<const StatementNode*, AdaptiveBitset>> statementVariables;
+    AdaptiveBitset variablesModifiedInCurrentProcedure
+        = collector.findVariables(procedureModifies, variableIds, statementVariables);
+    // update PKB
+    for (const Pair<const StatementNode*, AdaptiveBitset>& statement : statementVariables) {
+        if (statement.second.any()) {
+            bufferModifiesRelationships(statement.first->getStatementNumber(), statement.first->getStatementType(),
+                                        variableIds.getNames(statement.second));
         }
-        // update PKB
-        if (!modifiedInStatement.empty()) {
-            storeModifiesVariablesInPkb(currentStatement->getStatementNumber(), currentStatementType,
-                                        modifiedInStatement);
-        }
-        // associate variables with the statement list as well
-        allVariablesModified = concatenateVectors(allVariablesModified, modifiedInStatement);
     }
-    return allVariablesModified;
+    if (variablesModifiedInCurrentProcedure.any()) {
+        bufferModifiesRelationships(procedureNode.procedureName,
+                                    variableIds.getNames(variablesModifiedInCurrentProcedure));
+    }
+    // store the variables of the procedure, for Call statements in other procedures
+    procedureModifies.at(procedureIndex) = std::move(variablesModifiedInCurrentProcedure);
 }
 
 /**
@@ -125,35 +38,35 @@ VariablesSet extractModifiesStmtlst(const StmtlstNode* stmtLstNode, ProcedureMod
  * @param callOrder The order to run the extractor. Procedures
  *                  that call other procedures have to be
  *                  run last to populate the procedure modifies
- *                  map. If not, the correct Modifies relationships
+ *                  summaries. If not, the correct Modifies relationships
  *                  cannot be determined for Call statements.
  * @return Map of procedure names to modified variables.
  */
 ProcedureModifiesMap extractModifiesReturnMap(ProgramNode& rootNode, const std::vector<int>& callOrder)
 {
-    // set up procedureModifies map
-    ProcedureModifiesMap procedureModifies;
+    const List<ProcedureNode>& procedures = rootNode.procedureList;
+    std::unordered_map<Name, size_t> procedureIndexes;
+    for (size_t procIndex = 0; procIndex < procedures.size(); procIndex++) {
+        procedureIndexes.insert({procedures.at(procIndex)->procedureName, procIndex});
+    }
+    VariableIds variableIds;
+    Vector<ModifiedVariablesCollector> collectors(procedures.size());
+    for (size_t procIndex = 0; procIndex < procedures.size(); procIndex++) {
+        traverseProcedure(*procedures.at(procIndex), {&collectors.at(procIndex)});
+        collectors.at(procIndex).resolve(variableIds, procedureIndexes);
+    }
     // process the procedures in the sorted order
+    Vector<AdaptiveBitset> procedureModifies(procedures.size());
     for (int procIndex : callOrder) {
-        const std::unique_ptr<ProcedureNode>& currentProcedure = rootNode.procedureList.at(procIndex);
-        VariablesSet variablesModifiedInCurrentProcedure
-            = extractModifiesStmtlst(currentProcedure->statementListNode, &procedureModifies);
-        // update PKB
-        if (!variablesModifiedInCurrentProcedure.empty()) {
-            storeModifiesVariablesInPkb(currentProcedure->procedureName, variablesModifiedInCurrentProcedure);
-        }
-
-        // store Modifies relationship in hash map, for Call statements in other procedures to know
-        // which variables are modified in this procedure
-        procedureModifies.insert(std::pair<ProcedureName, VariablesSet>(currentProcedure->procedureName,
-                                                                        variablesModifiedInCurrentProcedure));
+        extractModifiesFromProcedure(*procedures.at(procIndex), procIndex, collectors.at(procIndex), variableIds,
+                                     procedureModifies);
     }
-    // return for unit testing
-    return procedureModifies;
-}
 
-Void extractModifies(ProgramNode& rootNode, SemanticErrorsValidator& sev)
-{
-    // determine order to extract Modifies with topological sort
-    extractModifiesReturnMap(rootNode, sev.reverseTopologicalSort());
+    ProcedureModifiesMap procedureModifiesMap;
+    for (size_t procIndex = 0; procIndex < procedures.size(); procIndex++) {
+        Vector<String> variables = variableIds.getNames(procedureModifies.at(procIndex));
+        procedureModifiesMap.insert(
+            {procedures.at(procIndex)->procedureName, VariablesSet(variables.begin(), variables.end())});
+    }
+    return procedureModifiesMap;
 }
@@ -5,17 +5,33 @@
 #ifndef SPA_FRONTEND_MODIFIES_EXTRACTOR_H
 #define SPA_FRONTEND_MODIFIES_EXTRACTOR_H
 
-#include "SemanticErrorsValidator.h"
+#include "VariablesCollector.h"
 #include "ast/AstTypes.h"
 
 /**
- * Stores Modifies information in the PKB.
+ * A map of ProcedureName to a list of variables modified by that procedure.
+ */
+typedef ProcedureVariablesMap ProcedureModifiesMap;
+
+/**
+ * Stores Modifies information of a single procedure in the PKB,
+ * and the variables modified by the procedure in its entry of
+ * the summaries. The procedures that it calls must already
+ * have been extracted.
+ *
+ * As only the entry of this procedure is written to, procedures
+ * that do not call each other can be extracted at the same time.
  *
- * @param rootNode Root node of the AST.
- * @param sev The SemanticErrorsValidator
- *            used by Design Extractor.
+ * @param procedureNode The procedure to extract Modifies from.
+ * @param procedureIndex The index of the procedure in the program.
+ * @param collector The variables modified by each statement of the procedure,
+ *                  collected as it was traversed, and resolved.
+ * @param variableIds The variables of the program.
+ * @param procedureModifies The variables modified by each procedure, by index.
  * @return Void.
  */
-Void extractModifies(ProgramNode& rootNode, SemanticErrorsValidator& sev);
+Void extractModifiesFromProcedure(const ProcedureNode& procedureNode, size_t procedureIndex,
+                                  const ModifiedVariablesCollector& collector, const VariableIds& variableIds,
+                                  Vector<AdaptiveBitset>& procedureModifies);
 
 #endif // SPA_FRONTEND_MODIFIES_EXTRACTOR_H
@@ -6,13 +6,28 @@
 #define SPA_FRONTEND_PARENT_EXTRACTOR_H
 
 #include <ast/AstTypes.h>
+#include <map>
+#include <unordered_map>
+
+#include "DesignTraversal.h"
+#include "pkb/PkbTypes.h"
 
 /**
- * Stores Parent information in the PKB.
- *
- * @param rootNode Root node of the AST.
- * @return Void.
+ * Stores the Parent and Parent* relationships of the statement
+ * lists visited in the PKB, through the active DesignBuffer if
+ * there is one. Parent* relationships are stored at the end of
+ * each procedure, once all nested statements have been visited.
  */
-Void extractParent(const ProgramNode& rootNode);
+class ParentCollector: public DesignSink {
+public:
+    Void visitStatementList(const StmtlstNode& stmtLstNode, const StatementNode* container) override;
+    Void visitProcedureEnd(const ProcedureNode& procedureNode) override;
+
+private:
+    // container statement of each nested statement in the current procedure
+    std::unordered_map<StatementNumber, const StatementNode*> containers;
+    // statements nested in each container statement, directly or indirectly
+    std::map<StatementNumber, Pair<StatementType, Vector<StatementNumWithType>>> nestedStatements;
+};
 
 #endif // SPA_FRONTEND_PARENT_EXTRACTOR_H
@@ -6,10 +6,21 @@
 #include "SemanticErrorsValidator.h"
 
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
+Void CalledProceduresCollector::visitCall(const CallStatementNode& call)
+{
+    calledProcedures.push_back(call.procedureName);
+}
+
 SemanticErrorsValidator::SemanticErrorsValidator(ProgramNode& progNode):
-    programNode(progNode), hasExecutedValidityChecks(false), programValidity(false)
+    SemanticErrorsValidator(progNode, collectCalledProcedures(progNode))
+{}
+
+SemanticErrorsValidator::SemanticErrorsValidator(ProgramNode& progNode, Vector<Vector<Name>> calledProcedures):
+    programNode(progNode), hasExecutedValidityChecks(false), programValidity(false),
+    calledProceduresByProcedure(std::move(calledProcedures))
 {
     // initiate adjacency matrix
     size_t length = progNode.procedureList.size();
@@ -24,6 +35,25 @@ SemanticErrorsValidator::SemanticErrorsValidator(ProgramNode& progNode):
     }
 }
 
+/**
+ * Collects the names of the procedures called by each procedure,
+ * including the call statements nested in container statements.
+ *
+ * @param progNode The program to collect the call statements of.
+ * @return Names of the procedures called by each procedure.
+ */
+Vector<Vector<Name>> SemanticErrorsValidator::collectCalledProcedures(const ProgramNode& progNode)
+{
+    Vector<Vector<Name>> calledProcedures;
+    calledProcedures.reserve(progNode.procedureList.size());
+    for (const std::unique_ptr<ProcedureNode>& procedure : progNode.procedureList) {
+        CalledProceduresCollector collector;
+        traverseProcedure(*procedure, {&collector});
+        calledProcedures.push_back(std::move(collector.calledProcedures));
+    }
+    return calledProcedures;
+}
+
 /**
  * Returns valid if the program is semantically valid.
  *
@@ -69,177 +99,22 @@ Boolean SemanticErrorsValidator::checkForAllSemanticErrors()
     // Check if call statements call existent procedures and fill up adj list
     size_t numberOfProcs = procedureList->size();
 
-    // Go through the statement list to look for call statements
-    for (size_t i = 0; i < procedureList->size(); i++) {
-        ProcedureNode& procNode = *(procedureList->at(i));
-        Name procName = procNode.procedureName;
-        int procIndex = getProcNameIndex(procedureNameSet, procName);
-        const StmtlstNode& stmtListNode = *procNode.statementListNode;
-
-        for (size_t j = 0; j < stmtListNode.statementList.size(); j++) {
-            StatementNode* stmtNode = (stmtListNode.statementList).at(j).get();
-
-            // Check if all call statements call existent procedures
-            Boolean callStatementCallsExistentProcedure
-                = checkCallStatementCallsValidProcedure(stmtNode, procedureNameSet, procIndex);
-            if (!callStatementCallsExistentProcedure) {
+    for (size_t i = 0; i < numberOfProcs; i++) {
+        for (const Name& calledProcedure : calledProceduresByProcedure.at(i)) {
+            std::unordered_map<std::string, int>::const_iterator procedureIndexPair
+                = procedureNameSet.find(calledProcedure);
+            // Check if procedure exists or procedure is recursive
+            if (procedureIndexPair == procedureNameSet.end() || procedureIndexPair->second == static_cast<int>(i)) {
                 return false;
             }
-
-            // Fill up adj list
-            populateCallGraphWithStatementNode(stmtNode, procedureNameSet, procIndex);
+            // Add call procedureName in graph
+            adjacencyMatrixOfCalls.at(i).at(procedureIndexPair->second) = true;
         }
     }
 
     return !isCyclic(numberOfProcs);
 }
 
-/**
- * Checks the call statement calls a valid procedure.
- *
- * @param stmtNode The statement node
- * @param procedureNameSet The set of procedure names
- * @param currProcNameIndex The index of the current procedure in the adjacencyMatrixOfCalls
- */
-Boolean SemanticErrorsValidator::checkCallStatementCallsValidProcedure(
-    StatementNode* stmtNode, std::unordered_map<std::string, int>& procedureNameSet, int currProcNameIndex)
-{
-    StatementType stmtType = stmtNode->getStatementType();
-    if (stmtType == CallStatement) {
-        CallStatementNode* callStmtNode = dynamic_cast<CallStatementNode*>(stmtNode);
-        Name procedureName = callStmtNode->procedureName;
-        std::unordered_map<std::string, int>::const_iterator procedureIndexPair = procedureNameSet.find(procedureName);
-        // Check if procedure exists or procedure is recursive
-        if (procedureIndexPair == procedureNameSet.end() || procedureIndexPair->second == currProcNameIndex) {
-            // Throw error
-            return false;
-        }
-    }
-    return true;
-}
-
-/**
- * Populates the adjacencyMatrixOfCalls with the statement Nodes.
- *
- * @param stmtNode The statement Node
- * @param procedureNameSet The set of procedure names
- * @param currProcNameIndex The index of the current procedure in the adjacencyMatrixOfCalls
- */
-Void SemanticErrorsValidator::populateCallGraphWithStatementNode(StatementNode* stmtNode,
-                                                                 std::unordered_map<std::string, int>& procedureNameSet,
-                                                                 int currProcNameIndex)
-{
-    StatementType stmtType = stmtNode->getStatementType();
-    switch (stmtType) {
-    case WhileStatement:
-        populateCallGraphWithWhileStatement(dynamic_cast<WhileStatementNode*>(stmtNode), procedureNameSet,
-                                            currProcNameIndex);
-        break;
-    case CallStatement:
-        addCallEdge(dynamic_cast<CallStatementNode*>(stmtNode), procedureNameSet, currProcNameIndex);
-        break;
-    case IfStatement:
-        populateCallGraphWithIfStatement(dynamic_cast<IfStatementNode*>(stmtNode), procedureNameSet, currProcNameIndex);
-        break;
-    default:
-        break;
-    }
-}
-
-/**
- * Populates the adjacencyMatrixOfCalls with the IfStatement Node.
- *
- * @param stmtNode The IfStatement Node
- * @param procedureNameSet The set of procedure names
- * @param currProcNameIndex The index of the current procedure in the adjacencyMatrixOfCalls
- */
-Void SemanticErrorsValidator::populateCallGraphWithIfStatement(IfStatementNode* stmtNode,
-                                                               std::unordered_map<std::string, int>& procedureNameSet,
-                                                               int currProcNameIndex)
-{
-    const StmtlstNode& ifStmtListNode = *(stmtNode->ifStatementList);
-    const StmtlstNode& elseStmtListNode = *(stmtNode->elseStatementList);
-    const List<StatementNode>& ifStmtList = ifStmtListNode.statementList;
-    const List<StatementNode>& elseStmtList = elseStmtListNode.statementList;
-
-    for (size_t i = 0; i < ifStmtList.size(); i++) {
-        StatementNode* statementNode = ifStmtList.at(i).get();
-        populateCallGraphWithStatementNode(statementNode, procedureNameSet, currProcNameIndex);
-    }
-
-    for (size_t i = 0; i < elseStmtList.size(); i++) {
-        StatementNode* statementNode = elseStmtList.at(i).get();
-        populateCallGraphWithStatementNode(statementNode, procedureNameSet, currProcNameIndex);
-    }
-}
-
-/**
- * Populates the adjacencyMatrixOfCalls with the WhileStatement Node.
- *
- * @param stmtNode The WhileStatement Node
- * @param procedureNameSet The set of procedure names
- * @param currProcNameIndex The index of the current procedure in the adjacencyMatrixOfCalls
- */
-Void SemanticErrorsValidator::populateCallGraphWithWhileStatement(
-    WhileStatementNode* stmtNode, std::unordered_map<std::string, int>& procedureNameSet, int currProcNameIndex)
-{
-    const ConditionalExpression* predicate = stmtNode->predicate;
-    const StmtlstNode& stmtListNode = *(stmtNode->statementList);
-
-    if (predicate == nullptr) {
-        // TODO: throw error
-    } else if (stmtListNode.statementList.size() == 0) {
-        // TODO: throw error
-    } else {
-        const List<StatementNode>& stmtList = stmtListNode.statementList;
-        for (size_t i = 0; i < stmtList.size(); i++) {
-            StatementNode* statementNode = stmtList.at(i).get();
-            populateCallGraphWithStatementNode(statementNode, procedureNameSet, currProcNameIndex);
-        }
-    }
-}
-
-/**
- * Adds an edge to the adjacencyMatrixOfCalls so that we can
- * use it to identify cyclic calls.
- *
- * @param stmtNode The CallStatement node
- * @param procedureNameSet The set of procedure names
- * @param currProcNameIndex The index of the current procedure in the adjacencyMatrixOfCalls
- */
-Void SemanticErrorsValidator::addCallEdge(CallStatementNode* stmtNode,
-                                          std::unordered_map<std::string, int>& procedureNameSet, int currProcNameIndex)
-{
-    Name procedureName = stmtNode->procedureName;
-    if (procedureName == "") {
-        // Throw error
-    }
-
-    int procIndex = getProcNameIndex(procedureNameSet, procedureName);
-
-    // Add call procedureName in graph
-    adjacencyMatrixOfCalls.at(currProcNameIndex).at(procIndex) = true;
-}
-
-/**
- * Returns the index of a procedure in the procedureNameSet.
- *
- * @param procedureNameSet The set of procedure names
- * @param procName The procedure name
- * @return The index of the named procedure in procedureNameSet
- */
-int SemanticErrorsValidator::getProcNameIndex(std::unordered_map<std::string, int> procedureNameSet,
-                                              const std::string& procName)
-{
-    std::unordered_map<std::string, int>::const_iterator procedureIndexPair = procedureNameSet.find(procName);
-    // We assume that all procedures exists
-    int procIndex = 0;
-    if (procedureIndexPair != procedureNameSet.end()) {
-        procIndex = procedureIndexPair->second;
-    }
-    return procIndex;
-}
-
 /**
  * Helper function to check for cyclic calls using the
  * adjacencyMatrixOfCalls.
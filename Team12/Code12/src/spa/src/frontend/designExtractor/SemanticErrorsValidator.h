@@ -12,11 +12,23 @@
 #include <unordered_map>
 #include <utility>
 
+#include "DesignTraversal.h"
 #include "ast/AstTypes.h"
 #include "error/InputError.h"
 
 typedef std::vector<std::vector<bool>> Matrix;
 
+/**
+ * Collects the names of the procedures called by
+ * the call statements of the procedures visited.
+ */
+class CalledProceduresCollector: public DesignSink {
+public:
+    Vector<Name> calledProcedures;
+
+    Void visitCall(const CallStatementNode& call) override;
+};
+
 class SemanticErrorsValidator {
 public:
     /**
@@ -35,6 +47,18 @@ public:
 
     explicit SemanticErrorsValidator(ProgramNode& progNode);
 
+    /**
+     * Creates a Semantic Errors Validator for a program, with
+     * the procedures called by each procedure already collected
+     * while traversing the program, so that the call statements
+     * do not have to be found again.
+     *
+     * @param progNode The program to validate.
+     * @param calledProcedures Names of the procedures called by each
+     *                         procedure, in the order of the procedures.
+     */
+    SemanticErrorsValidator(ProgramNode& progNode, Vector<Vector<Name>> calledProcedures);
+
     /**
      * The main method of Semantic Errors Validator,
      * checks the program for semantic errors like
@@ -75,22 +99,11 @@ private:
     // Cache the result of isProgramValid upon first run
     Boolean programValidity;
 
+    // Names of the procedures called by each procedure
+    Vector<Vector<Name>> calledProceduresByProcedure;
+
     Boolean checkForAllSemanticErrors();
-    Void populateCallGraphWithStatementNode(StatementNode* stmtNode,
-                                            std::unordered_map<std::string, int>& procedureNameSet,
-                                            int currProcNameIndex);
-    Void populateCallGraphWithIfStatement(IfStatementNode* stmtNode,
-                                          std::unordered_map<std::string, int>& procedureNameSet,
-                                          int currProcNameIndex);
-    Void populateCallGraphWithWhileStatement(WhileStatementNode* stmtNode,
-                                             std::unordered_map<std::string, int>& procedureNameSet,
-                                             int currProcNameIndex);
-    Void addCallEdge(CallStatementNode* stmtNode, std::unordered_map<std::string, int>& procedureNameSet,
-                     int currProcNameIndex);
-    Boolean checkCallStatementCallsValidProcedure(StatementNode* stmtNode,
-                                                  std::unordered_map<std::string, int>& procedureNameSet,
-                                                  int currProcNameIndex);
-    static int getProcNameIndex(std::unordered_map<std::string, int> procedureNameSet, const std::string& procName);
+    static Vector<Vector<Name>> collectCalledProcedures(const ProgramNode& progNode);
     bool isCyclic(size_t procListSize);
     bool isCyclicUtil(int v, bool visited[], bool* recStack);
 };
@@ -3,183 +3,29 @@
  */
 #include "UsesExtractor.h"
 
-#include <stdexcept>
-#include <unordered_set>
+#include <utility>
 
-#include "pkb/PKB.h"
+#include "DesignBuffer.h"
 
-typedef std::string ProcedureName;
-/**
- * VariablesVector represents a set of variables,
- * possibly used by a certain part of the program.
- */
-typedef std::unordered_set<std::string> VariablesSet;
-/**
- * A map of ProcedureName to a list of variables used by
- * that procedure, in order to find Uses for call statements.
- */
-typedef std::unordered_map<ProcedureName, VariablesSet> ProcedureUsesMap;
-
-Void storeUsesVariablesInPkb(StatementNumber stmt, StatementType type, const VariablesSet& variables)
-{
-    addUsesRelationships(stmt, type, std::vector<std::string>(variables.begin(), variables.end()));
-}
-
-Void storeUsesVariablesInPkb(const ProcedureName& proc, const VariablesSet& variables)
+Void extractUsesFromProcedure(const ProcedureNode& procedureNode, size_t procedureIndex,
+                              const UsedVariablesCollector& collector, const VariableIds& variableIds,
+                              Vector<AdaptiveBitset>& procedureUses)
 {
-    addUsesRelationships(proc, std::vector<std::string>(variables.begin(), variables.end()));
-}
-
-/**
- * Helper method to join two or three std::vectors. Note
- * that order of the elements is not preserved, but
- * output is guaranteed to hold unique elements.
- *
- * @param v1 The first VariableVector.
- * @param v2 The second VariableVector.
- * @param v3 The third VariableVector.
- * @return A VariableVector containing unique
- *         elements from both v1 and v2.
- */
-VariablesSet concatenateVectors(const VariablesSet& v1, const VariablesSet& v2, const VariablesSet& v3 = VariablesSet())
-{
-    VariablesSet uniqueSet;
-    uniqueSet.reserve(v1.size() + v2.size());
-    for (const std::string& var1 : v1) {
-        uniqueSet.insert(var1);
-    }
-    for (const std::string& var2 : v2) {
-        uniqueSet.insert(var2);
-    }
-    for (const std::string& var3 : v3) {
-        uniqueSet.insert(var3);
-    }
-    return uniqueSet;
-}
-
-VariablesSet extractUsesExpression(const Expression* expr)
-{
-    // determine expression type
-    if (expr->isArithmetic()) {
-        // NOLINTNEXTLINE
-        const ArithmeticExpression* arithExp = static_cast<const ArithmeticExpression*>(expr);
-        VariablesSet leftUses = extractUsesExpression(arithExp->leftFactor);
-        VariablesSet rightUses = extractUsesExpression(arithExp->rightFactor);
-        return concatenateVectors(leftUses, rightUses);
-    } else {
-        // NOLINTNEXTLINE
-        const ReferenceExpression* refExp = static_cast<const ReferenceExpression*>(expr);
-        const BasicDataType* data = refExp->basicData;
-        if (data->isConstant()) {
-            // constants cannot be used!
-            return VariablesSet();
-        } else {
-            VariablesSet uses;
-            uses.reserve(1);
-            // NOLINTNEXTLINE
-            uses.insert((static_cast<const Variable*>(data))->varName);
-            return uses;
+    Vector<Pair<const StatementNode*, AdaptiveBitset>> statementVariables;
+    AdaptiveBitset variablesUsedInCurrentProcedure
+        = collector.findVariables(procedureUses, variableIds, statementVariables);
+    // update PKB
+    for (const Pair<const StatementNode*, AdaptiveBitset>& statement : statementVariables) {
+        if (statement.second.any()) {
+            bufferUsesRelationships(statement.first->getStatementNumber(), statement.first->getStatementType(),
+                                    variableIds.getNames(statement.second));
         }
     }
-}
-
-VariablesSet extractUsesConditionalExpression(const ConditionalExpression* cond)
-{
-    VariablesSet leftUses;
-    VariablesSet rightUses;
-    switch (cond->getConditionalType()) {
-    case NotConditionalExpression:
-        // NOLINTNEXTLINE
-        return extractUsesConditionalExpression(static_cast<const NotExpression*>(cond)->expression);
-    case AndConditionalExpression: {
-        // NOLINTNEXTLINE
-        const AndExpression* andExpr = static_cast<const AndExpression*>(cond);
-        leftUses = extractUsesConditionalExpression(andExpr->leftExpression);
-        rightUses = extractUsesConditionalExpression(andExpr->rightExpression);
-        break;
-    }
-    case OrConditionalExpression: {
-        // NOLINTNEXTLINE
-        const OrExpression* orExpr = static_cast<const OrExpression*>(cond);
-        leftUses = extractUsesConditionalExpression(orExpr->leftExpression);
-        rightUses = extractUsesConditionalExpression(orExpr->rightExpression);
-        break;
-    }
-    case RelationalConditionalExpression: {
-        // NOLINTNEXTLINE
-        const RelationalExpression* relExpr = static_cast<const RelationalExpression*>(cond);
-        leftUses = extractUsesExpression(relExpr->leftFactor);
-        rightUses = extractUsesExpression(relExpr->rightFactor);
-        break;
-    }
-    default:
-        throw std::runtime_error("Unknown expression type in UsesExtractor extractUsesConditionalExpression");
+    if (variablesUsedInCurrentProcedure.any()) {
+        bufferUsesRelationships(procedureNode.procedureName, variableIds.getNames(variablesUsedInCurrentProcedure));
     }
-    return concatenateVectors(leftUses, rightUses);
-}
-
-/**
- * Returns all the variables used in the statement list
- */
-VariablesSet extractUsesStmtlst(const StmtlstNode* stmtLstNode, ProcedureUsesMap* procedureUses)
-{
-    size_t numberOfStatements = stmtLstNode->statementList.size();
-    VariablesSet allVariablesUsed;
-    for (size_t i = 0; i < numberOfStatements; i++) {
-        const std::unique_ptr<StatementNode>& currentStatement = stmtLstNode->statementList.at(i);
-        VariablesSet usedInStatement;
-        StatementType currentStatementType = currentStatement->getStatementType();
-        switch (currentStatementType) {
-        case AssignmentStatement: {
-            // NOLINTNEXTLINE
-            const auto* assign = static_cast<const AssignmentStatementNode*>(currentStatement.get());
-            usedInStatement = extractUsesExpression(assign->expression);
-            break;
-        }
-        case CallStatement: {
-            // NOLINTNEXTLINE
-            const auto* call = static_cast<const CallStatementNode*>(currentStatement.get());
-            usedInStatement = procedureUses->at(call->procedureName);
-            break;
-        }
-        case IfStatement: {
-            // NOLINTNEXTLINE
-            const auto* ifStatement = static_cast<const IfStatementNode*>(currentStatement.get());
-            VariablesSet usedInConditional = extractUsesConditionalExpression(ifStatement->predicate);
-            VariablesSet usedInIf = extractUsesStmtlst(ifStatement->ifStatementList, procedureUses);
-            VariablesSet usedInElse = extractUsesStmtlst(ifStatement->elseStatementList, procedureUses);
-            usedInStatement = concatenateVectors(usedInConditional, usedInIf, usedInElse);
-            break;
-        }
-        case PrintStatement: {
-            // NOLINTNEXTLINE
-            usedInStatement.insert(static_cast<const PrintStatementNode*>(currentStatement.get())->var.varName);
-            break;
-        }
-        case ReadStatement: {
-            // ReadStatement does not use any variables
-            // do nothing
-            break;
-        }
-        case WhileStatement: {
-            // NOLINTNEXTLINE
-            const auto* whileStatement = static_cast<const WhileStatementNode*>(currentStatement.get());
-            VariablesSet usedInConditional = extractUsesConditionalExpression(whileStatement->predicate);
-            VariablesSet usedInWhileList = extractUsesStmtlst(whileStatement->statementList, procedureUses);
-            usedInStatement = concatenateVectors(usedInConditional, usedInWhileList);
-            break;
-        }
-        default:
-            throw std::runtime_error("Unknown statement type in UsesExtractor extractUsesStmtlst");
-        }
-        // update PKB
-        if (!usedInStatement.empty()) {
-            storeUsesVariablesInPkb(currentStatement->getStatementNumber(), currentStatementType, usedInStatement);
-        }
-        // associate variables with the statement list as well
-        allVariablesUsed = concatenateVectors(allVariablesUsed, usedInStatement);
-    }
-    return allVariablesUsed;
+    // store the variables of the procedure, for Call statements in other procedures
+    procedureUses.at(procedureIndex) = std::move(variablesUsedInCurrentProcedure);
 }
 
 /**
@@ -191,32 +37,35 @@ VariablesSet extractUsesStmtlst(const StmtlstNode* stmtLstNode, ProcedureUsesMap
  * @param callOrder The order to run the extractor. Procedures
  *                  that call other procedures have to be
  *                  run last to populate the procedure uses
- *                  map. If not, the correct Uses relationships
+ *                  summaries. If not, the correct Uses relationships
  *                  cannot be determined for Call statements.
  * @return Map of procedure names to used variables.
  */
 ProcedureUsesMap extractUsesReturnMap(ProgramNode& rootNode, const std::vector<int>& callOrder)
 {
-    // set up procedureUses map
-    ProcedureUsesMap procedureUses;
+    const List<ProcedureNode>& procedures = rootNode.procedureList;
+    std::unordered_map<Name, size_t> procedureIndexes;
+    for (size_t procIndex = 0; procIndex < procedures.size(); procIndex++) {
+        procedureIndexes.insert({procedures.at(procIndex)->procedureName, procIndex});
+    }
+    VariableIds variableIds;
+    Vector<UsedVariablesCollector> collectors(procedures.size());
+    for (size_t procIndex = 0; procIndex < procedures.size(); procIndex++) {
+        traverseProcedure(*procedures.at(procIndex), {&collectors.at(procIndex)});
+        collectors.at(procIndex).resolve(variableIds, procedureIndexes);
+    }
     // process the procedures in the sorted order
+    Vector<AdaptiveBitset> procedureUses(procedures.size());
     for (int procIndex : callOrder) {
-        const std::unique_ptr<ProcedureNode>& currentProcedure = rootNode.procedureList.at(procIndex);
-        VariablesSet variablesUsedInCurrentProcedure
-            = extractUsesStmtlst(currentProcedure->statementListNode, &procedureUses);
-        // update PKB
-        if (!variablesUsedInCurrentProcedure.empty()) {
-            storeUsesVariablesInPkb(currentProcedure->procedureName, variablesUsedInCurrentProcedure);
-        }
-        // store Uses relationship in hash map, for Call statements
-        procedureUses.insert(
-            std::pair<ProcedureName, VariablesSet>(currentProcedure->procedureName, variablesUsedInCurrentProcedure));
+        extractUsesFromProcedure(*procedures.at(procIndex), procIndex, collectors.at(procIndex), variableIds,
+                                 procedureUses);
     }
-    return procedureUses;
-}
 
-Void extractUses(ProgramNode& rootNode, SemanticErrorsValidator& sev)
-{
-    // determine order to extract Uses with topological sort
-    extractUsesReturnMap(rootNode, sev.reverseTopologicalSort());
+    ProcedureUsesMap procedureUsesMap;
+    for (size_t procIndex = 0; procIndex < procedures.size(); procIndex++) {
+        Vector<String> variables = variableIds.getNames(procedureUses.at(procIndex));
+        procedureUsesMap.insert(
+            {procedures.at(procIndex)->procedureName, VariablesSet(variables.begin(), variables.end())});
+    }
+    return procedureUsesMap;
 }
@@ -1,21 +1,37 @@
 /**
- * Identifies Parent relationships.
+ * Identifies Uses relationships.
  */
 
 #ifndef SPA_FRONTEND_USES_EXTRACTOR_H
 #define SPA_FRONTEND_USES_EXTRACTOR_H
 
-#include "SemanticErrorsValidator.h"
+#include "VariablesCollector.h"
 #include "ast/AstTypes.h"
 
 /**
- * Stores Uses information in the PKB.
+ * A map of ProcedureName to a list of variables used by that procedure.
+ */
+typedef ProcedureVariablesMap ProcedureUsesMap;
+
+/**
+ * Stores Uses information of a single procedure in the PKB,
+ * and the variables used by the procedure in its entry of
+ * the summaries. The procedures that it calls must already
+ * have been extracted.
+ *
+ * As only the entry of this procedure is written to, procedures
+ * that do not call each other can be extracted at the same time.
  *
- * @param rootNode Root node of the AST.
- * @param sev The SemanticErrorsValidator
- *            used by Design Extractor.
+ * @param procedureNode The procedure to extract Uses from.
+ * @param procedureIndex The index of the procedure in the program.
+ * @param collector The variables used by each statement of the procedure,
+ *                  collected as it was traversed, and resolved.
+ * @param variableIds The variables of the program.
+ * @param procedureUses The variables used by each procedure, by index.
  * @return Void.
  */
-Void extractUses(ProgramNode& rootNode, SemanticErrorsValidator& sev);
+Void extractUsesFromProcedure(const ProcedureNode& procedureNode, size_t procedureIndex,
+                              const UsedVariablesCollector& collector, const VariableIds& variableIds,
+                              Vector<AdaptiveBitset>& procedureUses);
 
 #endif // SPA_FRONTEND_USES_EXTRACTOR_H
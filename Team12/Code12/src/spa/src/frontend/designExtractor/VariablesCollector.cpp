@@ -0,0 +1,139 @@
+/**
+ * Implementation of the collector of the variables
+ * used or modified by each statement of a procedure.
+ */
+
+#include "VariablesCollector.h"
+
+#include <limits>
+#include <utility>
+
+const size_t VariableIds::CompressionThreshold = 1024;
+
+const size_t VariablesCollector::NoContainer = std::numeric_limits<size_t>::max();
+
+size_t VariableIds::intern(const Name& variable)
+{
+    auto inserted = ids.insert({variable, names.size()});
+    if (inserted.second) {
+        names.push_back(variable);
+    }
+    return inserted.first->second;
+}
+
+size_t VariableIds::size() const
+{
+    return names.size();
+}
+
+AdaptiveBitset VariableIds::createSet() const
+{
+    return AdaptiveBitset(names.size(), names.size() >= CompressionThreshold);
+}
+
+Vector<String> VariableIds::getNames(const AdaptiveBitset& variables) const
+{
+    Vector<String> namesInSet;
+    namesInSet.reserve(variables.count());
+    for (Integer id : variables.toVector()) {
+        namesInSet.push_back(names.at(id));
+    }
+    return namesInSet;
+}
+
+Void VariablesCollector::visitStatementList(const StmtlstNode& stmtLstNode, const StatementNode* container)
+{
+    size_t containerIndex = container == nullptr ? NoContainer : statementIndexes.at(container->getStatementNumber());
+    for (const std::unique_ptr<StatementNode>& statement : stmtLstNode.statementList) {
+        statementIndexes.insert({statement->getStatementNumber(), statements.size()});
+        statements.push_back(CollectedStatement{statement.get(), containerIndex, nullptr, Vector<size_t>()});
+    }
+}
+
+Void VariablesCollector::visitCall(const CallStatementNode& call)
+{
+    statements.at(statementIndexes.at(call.getStatementNumber())).calledProcedure = &call.procedureName;
+}
+
+Void VariablesCollector::addVariable(const StatementNode& statement, const Name& variable)
+{
+    auto inserted = localIds.insert({&variable, localNames.size()});
+    if (inserted.second) {
+        localNames.push_back(&variable);
+    }
+    statements.at(statementIndexes.at(statement.getStatementNumber())).variables.push_back(inserted.first->second);
+}
+
+Void VariablesCollector::resolve(VariableIds& variableIds, const std::unordered_map<Name, size_t>& procedureIndexes)
+{
+    variableIdsOfLocalIds.clear();
+    variableIdsOfLocalIds.reserve(localNames.size());
+    for (const Name* variable : localNames) {
+        variableIdsOfLocalIds.push_back(variableIds.intern(*variable));
+    }
+    calledProcedureIndexes.assign(statements.size(), 0);
+    for (size_t i = 0; i < statements.size(); i++) {
+        if (statements.at(i).calledProcedure != nullptr) {
+            calledProcedureIndexes.at(i) = procedureIndexes.at(*statements.at(i).calledProcedure);
+        }
+    }
+}
+
+AdaptiveBitset
+VariablesCollector::findVariables(const Vector<AdaptiveBitset>& procedureVariables, const VariableIds& variableIds,
+                                  Vector<Pair<const StatementNode*, AdaptiveBitset>>& statementVariables) const
+{
+    Vector<AdaptiveBitset> variables;
+    variables.reserve(statements.size());
+    for (const CollectedStatement& collected : statements) {
+        AdaptiveBitset variablesOfStatement = variableIds.createSet();
+        for (size_t localId : collected.variables) {
+            variablesOfStatement.set(variableIdsOfLocalIds.at(localId));
+        }
+        variables.push_back(std::move(variablesOfStatement));
+    }
+
+    // statements nested in a container are collected after it, so going
+    // backwards finds the variables of a statement before its container
+    AdaptiveBitset variablesOfProcedure = variableIds.createSet();
+    for (size_t i = statements.size(); i-- > 0;) {
+        const CollectedStatement& collected = statements.at(i);
+        if (collected.calledProcedure != nullptr) {
+            variables.at(i) |= procedureVariables.at(calledProcedureIndexes.at(i));
+        }
+        AdaptiveBitset& variablesOfContainer
+            = collected.containerIndex == NoContainer ? variablesOfProcedure : variables.at(collected.containerIndex);
+        variablesOfContainer |= variables.at(i);
+    }
+
+    // add each statement after the statements nested in it, as the
+    // statements were extracted one statement list at a time before
+    Vector<Vector<size_t>> nestedIndexes(statements.size() + 1);
+    for (size_t i = 0; i < statements.size(); i++) {
+        size_t containerIndex = statements.at(i).containerIndex;
+        nestedIndexes.at(containerIndex == NoContainer ? statements.size() : containerIndex).push_back(i);
+    }
+    statementVariables.reserve(statementVariables.size() + statements.size());
+    addNestedStatements(statements.size(), nestedIndexes, variables, statementVariables);
+    return variablesOfProcedure;
+}
+
+Void VariablesCollector::addNestedStatements(
+    size_t containerIndex, const Vector<Vector<size_t>>& nestedIndexes, Vector<AdaptiveBitset>& variables,
+    Vector<Pair<const StatementNode*, AdaptiveBitset>>& statementVariables) const
+{
+    for (size_t index : nestedIndexes.at(containerIndex)) {
+        addNestedStatements(index, nestedIndexes, variables, statementVariables);
+        statementVariables.emplace_back(statements.at(index).statement, std::move(variables.at(index)));
+    }
+}
+
+Void UsedVariablesCollector::visitUsedVariable(const StatementNode& statement, const Name& variable)
+{
+    addVariable(statement, variable);
+}
+
+Void ModifiedVariablesCollector::visitModifiedVariable(const StatementNode& statement, const Name& variable)
+{
+    addVariable(statement, variable);
+}
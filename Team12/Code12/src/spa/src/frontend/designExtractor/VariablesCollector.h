@@ -0,0 +1,143 @@
+/**
+ * Collects the variables used or modified directly by
+ * each statement of a procedure, for Uses and Modifies.
+ */
+
+#ifndef SPA_FRONTEND_VARIABLES_COLLECTOR_H
+#define SPA_FRONTEND_VARIABLES_COLLECTOR_H
+
+#include <unordered_map>
+#include <unordered_set>
+
+#include "AdaptiveBitset.h"
+#include "DesignTraversal.h"
+
+typedef std::string ProcedureName;
+/**
+ * VariablesSet represents a set of variables, possibly
+ * used or modified by a certain part of the program.
+ */
+typedef std::unordered_set<std::string> VariablesSet;
+/**
+ * A map of ProcedureName to the variables used or modified by that procedure.
+ */
+typedef std::unordered_map<ProcedureName, VariablesSet> ProcedureVariablesMap;
+
+/**
+ * Interns the variables of a program, giving each distinct
+ * variable an index, so that sets of variables can be stored
+ * as bitsets over the indexes.
+ */
+class VariableIds {
+public:
+    /**
+     * Number of variables from which the sets of variables
+     * created are compressed, as most statements only use
+     * or modify a few of the variables in a large program.
+     */
+    static const size_t CompressionThreshold;
+
+    // Gets the index of a variable, giving it the next index if it is new.
+    size_t intern(const Name& variable);
+    // Gets the number of distinct variables interned.
+    size_t size() const;
+
+    /**
+     * Creates an empty set that can hold every variable
+     * interned, compressed if there are many variables.
+     */
+    AdaptiveBitset createSet() const;
+
+    // Gets the names of the variables in a set.
+    Vector<String> getNames(const AdaptiveBitset& variables) const;
+
+private:
+    std::unordered_map<Name, size_t> ids;
+    Vector<Name> names;
+};
+
+/**
+ * Collects the statements of a procedure as it is traversed,
+ * with the variables that each of them uses or modifies directly.
+ * The variables of call and container statements, which include
+ * those of the procedures called and of the statements nested in
+ * them, are found later from what was collected, once the
+ * procedures called have been extracted.
+ */
+class VariablesCollector: public DesignSink {
+public:
+    Void visitStatementList(const StmtlstNode& stmtLstNode, const StatementNode* container) override;
+    Void visitCall(const CallStatementNode& call) override;
+
+    /**
+     * Gives the variables collected indexes in the variables of
+     * the program, and finds the procedures called. Nothing else
+     * may use the VariableIds at the same time.
+     *
+     * @param variableIds The variables of the program.
+     * @param procedureIndexes The index of each procedure in the program,
+     *                         which must include every procedure called.
+     */
+    Void resolve(VariableIds& variableIds, const std::unordered_map<Name, size_t>& procedureIndexes);
+
+    /**
+     * Finds the variables of every statement collected, and the
+     * variables of the procedure. The collector must be resolved.
+     *
+     * @param procedureVariables The variables of each procedure, by index,
+     *                           with those of the procedures called filled in.
+     * @param variableIds The variables of the program.
+     * @param statementVariables Vector to add each statement collected
+     *                           to, together with its variables.
+     * @return The variables of the procedure.
+     */
+    AdaptiveBitset findVariables(const Vector<AdaptiveBitset>& procedureVariables, const VariableIds& variableIds,
+                                 Vector<Pair<const StatementNode*, AdaptiveBitset>>& statementVariables) const;
+
+protected:
+    // Adds a variable used or modified directly by a statement.
+    Void addVariable(const StatementNode& statement, const Name& variable);
+
+private:
+    static const size_t NoContainer;
+
+    struct CollectedStatement {
+        const StatementNode* statement;
+        // index of the container statement, or NoContainer
+        size_t containerIndex;
+        // procedure called, for call statements
+        const Name* calledProcedure;
+        // variables, by their index in this collector
+        Vector<size_t> variables;
+    };
+
+    // statements in the order collected, with every
+    // container statement before the statements in it
+    Vector<CollectedStatement> statements;
+    std::unordered_map<StatementNumber, size_t> statementIndexes;
+    // names in the AST are interned, so the variables are told apart
+    // by their address first, and by their name when resolved
+    std::unordered_map<const Name*, size_t> localIds;
+    Vector<const Name*> localNames;
+    // index in the program of each variable and procedure called, once resolved
+    Vector<size_t> variableIdsOfLocalIds;
+    Vector<size_t> calledProcedureIndexes;
+
+    Void addNestedStatements(size_t containerIndex, const Vector<Vector<size_t>>& nestedIndexes,
+                             Vector<AdaptiveBitset>& variables,
+                             Vector<Pair<const StatementNode*, AdaptiveBitset>>& statementVariables) const;
+};
+
+// Collects the variables used by each statement, for Uses.
+class UsedVariablesCollector: public VariablesCollector {
+public:
+    Void visitUsedVariable(const StatementNode& statement, const Name& variable) override;
+};
+
+// Collects the variables modified by each statement, for Modifies.
+class ModifiedVariablesCollector: public VariablesCollector {
+public:
+    Void visitModifiedVariable(const StatementNode& statement, const Name& variable) override;
+};
+
+#endif // SPA_FRONTEND_VARIABLES_COLLECTOR_H
@@ -17,3 +17,13 @@ Void NextBipTableFacade::addNextRelationshipBetweenNodes(StatementNode* currentN
     Pair<Integer, Integer> nextRelationship(currentNode->getStatementNumber(), nextNode->getStatementNumber());
     nextRelationships.push_back(nextRelationship);
 }
+
+Void NextBipTableFacade::addNextRelationshipBetweenStatements(StatementNumber prev, StatementType prevType,
+                                                              StatementNumber next, StatementType nextType,
+                                                              std::vector<Pair<Integer, Integer>>& nextRelationships)
+{
+    addNextBipRelationships(prev, prevType, next, nextType);
+
+    // For testing
+    nextRelationships.emplace_back(prev, next);
+}
@@ -32,6 +32,22 @@ public:
      */
     Void addNextRelationshipBetweenNodes(StatementNode* currentNode, StatementNode* nextNode,
                                          std::vector<Pair<Integer, Integer>>& nextRelationships) override;
+
+    /**
+     * Calls the Next BIP API to add a NextBip relationship between two statements,
+     * given by their numbers and types. Also updates the nextRelationships vector
+     * to represent a NextBip relationship for testing.
+     *
+     * @param prev The previous statement in the NextBip relationship
+     * @param prevType The type of the previous statement
+     * @param next The next statement in the NextBip relationship
+     * @param nextType The type of the next statement
+     * @param nextRelationships Vector of pairs of integers to represent NextBip
+     *        Relationships. Solely for testing purposes
+     */
+    Void addNextRelationshipBetweenStatements(StatementNumber prev, StatementType prevType, StatementNumber next,
+                                              StatementType nextType,
+                                              std::vector<Pair<Integer, Integer>>& nextRelationships) override;
 };
 
 #endif // SPA_FRONTEND_NEXT_BIP_TABLE_FACADE_H
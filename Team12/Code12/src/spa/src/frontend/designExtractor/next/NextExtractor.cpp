@@ -102,8 +102,36 @@ std::vector<Pair<Integer, Integer>> extractNext(std::pair<CfgNode*, size_t> cfgI
     return extractor.extractNext();
 }
 
-Vector<Pair<Integer, Integer>> extractNextBip(CfgNode* cfgBip, size_t sizeOfCfgBip)
+Vector<Pair<Integer, Integer>> extractNext(const FlatCfg& flatCfg)
 {
-    NextExtractor bipExtractor(cfgBip, sizeOfCfgBip, new NextBipTableFacade());
-    return bipExtractor.extractNext();
+    NextTableFacade facade;
+    Vector<Pair<Integer, Integer>> nextRelationships;
+    if (flatCfg.countStatements() == 0) {
+        return nextRelationships;
+    }
+    for (StatementNumber prev = flatCfg.getFirstStatement(); prev <= flatCfg.getLastStatement(); prev++) {
+        StatementType prevType = flatCfg.getStatementType(prev);
+        for (StatementNumber next : flatCfg.getNext(prev)) {
+            facade.addNextRelationshipBetweenStatements(prev, prevType, next, flatCfg.getStatementType(next),
+                                                        nextRelationships);
+        }
+    }
+    return nextRelationships;
+}
+
+Vector<Pair<Integer, Integer>> extractNextBip(const BipSupergraph& cfgBip)
+{
+    NextBipTableFacade facade;
+    Vector<Pair<Integer, Integer>> nextBipRelationships;
+    for (StatementNumber prev = 1; prev <= cfgBip.getLastStatement(); prev++) {
+        if (!cfgBip.containsStatement(prev)) {
+            continue;
+        }
+        StatementType prevType = cfgBip.getStatementType(prev);
+        for (StatementNumber next : cfgBip.getNextBip(prev)) {
+            facade.addNextRelationshipBetweenStatements(prev, prevType, next, cfgBip.getStatementType(next),
+                                                        nextBipRelationships);
+        }
+    }
+    return nextBipRelationships;
 }
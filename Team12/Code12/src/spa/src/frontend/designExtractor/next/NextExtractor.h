@@ -9,7 +9,9 @@
 
 #include "NextTableFacade.h"
 #include "ast/AstTypes.h"
+#include "cfg/BipSupergraph.h"
 #include "cfg/CfgTypes.h"
+#include "cfg/FlatCfg.h"
 
 class NextExtractor {
 private:
@@ -82,16 +84,24 @@ public:
 Vector<Pair<Integer, Integer>> extractNext(std::pair<CfgNode*, size_t> cfgInfo);
 
 /**
- * Extracts the NextBip relationships from the current program,
- * represented with a CFG BIP. We access the whole CFG BIP for
- * procedures and other called procedures with just a root node.
+ * Extracts the Next relationships of a procedure from its flat CFG,
+ * where they are already stored as the successors of each statement.
  *
- * @param cfgBip Pointer to the CFG BIP root node.
- * @param sizeOfCfgBip Total number of unique CFG nodes in the CFG BIP.
+ * @param flatCfg The flat CFG of a procedure.
+ * @return A vector of pairs of Integers that represents all the next relationships.
+ *         Solely for testing purposes.
+ */
+Vector<Pair<Integer, Integer>> extractNext(const FlatCfg& flatCfg);
+
+/**
+ * Extracts the NextBip relationships of the program from its
+ * CFG BIP, which links the flat CFGs of all the procedures.
+ *
+ * @param cfgBip The CFG BIP of the program.
  *
  * @return A vector of pairs of integers that represents all the NextBip
  *         relationships. Solely for testing purposes.
  */
-Vector<Pair<Integer, Integer>> extractNextBip(CfgNode* cfgBip, size_t sizeOfCfgBip);
+Vector<Pair<Integer, Integer>> extractNextBip(const BipSupergraph& cfgBip);
 
 #endif // SPA_FRONTEND_NEXT_EXTRACTOR_H
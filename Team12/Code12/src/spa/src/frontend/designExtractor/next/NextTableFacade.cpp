@@ -5,15 +5,25 @@
 
 #include "NextTableFacade.h"
 
-#include "pkb/PKB.h"
+#include "frontend/designExtractor/DesignBuffer.h"
 
 Void NextTableFacade::addNextRelationshipBetweenNodes(StatementNode* currentNode, StatementNode* nextNode,
                                                       std::vector<Pair<Integer, Integer>>& nextRelationships)
 {
-    addNextRelationships(currentNode->getStatementNumber(), currentNode->getStatementType(),
+    bufferNextRelationships(currentNode->getStatementNumber(), currentNode->getStatementType(),
                          nextNode->getStatementNumber(), nextNode->getStatementType());
 
     // For testing
     Pair<Integer, Integer> nextRelationship(currentNode->getStatementNumber(), nextNode->getStatementNumber());
     nextRelationships.push_back(nextRelationship);
 }
+
+Void NextTableFacade::addNextRelationshipBetweenStatements(StatementNumber prev, StatementType prevType,
+                                                           StatementNumber next, StatementType nextType,
+                                                           std::vector<Pair<Integer, Integer>>& nextRelationships)
+{
+    bufferNextRelationships(prev, prevType, next, nextType);
+
+    // For testing
+    nextRelationships.emplace_back(prev, next);
+}
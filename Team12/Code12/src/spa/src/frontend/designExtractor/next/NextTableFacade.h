@@ -29,6 +29,21 @@ public:
      */
     virtual Void addNextRelationshipBetweenNodes(StatementNode* currentNode, StatementNode* nextNode,
                                                  std::vector<Pair<Integer, Integer>>& nextRelationships);
+
+    /**
+     * Calls the PKB API to add a Next relationship between two statements, given by
+     * their numbers and types. Also updates the nextRelationships vector for testing.
+     *
+     * @param prev The previous statement in the Next relationship
+     * @param prevType The type of the previous statement
+     * @param next The next statement in the Next relationship
+     * @param nextType The type of the next statement
+     * @param nextRelationships Vector of pairs of integers to represent Next
+     *        Relationships. Solely for testing purposes
+     */
+    virtual Void addNextRelationshipBetweenStatements(StatementNumber prev, StatementType prevType,
+                                                      StatementNumber next, StatementType nextType,
+                                                      std::vector<Pair<Integer, Integer>>& nextRelationships);
 };
 
 #endif // SPA_FRONTEND_NEXT_TABLE_FACADE_H
@@ -9,7 +9,6 @@
 
 #include "Token.h"
 #include "ast/AstLibrary.h"
-#include "lexer/Lexer.h"
 #include "pkb/PKB.h"
 
 typedef Integer BracketsDepth;
@@ -17,10 +16,12 @@ typedef Integer ErrorCode;
 
 /**
  * Given the index of a closing bracket ")" in a list of
- * tokens, scan the list of program tokens in reverse order,
- * and find the index of the matching open bracket "(".
+ * tokens, find the index of the matching open bracket "(".
  * This may not necessarily be the closest "(".
  *
+ * The matching brackets are computed once when the program
+ * is tokenised, so this takes constant time.
+ *
  * @param programTokens The tokens representing the program.
  * @param indexOfClosedBracket Index of the closed bracket.
  *
@@ -37,26 +38,8 @@ TokenListIndex getBracketStart(frontend::TokenList* programTokens, TokenListInde
         // indexOfFirstBracket out of bounds, or not an opening bracket
         return -2;
     }
-
-    BracketsDepth bracketsSeen = 1;
-    TokenListIndex startBracket = indexOfClosedBracket - 1;
-    while (startBracket >= 0 && bracketsSeen > 0) {
-        frontend::Tag currentToken = programTokens->at(startBracket).tokenTag;
-        if (currentToken == frontend::BracketClosedTag) {
-            bracketsSeen++;
-        } else if (currentToken == frontend::BracketOpenTag) {
-            bracketsSeen--;
-        }
-        // go towards the start of the program
-        startBracket--;
-    }
-
-    if (bracketsSeen > 0) {
-        // did not find the closing bracket in the entire program
-        return -1;
-    } else {
-        return startBracket + 1;
-    }
+    // returns -1 (NoMatchingToken) if there is no matching bracket
+    return programTokens->getMatchingBracket(indexOfClosedBracket);
 }
 
 /**
@@ -64,6 +47,9 @@ TokenListIndex getBracketStart(frontend::TokenList* programTokens, TokenListInde
  * tokens, find the index of the matching closing bracket ")".
  * This may not necessarily be the closest ")".
  *
+ * The matching brackets are computed once when the program
+ * is tokenised, so this takes constant time.
+ *
  * @param programTokens The tokens representing the program.
  * @param indexOfFirstBracket Index of the opening bracket.
  *
@@ -80,25 +66,8 @@ TokenListIndex getBracketEnd(frontend::TokenList* programTokens, TokenListIndex
         // indexOfFirstBracket out of bounds, or not an opening bracket
         return -2;
     }
-
-    BracketsDepth bracketsSeen = 1;
-    TokenListIndex endBracket = indexOfFirstBracket + 1;
-    while (endBracket < numberOfTokens && bracketsSeen > 0) {
-        frontend::Tag currentToken = programTokens->at(endBracket).tokenTag;
-        if (currentToken == frontend::BracketOpenTag) {
-            bracketsSeen++;
-        } else if (currentToken == frontend::BracketClosedTag) {
-            bracketsSeen--;
-        }
-        endBracket++;
-    }
-
-    if (bracketsSeen > 0) {
-        // did not find the closing bracket in the entire program
-        return -1;
-    } else {
-        return endBracket - 1;
-    }
+    // returns -1 (NoMatchingToken) if there is no matching bracket
+    return programTokens->getMatchingBracket(indexOfFirstBracket);
 }
 
 /**
@@ -158,7 +127,7 @@ parseReferenceExpression(frontend::TokenList* programTokens, TokenListIndex inde
     }
     frontend::Tag tokenTag = programTokens->at(index).tokenTag;
     if (frontend::isIdentifierTag(tokenTag)) {
-        String variable = programTokens->at(index).rawString;
+        String variable = programTokens->getTokenString(index);
         if (isUpdatingPkb) {
             insertIntoVariableTable(variable);
         }
@@ -166,7 +135,7 @@ parseReferenceExpression(frontend::TokenList* programTokens, TokenListIndex inde
             std::unique_ptr<ReferenceExpression>(createRefExpr(variable)), index + 1);
     } else if (tokenTag == frontend::ConstantTag) {
         // stoi should succeed unless there is a bug in the tokeniser
-        Integer constant = std::stoi(programTokens->at(index).rawString);
+        Integer constant = std::stoi(programTokens->getTokenString(index));
         if (isUpdatingPkb) {
             insertIntoConstantTable(constant);
         }
@@ -247,20 +216,9 @@ ParserReturnType<std::unique_ptr<ArithmeticExpression>> parseArithmeticExpressio
     ParserReturnType<std::unique_ptr<Expression>> leftExpr(nullptr);
     ParserReturnType<std::unique_ptr<Expression>> rightExpr(nullptr);
 
-    // find last + or - from right
-    Boolean hasPlusOrMinus = false;
-    TokenListIndex operatorIndex = endIndex;
-    while (operatorIndex >= startIndex) {
-        frontend::Tag currentTag = programTokens->at(operatorIndex).tokenTag;
-        if (currentTag == frontend::PlusTag || currentTag == frontend::MinusTag) {
-            hasPlusOrMinus = true;
-            break;
-        } else if (currentTag == frontend::BracketClosedTag) {
-            // jump over brackets
-            operatorIndex = getBracketStart(programTokens, operatorIndex);
-        }
-        operatorIndex--;
-    }
+    // find last + or - from right, ignoring operators inside brackets
+    TokenListIndex operatorIndex = programTokens->findPreviousAdditiveOperator(endIndex);
+    Boolean hasPlusOrMinus = operatorIndex >= startIndex;
     // currentIndex should now point to + or -
     if (hasPlusOrMinus) {
         frontend::Tag currentOperator = programTokens->at(operatorIndex).tokenTag;
@@ -272,20 +230,8 @@ ParserReturnType<std::unique_ptr<ArithmeticExpression>> parseArithmeticExpressio
             throw std::runtime_error("error in parseArithmeticExpression, programTokens list mutated");
         }
     } else {
-        // find last * or / or % from right
-        operatorIndex = endIndex;
-        while (operatorIndex >= startIndex) {
-            frontend::Tag currentTag = programTokens->at(operatorIndex).tokenTag;
-            if (currentTag == frontend::TimesTag || currentTag == frontend::DivideTag
-                || currentTag == frontend::ModuloTag) {
-
-                break;
-            } else if (currentTag == frontend::BracketClosedTag) {
-                // jump over brackets
-                operatorIndex = getBracketStart(programTokens, operatorIndex);
-            }
-            operatorIndex--;
-        }
+        // find last * or / or % from right, ignoring operators inside brackets
+        operatorIndex = programTokens->findPreviousMultiplicativeOperator(endIndex);
 
         if (operatorIndex < startIndex) {
             // syntax error, no operator in arithmetic expression
@@ -616,7 +562,7 @@ ParserReturnType<std::unique_ptr<CallStatementNode>> parseCallStmt(frontend::Tok
         statementsSeen++;
         return ParserReturnType<std::unique_ptr<CallStatementNode>>(
             std::unique_ptr<CallStatementNode>(
-                createCallNode(statementsSeen, programTokens->at(startIndex + 1).rawString)),
+                createCallNode(statementsSeen, programTokens->getTokenString(startIndex + 1))),
             startIndex + 3);
     } else {
         // syntax error in call statement
@@ -634,7 +580,7 @@ ParserReturnType<std::unique_ptr<PrintStatementNode>> parsePrintStmt(frontend::T
         && frontend::isIdentifierTag(programTokens->at(startIndex + 1).tokenTag)
         && programTokens->at(startIndex + 2).tokenTag == frontend::SemicolonTag) {
 
-        String rawString = programTokens->at(startIndex + 1).rawString;
+        String rawString = programTokens->getTokenString(startIndex + 1);
         statementsSeen++;
         insertIntoVariableTable(rawString);
         return ParserReturnType<std::unique_ptr<PrintStatementNode>>(
@@ -655,7 +601,7 @@ ParserReturnType<std::unique_ptr<ReadStatementNode>> parseReadStmt(frontend::Tok
         && frontend::isIdentifierTag(programTokens->at(startIndex + 1).tokenTag)
         && programTokens->at(startIndex + 2).tokenTag == frontend::SemicolonTag) {
 
-        String rawString = programTokens->at(startIndex + 1).rawString;
+        String rawString = programTokens->getTokenString(startIndex + 1);
         statementsSeen++;
         insertIntoVariableTable(rawString);
         return ParserReturnType<std::unique_ptr<ReadStatementNode>>(
@@ -807,7 +753,7 @@ ParserReturnType<std::unique_ptr<AssignmentStatementNode>> parseAssignStmt(front
     if ((numberOfTokens - startIndex) > 3 && frontend::isIdentifierTag(programTokens->at(startIndex).tokenTag)
         && programTokens->at(startIndex + 1).tokenTag == frontend::AssignmentTag) {
 
-        String rawString = programTokens->at(startIndex).rawString;
+        String rawString = programTokens->getTokenString(startIndex);
         insertIntoVariableTable(rawString);
         Variable assignedVariable = Variable(rawString);
         // find end of assign expression (semicolon)
@@ -977,7 +923,7 @@ ParserReturnType<std::unique_ptr<ProcedureNode>> parseProcedure(frontend::TokenL
     if ((numberOfTokens - startIndex > 2) && (programTokens->at(startIndex).tokenTag == frontend::ProcedureKeywordTag)
         && frontend::isIdentifierTag(programTokens->at(startIndex + 1).tokenTag)) {
 
-        procedureName = programTokens->at(startIndex + 1).rawString;
+        procedureName = programTokens->getTokenString(startIndex + 1);
         ParserReturnType<std::unique_ptr<StmtlstNode>> result = parseStatementList(programTokens, startIndex + 2);
         if (result.hasError()) {
             // syntax error in statement list
@@ -1002,30 +948,81 @@ ParserReturnType<std::unique_ptr<ProcedureNode>> parseProcedure(frontend::TokenL
     }
 }
 
-ParserReturnType<ProgramNode*> parseSimpleReturnNode(const String& rawProgram)
+/**
+ * Finds the end of the source text of the procedure starting at
+ * the given character, by locating the closing brace "}" that
+ * matches the first opening brace "{". This only looks at braces,
+ * so the text found need not be a syntactically valid procedure.
+ *
+ * @param procedureStart Pointer to the start of the procedure.
+ * @param programEnd Pointer past the last character of the program.
+ * @return Pointer past the matching closing brace, or programEnd
+ *         if the braces are not matched.
+ */
+const char* findEndOfProcedure(const char* procedureStart, const char* programEnd)
+{
+    BracketsDepth depth = 0;
+    Boolean hasSeenOpenBrace = false;
+    for (const char* currentChar = procedureStart; currentChar != programEnd; currentChar++) {
+        if (*currentChar == '{') {
+            depth++;
+            hasSeenOpenBrace = true;
+        } else if (*currentChar == '}' && --depth <= 0 && hasSeenOpenBrace) {
+            return currentChar + 1;
+        }
+    }
+    return programEnd;
+}
+
+ParserReturnType<ProgramNode*> parseSimpleReturnNode(const char* rawProgram, size_t length)
 {
-    StringVector programFragments = splitProgram(rawProgram);
-    frontend::TokenList tokenisedProgram = frontend::tokeniseSimple(std::move(programFragments));
-    // start at index 0
-    TokenListIndex currentIndex = 0;
-    int numberOfTokens = tokenisedProgram.size();
+    const char* programEnd = rawProgram + length;
+    const char* currentProcedure = rawProgram;
+    TokenListIndex tokensParsed = 0;
+    // allocate the nodes of the program together, to be freed along with it
+    std::unique_ptr<AstArena> arena(new AstArena());
+    AstArena::Scope arenaScope(arena.get());
     List<ProcedureNode> procedures;
     // reset statement numbers to 0
     statementsSeen = 0;
-    while (currentIndex >= 0 && currentIndex < numberOfTokens) {
-        if (tokenisedProgram.at(currentIndex).tokenTag == frontend::ProcedureKeywordTag) {
-            ParserReturnType<std::unique_ptr<ProcedureNode>> p = parseProcedure(&tokenisedProgram, currentIndex);
-            procedures.push_back(std::move(p.astNode));
-            currentIndex = p.nextUnparsedToken;
-        } else {
-            // syntax error, SIMPLE program must consist of procedures
-            return {nullptr, -1};
+    while (currentProcedure != programEnd) {
+        /*
+         * Lex and parse the program one procedure at a time, so that only
+         * the tokens of a single procedure are held in memory at once.
+         */
+        const char* procedureEnd = findEndOfProcedure(currentProcedure, programEnd);
+        frontend::TokenList procedureTokens
+            = frontend::tokeniseSimple(currentProcedure, static_cast<size_t>(procedureEnd - currentProcedure));
+        // start at index 0
+        TokenListIndex currentIndex = 0;
+        int numberOfTokens = procedureTokens.size();
+        while (currentIndex >= 0 && currentIndex < numberOfTokens) {
+            if (procedureTokens.at(currentIndex).tokenTag == frontend::ProcedureKeywordTag) {
+                ParserReturnType<std::unique_ptr<ProcedureNode>> p = parseProcedure(&procedureTokens, currentIndex);
+                procedures.push_back(std::move(p.astNode));
+                currentIndex = p.nextUnparsedToken;
+            } else {
+                // syntax error, SIMPLE program must consist of procedures
+                return {nullptr, -1};
+            }
         }
+        if (currentIndex < 0) {
+            return {nullptr, currentIndex};
+        }
+        tokensParsed += numberOfTokens;
+        currentProcedure = procedureEnd;
     }
 
-    if (currentIndex < 0) {
-        return {nullptr, currentIndex};
-    } else {
-        return {createProgramNode(procedures.at(0)->procedureName, procedures, statementsSeen), numberOfTokens};
+    if (procedures.empty()) {
+        // syntax error, SIMPLE program must have at least one procedure
+        return {nullptr, -1};
     }
+    ProgramNode* program = createProgramNode(procedures.at(0)->procedureName, procedures, statementsSeen);
+    program->adoptArena(std::move(arena));
+    return {program, tokensParsed};
+}
+
+ParserReturnType<ProgramNode*> parseSimpleReturnNode(const String& rawProgram)
+{
+    return parseSimpleReturnNode(rawProgram.data(), rawProgram.size());
 }
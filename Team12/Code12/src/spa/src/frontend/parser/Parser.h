@@ -78,6 +78,21 @@ public:
  */
 ParserReturnType<ProgramNode*> parseSimpleReturnNode(const String& rawProgram);
 
+/**
+ * Parses a SIMPLE program held in a character buffer (e.g.
+ * a memory-mapped source file), which need not be
+ * null-terminated. The program is lexed and parsed one
+ * procedure at a time, so only the tokens of the procedure
+ * being parsed are kept in memory.
+ *
+ * @param rawProgram Pointer to the first character of the program.
+ * @param length Number of characters in the program.
+ *
+ * @return ParserReturnType containing the AST
+ *         representing the program.
+ */
+ParserReturnType<ProgramNode*> parseSimpleReturnNode(const char* rawProgram, size_t length);
+
 /**
  * Parses a SIMPLE arithmetic expression and returns
  * the root node of the Expression. If there is a
@@ -5,58 +5,114 @@
 
 #include "Token.h"
 
-#include "StringMatcher.h"
-#include "Util.h"
+#include <cctype>
+#include <cstring>
+
+#include "lexer/Lexer.h"
 
 using namespace frontend;
 
-Token::Token(String s, Tag t): rawString(std::move(s)), tokenTag(t) {}
+Token::Token(Tag t, uint32_t offset, uint32_t length, Integer stringId):
+    tokenTag(t), offset(offset), length(length), stringId(stringId)
+{}
 
-/**
- * Generates a trie for SIMPLE program keywords.
- * The caller of this function has to remember
- * to delete the trie created, after usage.
- *
- * @return A trie that can be used to identify SIMPLE
- *         program keywords efficiently.
- */
-str_match::Trie<Tag>* generateSimpleTrie()
-{
-    auto* trie = new str_match::Trie<Tag>();
-    // populate trie with SIMPLE program keywords
-    // statement syntax
-    Tag nonEndNodeValue = NullTag;
-    trie->addEntryToTrie("=", AssignmentTag, nonEndNodeValue);
-    trie->addEntryToTrie("{", BracesOpenTag, nonEndNodeValue);
-    trie->addEntryToTrie("}", BracesClosedTag, nonEndNodeValue);
-    trie->addEntryToTrie("(", BracketOpenTag, nonEndNodeValue);
-    trie->addEntryToTrie(")", BracketClosedTag, nonEndNodeValue);
-    trie->addEntryToTrie(";", SemicolonTag, nonEndNodeValue);
-    // keywords
-    trie->addEntryToTrie("call", CallKeywordTag, nonEndNodeValue);
-    trie->addEntryToTrie("else", ElseKeywordTag, nonEndNodeValue);
-    trie->addEntryToTrie("if", IfKeywordTag, nonEndNodeValue);
-    trie->addEntryToTrie("procedure", ProcedureKeywordTag, nonEndNodeValue);
-    trie->addEntryToTrie("print", PrintKeywordTag, nonEndNodeValue);
-    trie->addEntryToTrie("read", ReadKeywordTag, nonEndNodeValue);
-    trie->addEntryToTrie("then", ThenKeywordTag, nonEndNodeValue);
-    trie->addEntryToTrie("while", WhileKeywordTag, nonEndNodeValue);
-    // expression operators
-    trie->addEntryToTrie(">", GtTag, nonEndNodeValue);
-    trie->addEntryToTrie(">=", GteTag, nonEndNodeValue);
-    trie->addEntryToTrie("<", LtTag, nonEndNodeValue);
-    trie->addEntryToTrie("<=", LteTag, nonEndNodeValue);
-    trie->addEntryToTrie("!=", NeqTag, nonEndNodeValue);
-    trie->addEntryToTrie("==", EqTag, nonEndNodeValue);
-    trie->addEntryToTrie("+", PlusTag, nonEndNodeValue);
-    trie->addEntryToTrie("-", MinusTag, nonEndNodeValue);
-    trie->addEntryToTrie("*", TimesTag, nonEndNodeValue);
-    trie->addEntryToTrie("/", DivideTag, nonEndNodeValue);
-    trie->addEntryToTrie("%", ModuloTag, nonEndNodeValue);
-    trie->addEntryToTrie("!", NotConditionalTag, nonEndNodeValue);
-    trie->addEntryToTrie("&&", AndConditionalTag, nonEndNodeValue);
-    trie->addEntryToTrie("||", OrConditionalTag, nonEndNodeValue);
-    return trie;
+const Integer TokenList::NoStringId;
+const Integer TokenList::NoMatchingToken;
+
+size_t TokenList::size() const
+{
+    return tokens.size();
+}
+
+const Token& TokenList::at(size_t index) const
+{
+    return tokens.at(index);
+}
+
+const String& TokenList::getTokenString(size_t index) const
+{
+    static const String noString;
+    Integer stringId = tokens.at(index).stringId;
+    return stringId == NoStringId ? noString : internedStrings[stringId];
+}
+
+size_t TokenList::countInternedStrings() const
+{
+    return internedStrings.size();
+}
+
+Integer TokenList::intern(const char* lexeme, uint32_t length)
+{
+    String str(lexeme, length);
+    auto position = internedStringIds.find(str);
+    if (position != internedStringIds.end()) {
+        return position->second;
+    }
+    auto stringId = static_cast<Integer>(internedStrings.size());
+    internedStringIds.insert({str, stringId});
+    internedStrings.push_back(std::move(str));
+    return stringId;
+}
+
+Integer TokenList::getMatchingBracket(size_t index) const
+{
+    return matchingBrackets.at(index);
+}
+
+Integer TokenList::findPreviousAdditiveOperator(size_t index) const
+{
+    return previousAdditiveOperators.at(index);
+}
+
+Integer TokenList::findPreviousMultiplicativeOperator(size_t index) const
+{
+    return previousMultiplicativeOperators.at(index);
+}
+
+Void TokenList::addToken(Tag tag, const char* lexeme, uint32_t offset, uint32_t length)
+{
+    // only lexemes that the parser may need to read back are interned
+    Boolean hasString = isIdentifierTag(tag) || tag == ConstantTag || tag == UnknownTag;
+    auto index = static_cast<Integer>(tokens.size());
+    tokens.emplace_back(tag, offset, length, hasString ? intern(lexeme, length) : NoStringId);
+
+    // match brackets with a stack of the open brackets seen so far
+    Integer matchingBracket = NoMatchingToken;
+    if (tag == BracketOpenTag) {
+        unmatchedOpenBrackets.push_back(index);
+    } else if (tag == BracketClosedTag && !unmatchedOpenBrackets.empty()) {
+        matchingBracket = unmatchedOpenBrackets.back();
+        unmatchedOpenBrackets.pop_back();
+        matchingBrackets[matchingBracket] = index;
+    }
+    matchingBrackets.push_back(matchingBracket);
+
+    /*
+     * Find the closest operators by following the previous token,
+     * or for a closing bracket, the token before its open bracket.
+     */
+    Integer previousAdditive = NoMatchingToken;
+    Integer previousMultiplicative = NoMatchingToken;
+    if (tag == PlusTag || tag == MinusTag) {
+        previousAdditive = index;
+    } else if (tag == TimesTag || tag == DivideTag || tag == ModuloTag) {
+        previousMultiplicative = index;
+    }
+    Integer previousToken = index - 1;
+    if (tag == BracketClosedTag) {
+        // an unmatched closing bracket ends the search
+        previousToken = matchingBracket == NoMatchingToken ? NoMatchingToken : matchingBracket - 1;
+    }
+    if (previousToken >= 0) {
+        if (previousAdditive == NoMatchingToken) {
+            previousAdditive = previousAdditiveOperators[previousToken];
+        }
+        if (previousMultiplicative == NoMatchingToken) {
+            previousMultiplicative = previousMultiplicativeOperators[previousToken];
+        }
+    }
+    previousAdditiveOperators.push_back(previousAdditive);
+    previousMultiplicativeOperators.push_back(previousMultiplicative);
 }
 
 Boolean frontend::isIdentifierTag(Tag tag)
@@ -71,29 +127,205 @@ Boolean frontend::isRelationalOperatorTag(Tag tag)
     return tag == GtTag || tag == GteTag || tag == LtTag || tag == LteTag || tag == NeqTag || tag == EqTag;
 }
 
-TokenList frontend::tokeniseSimple(StringVector lexedSimpleProgram)
+inline Boolean isAlphanumeric(char c)
 {
-    TokenList tokens;
-    int numberOfStrings = lexedSimpleProgram.size();
-    str_match::Trie<Tag>* lookupTrie = generateSimpleTrie();
-
-    for (int i = 0; i < numberOfStrings; i++) {
-        String currentString = lexedSimpleProgram.at(i);
-        Tag tokenTag = lookupTrie->matchString(currentString, NullTag);
-        if (tokenTag == NullTag) {
-            if (util::isPossibleIdentifier(currentString)) {
-                tokens.push_back(Token(std::move(currentString), IdentifierTag));
-            } else if (util::isPossibleConstant(currentString)) {
-                tokens.push_back(Token(std::move(currentString), ConstantTag));
-            } else {
-                // tokeniser is not sure what the item is
-                tokens.push_back(Token(std::move(currentString), UnknownTag));
+    return std::isalnum(static_cast<unsigned char>(c)) != 0;
+}
+
+inline Boolean isDigit(char c)
+{
+    return std::isdigit(static_cast<unsigned char>(c)) != 0;
+}
+
+/**
+ * Identifies a run of alphanumeric characters as a
+ * keyword, identifier or constant.
+ *
+ * @param lexeme Pointer to the first character of the run.
+ * @param length Length of the run (at least 1).
+ * @return The tag of the run.
+ */
+Tag matchAlphanumericLexeme(const char* lexeme, size_t length)
+{
+    if (isDigit(lexeme[0])) {
+        for (size_t i = 1; i < length; i++) {
+            if (!isDigit(lexeme[i])) {
+                // identifiers cannot start with a digit
+                return UnknownTag;
             }
-        } else {
-            tokens.push_back(Token(std::move(currentString), tokenTag));
         }
+        return ConstantTag;
+    }
+    switch (length) {
+    case 2:
+        return std::strncmp(lexeme, "if", length) == 0 ? IfKeywordTag : IdentifierTag;
+    case 4:
+        if (std::strncmp(lexeme, "call", length) == 0) {
+            return CallKeywordTag;
+        } else if (std::strncmp(lexeme, "else", length) == 0) {
+            return ElseKeywordTag;
+        } else if (std::strncmp(lexeme, "read", length) == 0) {
+            return ReadKeywordTag;
+        } else if (std::strncmp(lexeme, "then", length) == 0) {
+            return ThenKeywordTag;
+        }
+        return IdentifierTag;
+    case 5:
+        if (std::strncmp(lexeme, "print", length) == 0) {
+            return PrintKeywordTag;
+        } else if (std::strncmp(lexeme, "while", length) == 0) {
+            return WhileKeywordTag;
+        }
+        return IdentifierTag;
+    case 9:
+        return std::strncmp(lexeme, "procedure", length) == 0 ? ProcedureKeywordTag : IdentifierTag;
+    default:
+        return IdentifierTag;
+    }
+}
+
+/**
+ * Identifies an operator or punctuation symbol, which is
+ * either one or two characters long.
+ *
+ * @param lexeme Pointer to the first character of the symbol.
+ * @param length Length of the symbol (1 or 2).
+ * @return The tag of the symbol, or UnknownTag if it is not
+ *         a symbol in SIMPLE.
+ */
+Tag matchSymbolLexeme(const char* lexeme, size_t length)
+{
+    if (length == 2) {
+        switch (lexeme[0]) {
+        case '>':
+            return GteTag;
+        case '<':
+            return LteTag;
+        case '!':
+            return NeqTag;
+        case '=':
+            return EqTag;
+        case '&':
+            return AndConditionalTag;
+        case '|':
+            return OrConditionalTag;
+        default:
+            return UnknownTag;
+        }
+    }
+    switch (lexeme[0]) {
+    case '=':
+        return AssignmentTag;
+    case '{':
+        return BracesOpenTag;
+    case '}':
+        return BracesClosedTag;
+    case '(':
+        return BracketOpenTag;
+    case ')':
+        return BracketClosedTag;
+    case ';':
+        return SemicolonTag;
+    case '>':
+        return GtTag;
+    case '<':
+        return LtTag;
+    case '+':
+        return PlusTag;
+    case '-':
+        return MinusTag;
+    case '*':
+        return TimesTag;
+    case '/':
+        return DivideTag;
+    case '%':
+        return ModuloTag;
+    case '!':
+        return NotConditionalTag;
+    default:
+        return UnknownTag;
+    }
+}
+
+/**
+ * Finds the length of the lexeme starting at the given
+ * character, following the same rules as splitProgram:
+ * alphanumeric characters group together, and symbols are
+ * one character long unless they form one of the two
+ * character operators (>=, <=, !=, ==, &&, ||).
+ *
+ * @param lexeme Pointer to the first character of the lexeme,
+ *               which must not be whitespace.
+ * @param end Pointer past the last character of the input.
+ * @return Length of the lexeme.
+ */
+size_t findLexemeLength(const char* lexeme, const char* end)
+{
+    if (isAlphanumeric(*lexeme)) {
+        const char* lexemeEnd = lexeme + 1;
+        while (lexemeEnd != end && isAlphanumeric(*lexemeEnd)) {
+            lexemeEnd++;
+        }
+        return lexemeEnd - lexeme;
+    }
+    Boolean hasNextChar = lexeme + 1 != end;
+    switch (lexeme[0]) {
+    case '>':
+    case '<':
+    case '=':
+    case '!':
+        return hasNextChar && lexeme[1] == '=' ? 2 : 1;
+    case '&':
+    case '|':
+        return hasNextChar && lexeme[1] == lexeme[0] ? 2 : 1;
+    default:
+        return 1;
+    }
+}
+
+Tag matchLexeme(const char* lexeme, size_t length)
+{
+    return isAlphanumeric(*lexeme) ? matchAlphanumericLexeme(lexeme, length) : matchSymbolLexeme(lexeme, length);
+}
+
+TokenList frontend::tokeniseSimple(const char* program, size_t length)
+{
+    TokenList tokens;
+    const char* end = program + length;
+    const char* currentChar = program;
+    while (currentChar != end) {
+        if (isWhitespace(currentChar)) {
+            currentChar++;
+            continue;
+        }
+        size_t lexemeLength = findLexemeLength(currentChar, end);
+        tokens.addToken(matchLexeme(currentChar, lexemeLength), currentChar,
+                        static_cast<uint32_t>(currentChar - program), static_cast<uint32_t>(lexemeLength));
+        currentChar += lexemeLength;
     }
+    return tokens;
+}
 
-    delete lookupTrie;
+TokenList frontend::tokeniseSimple(const String& program)
+{
+    return tokeniseSimple(program.data(), program.size());
+}
+
+TokenList frontend::tokeniseSimple(const StringVector& lexedSimpleProgram)
+{
+    TokenList tokens;
+    uint32_t offset = 0;
+    for (const String& currentString : lexedSimpleProgram) {
+        const char* lexeme = currentString.c_str();
+        auto length = static_cast<uint32_t>(currentString.size());
+        Tag tokenTag = UnknownTag;
+        // the fragment is only valid if it is exactly one lexeme long
+        if (length > 0 && findLexemeLength(lexeme, lexeme + length) == length) {
+            tokenTag = matchLexeme(lexeme, length);
+        }
+        tokens.addToken(tokenTag, lexeme, offset, length);
+        // account for the whitespace separating fragments
+        offset += length + 1;
+    }
     return tokens;
 }
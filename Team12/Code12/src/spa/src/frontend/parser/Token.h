@@ -53,18 +53,127 @@ enum Tag : char {
     NullTag = '\0'
 };
 
+/**
+ * A compact token, referring back to the source it was
+ * lexed from by offset and length rather than holding a
+ * copy of the lexeme. Identifiers, keywords, constants and
+ * unknown lexemes additionally carry the id of their
+ * interned string in the owning TokenList.
+ */
 class Token {
 public:
-    const String rawString;
-    const Tag tokenTag;
-    Token(String s, Tag t);
+    Tag tokenTag;
+    uint32_t offset;
+    uint32_t length;
+    Integer stringId;
+    Token(Tag t, uint32_t offset, uint32_t length, Integer stringId);
+};
+
+/**
+ * The tokens of a SIMPLE program (or a fragment of one),
+ * together with the pool of interned strings they refer to.
+ * Each distinct identifier or constant is stored only once.
+ */
+class TokenList {
+public:
+    static const Integer NoStringId = -1;
+    static const Integer NoMatchingToken = -1;
+
+    size_t size() const;
+    const Token& at(size_t index) const;
+
+    /**
+     * Returns the lexeme of the token at the given index.
+     * Tokens that are neither identifiers, keywords, constants
+     * nor unknown lexemes (i.e. operators and punctuation) do not
+     * have their lexeme stored, and an empty String is returned.
+     */
+    const String& getTokenString(size_t index) const;
+
+    /**
+     * Returns the number of distinct interned strings.
+     */
+    size_t countInternedStrings() const;
+
+    /**
+     * Returns the index of the bracket matching the bracket
+     * "(" or ")" at the given index. The matching brackets are
+     * found once while tokens are added, so this takes constant
+     * time.
+     *
+     * @return Index of the matching bracket, or NoMatchingToken if
+     *         the bracket is unmatched or the token is not a bracket.
+     */
+    Integer getMatchingBracket(size_t index) const;
+
+    /**
+     * Returns the index of the closest "+" or "-" operator at or
+     * before the given index, jumping over bracketed expressions
+     * (i.e. from a ")" to its matching "(").
+     *
+     * @return Index of the operator, or NoMatchingToken if there
+     *         is no such operator, or an unmatched ")" is reached.
+     */
+    Integer findPreviousAdditiveOperator(size_t index) const;
+
+    /**
+     * Returns the index of the closest "*", "/" or "%" operator at
+     * or before the given index, jumping over bracketed expressions
+     * (i.e. from a ")" to its matching "(").
+     *
+     * @return Index of the operator, or NoMatchingToken if there
+     *         is no such operator, or an unmatched ")" is reached.
+     */
+    Integer findPreviousMultiplicativeOperator(size_t index) const;
+
+    Void addToken(Tag tag, const char* lexeme, uint32_t offset, uint32_t length);
+
+private:
+    Vector<Token> tokens;
+    StringVector internedStrings;
+    std::unordered_map<String, Integer> internedStringIds;
+    // indexes computed in a single pass as tokens are added
+    Vector<Integer> matchingBrackets;
+    Vector<Integer> previousAdditiveOperators;
+    Vector<Integer> previousMultiplicativeOperators;
+    Vector<Integer> unmatchedOpenBrackets;
+
+    Integer intern(const char* lexeme, uint32_t length);
 };
 
 Boolean isIdentifierTag(Tag tag);
 Boolean isRelationalOperatorTag(Tag tag);
 
-typedef Vector<Token> TokenList;
-TokenList tokeniseSimple(StringVector lexedSimpleProgram);
+/**
+ * Tokenises a SIMPLE program in a single pass over its
+ * characters, without first splitting it into strings.
+ *
+ * @param program The raw SIMPLE program.
+ * @return The tokens of the program.
+ */
+TokenList tokeniseSimple(const String& program);
+
+/**
+ * Tokenises the SIMPLE program (or part of one) held in
+ * a character buffer, which need not be null-terminated.
+ * Token offsets are relative to the start of the buffer.
+ *
+ * @param program Pointer to the first character of the program.
+ * @param length Number of characters in the program.
+ * @return The tokens of the program.
+ */
+TokenList tokeniseSimple(const char* program, size_t length);
+
+/**
+ * Tokenises a list of already lexed SIMPLE program
+ * fragments, where each fragment forms exactly one token.
+ * Fragments that are not a single valid token are given
+ * the UnknownTag.
+ *
+ * @param lexedSimpleProgram The lexed program fragments.
+ * @return The tokens of the program.
+ */
+TokenList tokeniseSimple(const StringVector& lexedSimpleProgram);
 
 } // namespace frontend
 
@@ -13,6 +13,9 @@ void resetPKB()
 void addUsesRelationships(Integer stmtNum, StatementType stmtType, const Vector<String>& varNames)
 {
     pkb.usesTable.addUsesRelationships(stmtNum, stmtType, varNames);
+    if (stmtType == PrintStatement && !varNames.empty()) {
+        pkb.attributeTable.insertIntoAttributeTable(stmtNum, varNames[0]);
+    }
 }
 void addUsesRelationships(const String& procName, const Vector<String>& varNames)
 {
@@ -38,6 +41,10 @@ Vector<String> getUsesVariablesFromStatement(Integer stmt)
 {
     return pkb.usesTable.getUsesVariablesFromStatement(stmt);
 }
+VectorView<String> viewUsesVariablesFromStatement(Integer stmt)
+{
+    return pkb.usesTable.viewUsesVariablesFromStatement(stmt);
+}
 Vector<String> getUsesVariablesFromProcedure(const String& procName)
 {
     return pkb.usesTable.getUsesVariablesFromProcedure(procName);
@@ -62,6 +69,10 @@ Vector<Pair<Integer, String>> getAllUsesStatementTuple(StatementType stmtType)
 {
     return pkb.usesTable.getAllUsesStatementTuple(stmtType);
 }
+VectorView<Pair<Integer, String>> viewAllUsesStatementTuple(StatementType stmtType)
+{
+    return pkb.usesTable.viewAllUsesStatementTuple(stmtType);
+}
 Vector<Pair<String, String>> getAllUsesProcedureTuple()
 {
     return pkb.usesTable.getAllUsesProcedureTuple();
@@ -125,10 +136,22 @@ Vector<Pair<Integer, Integer>> getAllFollowsTupleStar(StatementType stmtTypeOfBe
 {
     return pkb.followsTable.getAllFollowsTupleStar(stmtTypeOfBefore, stmtTypeOfAfter);
 }
+VectorView<Pair<Integer, Integer>> viewAllFollowsTuple(StatementType stmtTypeOfBefore, StatementType stmtTypeOfAfter)
+{
+    return pkb.followsTable.viewAllFollowsTuple(stmtTypeOfBefore, stmtTypeOfAfter);
+}
+VectorView<Pair<Integer, Integer>> viewAllFollowsTupleStar(StatementType stmtTypeOfBefore,
+                                                           StatementType stmtTypeOfAfter)
+{
+    return pkb.followsTable.viewAllFollowsTupleStar(stmtTypeOfBefore, stmtTypeOfAfter);
+}
 
 // Modifies
 void addModifiesRelationships(Integer stmtNum, StatementType stmtType, Vector<String> varNames)
 {
+    if (stmtType == ReadStatement && !varNames.empty()) {
+        pkb.attributeTable.insertIntoAttributeTable(stmtNum, varNames[0]);
+    }
     return pkb.modifiesTable.addModifiesRelationships(stmtNum, stmtType, std::move(varNames));
 }
 void addModifiesRelationships(const String& procName, Vector<String> varNames)
@@ -155,6 +178,10 @@ Vector<String> getModifiesVariablesFromStatement(Integer stmt)
 {
     return pkb.modifiesTable.getModifiesVariablesFromStatement(stmt);
 }
+VectorView<String> viewModifiesVariablesFromStatement(Integer stmt)
+{
+    return pkb.modifiesTable.viewModifiesVariablesFromStatement(stmt);
+}
 Vector<String> getModifiesVariablesFromProcedure(const String& procName)
 {
     return pkb.modifiesTable.getModifiesVariablesFromProcedure(procName);
@@ -179,6 +206,10 @@ Vector<Pair<Integer, String>> getAllModifiesStatementTuple(StatementType stmtTyp
 {
     return pkb.modifiesTable.getAllModifiesStatementTuple(stmtType);
 }
+VectorView<Pair<Integer, String>> viewAllModifiesStatementTuple(StatementType stmtType)
+{
+    return pkb.modifiesTable.viewAllModifiesStatementTuple(stmtType);
+}
 Vector<Pair<String, String>> getAllModifiesProcedureTuple()
 {
     return pkb.modifiesTable.getAllModifiesProcedureTuple();
@@ -242,6 +273,15 @@ Vector<Pair<Integer, Integer>> getAllParentTupleStar(StatementType stmtTypeOfPar
 {
     return pkb.parentTable.getAllParentTupleStar(stmtTypeOfParent, stmtTypeOfChild);
 }
+VectorView<Pair<Integer, Integer>> viewAllParentTuple(StatementType stmtTypeOfParent, StatementType stmtTypeOfChild)
+{
+    return pkb.parentTable.viewAllParentTuple(stmtTypeOfParent, stmtTypeOfChild);
+}
+VectorView<Pair<Integer, Integer>> viewAllParentTupleStar(StatementType stmtTypeOfParent,
+                                                          StatementType stmtTypeOfChild)
+{
+    return pkb.parentTable.viewAllParentTupleStar(stmtTypeOfParent, stmtTypeOfChild);
+}
 
 // Procedure
 void insertIntoProcedureTable(const String& procName, StatementNumber firstStmtNum, StatementNumber lastStmtNum)
@@ -256,6 +296,10 @@ Vector<String> getAllProcedures()
 {
     return pkb.procedureTable.getAllProcedures();
 }
+VectorView<String> viewAllProcedures()
+{
+    return pkb.procedureTable.viewAllProcedures();
+}
 StatementNumberRange getStatementRangeByProcedure(const ProcedureName& procedureName)
 {
     return pkb.procedureTable.getStatementRangeByProcedure(procedureName);
@@ -278,6 +322,10 @@ Vector<String> getAllVariables()
 {
     return pkb.variableTable.getAllVariables();
 }
+VectorView<String> viewAllVariables()
+{
+    return pkb.variableTable.viewAllVariables();
+}
 
 // Statement
 void insertIntoStatementTable(Integer stmtNum, StatementType stmtType)
@@ -292,8 +340,13 @@ Vector<Integer> getAllStatements(StatementType stmtType)
 {
     return pkb.statementTable.getAllStatements(stmtType);
 }
+VectorView<Integer> viewAllStatements(StatementType stmtType)
+{
+    return pkb.statementTable.viewAllStatements(stmtType);
+}
 void insertIntoStatementTable(Integer stmtNum, const ProcedureName& procName)
 {
+    pkb.attributeTable.insertIntoAttributeTable(stmtNum, procName);
     return pkb.statementTable.insertIntoStatementTable(stmtNum, procName);
 }
 Vector<String> getProcedureCalled(Integer callStmtNum)
@@ -313,6 +366,10 @@ StatementType getStatementType(StatementNumber stmtNum)
 {
     return pkb.statementTable.getStatementType(stmtNum);
 }
+const String& getStatementAttribute(StatementNumber stmtNum)
+{
+    return pkb.attributeTable.getStatementAttribute(stmtNum);
+}
 
 // RootNode
 void assignRootNode(ProgramNode* rootNodeToAssign)
@@ -323,6 +380,10 @@ ProgramNode* getRootNode()
 {
     return pkb.treeStore.getRootNode();
 }
+const PatternIndex& getPatternIndex()
+{
+    return pkb.treeStore.getPatternIndex();
+}
 
 // Constant
 void insertIntoConstantTable(Integer constant)
@@ -337,6 +398,10 @@ Vector<Integer> getAllConstants()
 {
     return pkb.constantTable.getAllConstants();
 }
+VectorView<Integer> viewAllConstants()
+{
+    return pkb.constantTable.viewAllConstants();
+}
 
 // Next
 void addNextRelationships(StatementNumber prev, StatementType prevType, StatementNumber next, StatementType nextType)
@@ -367,6 +432,26 @@ Vector<Pair<StatementNumber, StatementNumber>> getAllNextTuples(StatementType pr
 {
     return pkb.nextTable.getAllNextTuples(prevType, nextType);
 }
+VectorView<StatementNumber> viewAllNextStatements(StatementNumber prev, StatementType nextType)
+{
+    return pkb.nextTable.viewAllNextStatements(prev, nextType);
+}
+VectorView<StatementNumber> viewAllPreviousStatements(StatementNumber next, StatementType prevType)
+{
+    return pkb.nextTable.viewAllPreviousStatements(next, prevType);
+}
+VectorView<StatementNumber> viewAllNextStatementsTyped(StatementType prevType, StatementType nextType)
+{
+    return pkb.nextTable.viewAllNextStatementsTyped(prevType, nextType);
+}
+VectorView<StatementNumber> viewAllPreviousStatementsTyped(StatementType prevType, StatementType nextType)
+{
+    return pkb.nextTable.viewAllPreviousStatementsTyped(prevType, nextType);
+}
+VectorView<Pair<StatementNumber, StatementNumber>> viewAllNextTuples(StatementType prevType, StatementType nextType)
+{
+    return pkb.nextTable.viewAllNextTuples(prevType, nextType);
+}
 
 // Calls
 void addCallerRelationships(const ProcedureName& caller, const ProcedureName& callee)
@@ -440,18 +525,32 @@ Vector<String> getProceduresWithCFG()
     return pkb.treeStore.getProceduresWithCFG();
 }
 
-// CFG Bip
-void storeCFGBip(CfgNode* cfgBip, const ProcedureName& procedureName)
+// Flat CFG
+void storeFlatCFG(const CfgNode* cfg, const ProcedureName& procedureName)
+{
+    pkb.treeStore.storeFlatCFG(cfg, procedureName);
+}
+void storeFlatCFG(std::unique_ptr<FlatCfg> flatCfg, const ProcedureName& procedureName)
+{
+    pkb.treeStore.storeFlatCFG(std::move(flatCfg), procedureName);
+}
+const FlatCfg* getFlatCFG(const ProcedureName& procedureName)
 {
-    pkb.treeStore.storeCFGBip(cfgBip, procedureName);
+    return pkb.treeStore.getFlatCFG(procedureName);
 }
-CfgNode* getCFGBip(const ProcedureName& procedureName)
+const FlatCfg* getFlatCFGOfStatement(StatementNumber stmtNum)
 {
-    return pkb.treeStore.getCFGBip(procedureName);
+    return pkb.treeStore.getFlatCFGOfStatement(stmtNum);
 }
-Vector<String> getProceduresWithCFGBip()
+
+// CFG Bip
+void storeCFGBip()
+{
+    pkb.treeStore.storeCFGBip();
+}
+const BipSupergraph* getCFGBip()
 {
-    return pkb.treeStore.getProceduresWithCFGBip();
+    return pkb.treeStore.getCFGBip();
 }
 
 // NextBip
@@ -483,3 +582,23 @@ Vector<Pair<StatementNumber, StatementNumber>> getAllNextBipTuples(StatementType
 {
     return pkb.nextBipTable.getAllNextBipTuples(prevType, nextType);
 }
+VectorView<StatementNumber> viewAllNextBipStatements(StatementNumber prev, StatementType nextType)
+{
+    return pkb.nextBipTable.viewAllNextBipStatements(prev, nextType);
+}
+VectorView<StatementNumber> viewAllPreviousBipStatements(StatementNumber next, StatementType prevType)
+{
+    return pkb.nextBipTable.viewAllPreviousBipStatements(next, prevType);
+}
+VectorView<StatementNumber> viewAllNextBipStatementsTyped(StatementType prevType, StatementType nextType)
+{
+    return pkb.nextBipTable.viewAllNextBipStatementsTyped(prevType, nextType);
+}
+VectorView<StatementNumber> viewAllPreviousBipStatementsTyped(StatementType prevType, StatementType nextType)
+{
+    return pkb.nextBipTable.viewAllPreviousBipStatementsTyped(prevType, nextType);
+}
+VectorView<Pair<StatementNumber, StatementNumber>> viewAllNextBipTuples(StatementType prevType, StatementType nextType)
+{
+    return pkb.nextBipTable.viewAllNextBipTuples(prevType, nextType);
+}
@@ -4,7 +4,9 @@
 #include <pkb/relationships/NextBip.h>
 
 #include "PkbTypes.h"
+#include "cfg/BipSupergraph.h"
 #include "cfg/CfgTypes.h"
+#include "cfg/FlatCfg.h"
 #include "relationships/Calls.h"
 #include "relationships/Follows.h"
 #include "relationships/Modifies.h"
@@ -16,6 +18,10 @@
 
 /**
  * Holds API methods for the Program Knowledge Base (PKB).
+ *
+ * Methods named view* return a VectorView of a table in the PKB
+ * instead of a copy of it, which is only valid until the PKB is
+ * next modified.
  */
 // Uses
 void addUsesRelationships(Integer stmtNum, StatementType stmtType, const Vector<String>& varNames);
@@ -25,12 +31,14 @@ Boolean checkIfStatementUses(Integer stmt, const String& varName);
 Vector<Integer> getUsesStatements(const String& varName, StatementType stmtType);
 Vector<String> getUsesProcedures(const String& varName);
 Vector<String> getUsesVariablesFromStatement(Integer stmt);
+VectorView<String> viewUsesVariablesFromStatement(Integer stmt);
 Vector<String> getUsesVariablesFromProcedure(const String& procName);
 Vector<Integer> getAllUsesStatements(StatementType stmtType);
 Vector<String> getAllUsesVariablesFromStatementType(StatementType stmtType);
 Vector<String> getAllUsesVariablesFromProgram();
 Vector<String> getAllUsesProcedures();
 Vector<Pair<Integer, String>> getAllUsesStatementTuple(StatementType stmtType);
+VectorView<Pair<Integer, String>> viewAllUsesStatementTuple(StatementType stmtType);
 Vector<Pair<String, String>> getAllUsesProcedureTuple();
 
 // Modifies
@@ -41,12 +49,14 @@ Boolean checkIfStatementModifies(Integer stmt, const String& varName);
 Vector<Integer> getModifiesStatements(const String& varName, StatementType stmtType);
 Vector<String> getModifiesProcedures(const String& varName);
 Vector<String> getModifiesVariablesFromStatement(Integer stmt);
+VectorView<String> viewModifiesVariablesFromStatement(Integer stmt);
 Vector<String> getModifiesVariablesFromProcedure(const String& procName);
 Vector<Integer> getAllModifiesStatements(StatementType stmtType);
 Vector<String> getAllModifiesVariablesFromStatementType(StatementType stmtType);
 Vector<String> getAllModifiesVariablesFromProgram();
 Vector<String> getAllModifiesProcedures();
 Vector<Pair<Integer, String>> getAllModifiesStatementTuple(StatementType stmtType);
+VectorView<Pair<Integer, String>> viewAllModifiesStatementTuple(StatementType stmtType);
 Vector<Pair<String, String>> getAllModifiesProcedureTuple();
 
 // Parent
@@ -65,6 +75,9 @@ Vector<Integer> getAllChildStatementsTyped(StatementType stmtTypeOfParent, State
 Vector<Integer> getAllChildStatementsTypedStar(StatementType stmtTypeOfParent, StatementType stmtTypeOfChild);
 Vector<Pair<Integer, Integer>> getAllParentTuple(StatementType stmtTypeOfParent, StatementType stmtTypeOfChild);
 Vector<Pair<Integer, Integer>> getAllParentTupleStar(StatementType stmtTypeOfParent, StatementType stmtTypeOfChild);
+VectorView<Pair<Integer, Integer>> viewAllParentTuple(StatementType stmtTypeOfParent, StatementType stmtTypeOfChild);
+VectorView<Pair<Integer, Integer>> viewAllParentTupleStar(StatementType stmtTypeOfParent,
+                                                          StatementType stmtTypeOfChild);
 
 // Follows
 void addFollowsRelationships(Integer before, StatementType beforeStmtType, Integer after, StatementType afterStmtType);
@@ -82,6 +95,9 @@ Vector<Integer> getAllAfterStatementsTyped(StatementType stmtTypeOfBefore, State
 Vector<Integer> getAllAfterStatementsTypedStar(StatementType stmtTypeOfBefore, StatementType stmtTypeOfAfter);
 Vector<Pair<Integer, Integer>> getAllFollowsTuple(StatementType stmtTypeOfBefore, StatementType stmtTypeOfAfter);
 Vector<Pair<Integer, Integer>> getAllFollowsTupleStar(StatementType stmtTypeOfBefore, StatementType stmtTypeOfAfter);
+VectorView<Pair<Integer, Integer>> viewAllFollowsTuple(StatementType stmtTypeOfBefore, StatementType stmtTypeOfAfter);
+VectorView<Pair<Integer, Integer>> viewAllFollowsTupleStar(StatementType stmtTypeOfBefore,
+                                                           StatementType stmtTypeOfAfter);
 
 // Next
 void addNextRelationships(StatementNumber prev, StatementType prevType, StatementNumber next, StatementType nextType);
@@ -91,6 +107,11 @@ Vector<StatementNumber> getAllPreviousStatements(StatementNumber next, Statement
 Vector<StatementNumber> getAllNextStatementsTyped(StatementType prevType, StatementType nextType);
 Vector<StatementNumber> getAllPreviousStatementsTyped(StatementType prevType, StatementType nextType);
 Vector<Pair<StatementNumber, StatementNumber>> getAllNextTuples(StatementType prevType, StatementType nextType);
+VectorView<StatementNumber> viewAllNextStatements(StatementNumber prev, StatementType nextType);
+VectorView<StatementNumber> viewAllPreviousStatements(StatementNumber next, StatementType prevType);
+VectorView<StatementNumber> viewAllNextStatementsTyped(StatementType prevType, StatementType nextType);
+VectorView<StatementNumber> viewAllPreviousStatementsTyped(StatementType prevType, StatementType nextType);
+VectorView<Pair<StatementNumber, StatementNumber>> viewAllNextTuples(StatementType prevType, StatementType nextType);
 
 // Calls
 void addCallerRelationships(const ProcedureName& caller, const ProcedureName& callee);
@@ -117,11 +138,17 @@ Vector<StatementNumber> getAllPreviousBipStatements(StatementNumber next, Statem
 Vector<StatementNumber> getAllNextBipStatementsTyped(StatementType prevType, StatementType nextType);
 Vector<StatementNumber> getAllPreviousBipStatementsTyped(StatementType prevType, StatementType nextType);
 Vector<Pair<StatementNumber, StatementNumber>> getAllNextBipTuples(StatementType prevType, StatementType nextType);
+VectorView<StatementNumber> viewAllNextBipStatements(StatementNumber prev, StatementType nextType);
+VectorView<StatementNumber> viewAllPreviousBipStatements(StatementNumber next, StatementType prevType);
+VectorView<StatementNumber> viewAllNextBipStatementsTyped(StatementType prevType, StatementType nextType);
+VectorView<StatementNumber> viewAllPreviousBipStatementsTyped(StatementType prevType, StatementType nextType);
+VectorView<Pair<StatementNumber, StatementNumber>> viewAllNextBipTuples(StatementType prevType, StatementType nextType);
 
 // Procedure
 void insertIntoProcedureTable(const String& procName, StatementNumber firstStmtNum, StatementNumber lastStmtNum);
 Boolean isProcedureInProgram(const String& procName);
 Vector<String> getAllProcedures();
+VectorView<String> viewAllProcedures();
 StatementNumberRange getStatementRangeByProcedure(const ProcedureName& procedureName);
 Vector<ProcedureName> getContainingProcedure(StatementNumber statementNumber);
 
@@ -129,35 +156,45 @@ Vector<ProcedureName> getContainingProcedure(StatementNumber statementNumber);
 void insertIntoVariableTable(const String& varName);
 Boolean isVariableInProgram(const String& varName);
 Vector<String> getAllVariables();
+VectorView<String> viewAllVariables();
 
 // Statement
 void insertIntoStatementTable(Integer stmtNum, StatementType stmtType);
 Boolean isStatementInProgram(Integer stmtNum);
 Vector<Integer> getAllStatements(StatementType stmtType);
+VectorView<Integer> viewAllStatements(StatementType stmtType);
 void insertIntoStatementTable(Integer stmtNum, const ProcedureName& procName);
 Vector<String> getProcedureCalled(Integer callStmtNum);
 Vector<Integer> getAllCallStatementsByProcedure(const String& procName);
 Vector<String> getAllProceduresCalled();
 StatementType getStatementType(StatementNumber stmtNum);
+const String& getStatementAttribute(StatementNumber stmtNum);
 
 // Constant
 void insertIntoConstantTable(Integer constant);
 Boolean isConstantInProgram(Integer constant);
 Vector<Integer> getAllConstants();
+VectorView<Integer> viewAllConstants();
 
 // AST Root node
 void assignRootNode(ProgramNode* rootNodeToAssign);
 ProgramNode* getRootNode();
+const PatternIndex& getPatternIndex();
 
 // CFG
 void storeCFG(CfgNode* cfg, const ProcedureName& procedureName);
 CfgNode* getCFG(const ProcedureName& procedureName);
 Vector<String> getProceduresWithCFG();
 
+// Flat CFG
+void storeFlatCFG(const CfgNode* cfg, const ProcedureName& procedureName);
+void storeFlatCFG(std::unique_ptr<FlatCfg> flatCfg, const ProcedureName& procedureName);
+const FlatCfg* getFlatCFG(const ProcedureName& procedureName);
+const FlatCfg* getFlatCFGOfStatement(StatementNumber stmtNum);
+
 // CFG Bip
-void storeCFGBip(CfgNode* cfgBip, const ProcedureName& procedureName);
-CfgNode* getCFGBip(const ProcedureName& procedureName);
-Vector<String> getProceduresWithCFGBip();
+void storeCFGBip();
+const BipSupergraph* getCFGBip();
 
 // Others
 void resetPKB();
@@ -168,6 +205,7 @@ public:
     StatementTable statementTable;
     VariableTable variableTable;
     ProcedureTable procedureTable;
+    AttributeTable attributeTable;
     // Relationships
     FollowsTable followsTable;
     ParentTable parentTable;
@@ -43,6 +43,60 @@ template <typename K, typename V>
 using ArrayArrayTupleList
     = std::array<std::array<std::vector<std::pair<K, V>>, StatementTypeCount>, StatementTypeCount>;
 
+/**
+ * A read-only view of elements stored contiguously in the PKB,
+ * which is returned instead of a copy of the elements. The view
+ * is only valid until the PKB is next modified or reset.
+ */
+template <typename T>
+class VectorView {
+public:
+    VectorView(): first(nullptr), last(nullptr) {}
+
+    VectorView(const T* first, const T* last): first(first), last(last) {}
+
+    explicit VectorView(const Vector<T>& elements): first(elements.data()), last(elements.data() + elements.size())
+    {}
+
+    // a view of a temporary vector would outlive the elements
+    explicit VectorView(Vector<T>&& elements) = delete;
+
+    const T* begin() const
+    {
+        return first;
+    }
+
+    const T* end() const
+    {
+        return last;
+    }
+
+    size_t size() const
+    {
+        return static_cast<size_t>(last - first);
+    }
+
+    Boolean empty() const
+    {
+        return first == last;
+    }
+
+    const T& operator[](size_t index) const
+    {
+        return first[index];
+    }
+
+    // Copies the elements into a vector.
+    Vector<T> toVector() const
+    {
+        return Vector<T>(first, last);
+    }
+
+private:
+    const T* first;
+    const T* last;
+};
+
 typedef String ProcedureName;
 
 typedef struct {
@@ -334,3 +334,29 @@ Vector<Pair<Integer, Integer>> FollowsTable::getAllFollowsTupleStar(StatementTyp
 {
     return followsStarTuples[stmtTypeOfBefore][stmtTypeOfAfter];
 }
+
+/**
+ * Same as getAllFollowsTuple, but returns a view of the pairs in the table instead of a copy.
+ *
+ * @param stmtTypeOfBefore
+ * @param stmtTypeOfAfter
+ * @return
+ */
+VectorView<Pair<Integer, Integer>> FollowsTable::viewAllFollowsTuple(StatementType stmtTypeOfBefore,
+                                                                     StatementType stmtTypeOfAfter) const
+{
+    return VectorView<Pair<Integer, Integer>>(followsTuples[stmtTypeOfBefore][stmtTypeOfAfter]);
+}
+
+/**
+ * Same as getAllFollowsTupleStar, but returns a view of the pairs in the table instead of a copy.
+ *
+ * @param stmtTypeOfBefore
+ * @param stmtTypeOfAfter
+ * @return
+ */
+VectorView<Pair<Integer, Integer>> FollowsTable::viewAllFollowsTupleStar(StatementType stmtTypeOfBefore,
+                                                                         StatementType stmtTypeOfAfter) const
+{
+    return VectorView<Pair<Integer, Integer>>(followsStarTuples[stmtTypeOfBefore][stmtTypeOfAfter]);
+}
@@ -32,6 +32,10 @@ public:
     Vector<Pair<Integer, Integer>> getAllFollowsTuple(StatementType stmtTypeOfBefore, StatementType stmtTypeOfAfter);
     Vector<Pair<Integer, Integer>> getAllFollowsTupleStar(StatementType stmtTypeOfBefore,
                                                           StatementType stmtTypeOfAfter);
+    VectorView<Pair<Integer, Integer>> viewAllFollowsTuple(StatementType stmtTypeOfBefore,
+                                                           StatementType stmtTypeOfAfter) const;
+    VectorView<Pair<Integer, Integer>> viewAllFollowsTupleStar(StatementType stmtTypeOfBefore,
+                                                               StatementType stmtTypeOfAfter) const;
 
 private:
     // Table and inverse tables
@@ -99,6 +99,11 @@ Vector<String> ModifiesTable::getModifiesVariablesFromStatement(Integer stmt)
 {
     return stmtVarlistMap[stmt];
 }
+VectorView<String> ModifiesTable::viewModifiesVariablesFromStatement(Integer stmt) const
+{
+    auto position = stmtVarlistMap.find(stmt);
+    return position == stmtVarlistMap.end() ? VectorView<String>() : VectorView<String>(position->second);
+}
 Vector<String> ModifiesTable::getModifiesVariablesFromProcedure(const String& procName)
 {
     return procVarlistMap[procName];
@@ -123,6 +128,10 @@ Vector<Pair<Integer, String>> ModifiesTable::getAllModifiesStatementTuple(Statem
 {
     return statementTuples[stmtType];
 }
+VectorView<Pair<Integer, String>> ModifiesTable::viewAllModifiesStatementTuple(StatementType stmtType) const
+{
+    return VectorView<Pair<Integer, String>>(statementTuples[stmtType]);
+}
 Vector<Pair<String, String>> ModifiesTable::getAllModifiesProcedureTuple()
 {
     return procTuples;
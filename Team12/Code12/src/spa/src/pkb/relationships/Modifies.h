@@ -18,12 +18,14 @@ public:
     Vector<Integer> getModifiesStatements(const String& varName, StatementType stmtType);
     Vector<String> getModifiesProcedures(const String& varName);
     Vector<String> getModifiesVariablesFromStatement(Integer stmt);
+    VectorView<String> viewModifiesVariablesFromStatement(Integer stmt) const;
     Vector<String> getModifiesVariablesFromProcedure(const String& procName);
     Vector<Integer> getAllModifiesStatements(StatementType stmtType);
     Vector<String> getAllModifiesVariablesFromStatementType(StatementType stmtType);
     Vector<String> getAllModifiesVariablesFromProgram();
     Vector<String> getAllModifiesProcedures();
     Vector<Pair<Integer, String>> getAllModifiesStatementTuple(StatementType stmtType);
+    VectorView<Pair<Integer, String>> viewAllModifiesStatementTuple(StatementType stmtType) const;
     Vector<Pair<String, String>> getAllModifiesProcedureTuple();
 
 private:
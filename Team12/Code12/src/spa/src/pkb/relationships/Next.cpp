@@ -157,3 +157,71 @@ Vector<Pair<Integer, Integer>> NextTable::getAllNextTuples(StatementType previou
 {
     return followsTuples[previousType][nextType];
 }
+
+/**
+ * Same as getAllNextStatements, but returns a view of the statements in the table instead of a copy.
+ *
+ * @param previous
+ * @param nextType
+ * @return
+ */
+VectorView<StatementNumber> NextTable::viewAllNextStatements(StatementNumber previous, StatementType nextType) const
+{
+    auto position = stmtNextMap.find(previous);
+    return position == stmtNextMap.end() ? VectorView<StatementNumber>()
+                                         : VectorView<StatementNumber>(position->second.byType[nextType]);
+}
+
+/**
+ * Same as getAllPreviousStatements, but returns a view of the statements in the table instead of a copy.
+ *
+ * @param next
+ * @param previousType
+ * @return
+ */
+VectorView<StatementNumber> NextTable::viewAllPreviousStatements(StatementNumber next,
+                                                                 StatementType previousType) const
+{
+    auto position = stmtPreviousMap.find(next);
+    return position == stmtPreviousMap.end() ? VectorView<StatementNumber>()
+                                             : VectorView<StatementNumber>(position->second.byType[previousType]);
+}
+
+/**
+ * Same as getAllPreviousStatementsTyped, but returns a view of the statements in the table instead of a copy.
+ *
+ * @param previousType
+ * @param nextType
+ * @return
+ */
+VectorView<StatementNumber> NextTable::viewAllPreviousStatementsTyped(StatementType previousType,
+                                                                      StatementType nextType) const
+{
+    return VectorView<StatementNumber>(stmtPreviousType[nextType].byType[previousType]);
+}
+
+/**
+ * Same as getAllNextStatementsTyped, but returns a view of the statements in the table instead of a copy.
+ *
+ * @param previousType
+ * @param nextType
+ * @return
+ */
+VectorView<StatementNumber> NextTable::viewAllNextStatementsTyped(StatementType previousType,
+                                                                  StatementType nextType) const
+{
+    return VectorView<StatementNumber>(stmtNextType[previousType].byType[nextType]);
+}
+
+/**
+ * Same as getAllNextTuples, but returns a view of the pairs in the table instead of a copy.
+ *
+ * @param previousType
+ * @param nextType
+ * @return
+ */
+VectorView<Pair<StatementNumber, StatementNumber>> NextTable::viewAllNextTuples(StatementType previousType,
+                                                                                StatementType nextType) const
+{
+    return VectorView<Pair<StatementNumber, StatementNumber>>(followsTuples[previousType][nextType]);
+}
@@ -15,13 +15,19 @@ public:
     Boolean checkIfNextHolds(StatementNumber prev, StatementNumber next);
     Vector<StatementNumber> getAllNextStatements(StatementNumber prev, StatementType nextType);
     Vector<StatementNumber> getAllPreviousStatements(StatementNumber next, StatementType prevType);
+    VectorView<StatementNumber> viewAllNextStatements(StatementNumber prev, StatementType nextType) const;
+    VectorView<StatementNumber> viewAllPreviousStatements(StatementNumber next, StatementType prevType) const;
 
     // Section 3: Collection table methods
     Vector<StatementNumber> getAllNextStatementsTyped(StatementType prevType, StatementType nextType);
     Vector<StatementNumber> getAllPreviousStatementsTyped(StatementType prevType, StatementType nextType);
+    VectorView<StatementNumber> viewAllNextStatementsTyped(StatementType prevType, StatementType nextType) const;
+    VectorView<StatementNumber> viewAllPreviousStatementsTyped(StatementType prevType, StatementType nextType) const;
 
     // Section 4: Tuple methods
     Vector<Pair<StatementNumber, StatementNumber>> getAllNextTuples(StatementType prevType, StatementType nextType);
+    VectorView<Pair<StatementNumber, StatementNumber>> viewAllNextTuples(StatementType prevType,
+                                                                         StatementType nextType) const;
 
 private:
     // Table and inverse tables
@@ -159,3 +159,72 @@ Vector<Pair<Integer, Integer>> NextBipTable::getAllNextBipTuples(StatementType p
 {
     return followsTuples[previousType][nextType];
 }
+
+/**
+ * Same as getAllNextBipStatements, but returns a view of the statements in the table instead of a copy.
+ *
+ * @param previous
+ * @param nextType
+ * @return
+ */
+VectorView<StatementNumber> NextBipTable::viewAllNextBipStatements(StatementNumber previous,
+                                                                   StatementType nextType) const
+{
+    auto position = stmtNextBipMap.find(previous);
+    return position == stmtNextBipMap.end() ? VectorView<StatementNumber>()
+                                            : VectorView<StatementNumber>(position->second.byType[nextType]);
+}
+
+/**
+ * Same as getAllPreviousBipStatements, but returns a view of the statements in the table instead of a copy.
+ *
+ * @param next
+ * @param previousType
+ * @return
+ */
+VectorView<StatementNumber> NextBipTable::viewAllPreviousBipStatements(StatementNumber next,
+                                                                       StatementType previousType) const
+{
+    auto position = stmtPreviousBipMap.find(next);
+    return position == stmtPreviousBipMap.end() ? VectorView<StatementNumber>()
+                                                : VectorView<StatementNumber>(position->second.byType[previousType]);
+}
+
+/**
+ * Same as getAllPreviousBipStatementsTyped, but returns a view of the statements in the table instead of a copy.
+ *
+ * @param previousType
+ * @param nextType
+ * @return
+ */
+VectorView<StatementNumber> NextBipTable::viewAllPreviousBipStatementsTyped(StatementType previousType,
+                                                                            StatementType nextType) const
+{
+    return VectorView<StatementNumber>(stmtPreviousBipType[nextType].byType[previousType]);
+}
+
+/**
+ * Same as getAllNextBipStatementsTyped, but returns a view of the statements in the table instead of a copy.
+ *
+ * @param previousType
+ * @param nextType
+ * @return
+ */
+VectorView<StatementNumber> NextBipTable::viewAllNextBipStatementsTyped(StatementType previousType,
+                                                                        StatementType nextType) const
+{
+    return VectorView<StatementNumber>(stmtNextBipType[previousType].byType[nextType]);
+}
+
+/**
+ * Same as getAllNextBipTuples, but returns a view of the pairs in the table instead of a copy.
+ *
+ * @param previousType
+ * @param nextType
+ * @return
+ */
+VectorView<Pair<StatementNumber, StatementNumber>> NextBipTable::viewAllNextBipTuples(StatementType previousType,
+                                                                                      StatementType nextType) const
+{
+    return VectorView<Pair<StatementNumber, StatementNumber>>(followsTuples[previousType][nextType]);
+}
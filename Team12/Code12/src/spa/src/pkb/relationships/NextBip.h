@@ -15,13 +15,19 @@ public:
     Boolean checkIfNextBipHolds(StatementNumber prev, StatementNumber next);
     Vector<StatementNumber> getAllNextBipStatements(StatementNumber prev, StatementType nextType);
     Vector<StatementNumber> getAllPreviousBipStatements(StatementNumber next, StatementType prevType);
+    VectorView<StatementNumber> viewAllNextBipStatements(StatementNumber prev, StatementType nextType) const;
+    VectorView<StatementNumber> viewAllPreviousBipStatements(StatementNumber next, StatementType prevType) const;
 
     // Section 3: Collection table methods
     Vector<StatementNumber> getAllNextBipStatementsTyped(StatementType prevType, StatementType nextType);
     Vector<StatementNumber> getAllPreviousBipStatementsTyped(StatementType prevType, StatementType nextType);
+    VectorView<StatementNumber> viewAllNextBipStatementsTyped(StatementType prevType, StatementType nextType) const;
+    VectorView<StatementNumber> viewAllPreviousBipStatementsTyped(StatementType prevType, StatementType nextType) const;
 
     // Section 4: Tuple methods
     Vector<Pair<StatementNumber, StatementNumber>> getAllNextBipTuples(StatementType prevType, StatementType nextType);
+    VectorView<Pair<StatementNumber, StatementNumber>> viewAllNextBipTuples(StatementType prevType,
+                                                                            StatementType nextType) const;
 
 private:
     // Table and inverse tables
@@ -334,3 +334,29 @@ Vector<Pair<StatementNumber, StatementNumber>> ParentTable::getAllParentTupleSta
 {
     return parentStarTuples[stmtTypeOfParent][stmtTypeOfChild];
 }
+
+/**
+ * Same as getAllParentTuple, but returns a view of the pairs in the table instead of a copy.
+ *
+ * @param stmtTypeOfParent
+ * @param stmtTypeOfChild
+ * @return
+ */
+VectorView<Pair<StatementNumber, StatementNumber>> ParentTable::viewAllParentTuple(StatementType stmtTypeOfParent,
+                                                                                   StatementType stmtTypeOfChild) const
+{
+    return VectorView<Pair<StatementNumber, StatementNumber>>(parentTuples[stmtTypeOfParent][stmtTypeOfChild]);
+}
+
+/**
+ * Same as getAllParentTupleStar, but returns a view of the pairs in the table instead of a copy.
+ *
+ * @param stmtTypeOfParent
+ * @param stmtTypeOfChild
+ * @return
+ */
+VectorView<Pair<StatementNumber, StatementNumber>>
+ParentTable::viewAllParentTupleStar(StatementType stmtTypeOfParent, StatementType stmtTypeOfChild) const
+{
+    return VectorView<Pair<StatementNumber, StatementNumber>>(parentStarTuples[stmtTypeOfParent][stmtTypeOfChild]);
+}
@@ -35,6 +35,10 @@ public:
                                                                      StatementType stmtTypeOfChild);
     Vector<Pair<StatementNumber, StatementNumber>> getAllParentTupleStar(StatementType stmtTypeOfParent,
                                                                          StatementType stmtTypeOfChild);
+    VectorView<Pair<StatementNumber, StatementNumber>> viewAllParentTuple(StatementType stmtTypeOfParent,
+                                                                          StatementType stmtTypeOfChild) const;
+    VectorView<Pair<StatementNumber, StatementNumber>> viewAllParentTupleStar(StatementType stmtTypeOfParent,
+                                                                              StatementType stmtTypeOfChild) const;
 
 private:
     // Table and inverse tables
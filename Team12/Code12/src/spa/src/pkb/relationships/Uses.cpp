@@ -98,6 +98,11 @@ Vector<String> UsesTable::getUsesVariablesFromStatement(Integer stmt)
 {
     return stmtVarlistMap[stmt];
 }
+VectorView<String> UsesTable::viewUsesVariablesFromStatement(Integer stmt) const
+{
+    auto position = stmtVarlistMap.find(stmt);
+    return position == stmtVarlistMap.end() ? VectorView<String>() : VectorView<String>(position->second);
+}
 Vector<String> UsesTable::getUsesVariablesFromProcedure(const String& procName)
 {
     return procVarlistMap[procName];
@@ -122,6 +127,10 @@ Vector<Pair<Integer, String>> UsesTable::getAllUsesStatementTuple(StatementType
 {
     return statementTuples[stmtType];
 }
+VectorView<Pair<Integer, String>> UsesTable::viewAllUsesStatementTuple(StatementType stmtType) const
+{
+    return VectorView<Pair<Integer, String>>(statementTuples[stmtType]);
+}
 Vector<Pair<String, String>> UsesTable::getAllUsesProcedureTuple()
 {
     return procTuples;
@@ -18,12 +18,14 @@ public:
     Vector<Integer> getUsesStatements(const String& varName, StatementType stmtType);
     Vector<String> getUsesProcedures(const String& varName);
     Vector<String> getUsesVariablesFromStatement(Integer stmt);
+    VectorView<String> viewUsesVariablesFromStatement(Integer stmt) const;
     Vector<String> getUsesVariablesFromProcedure(const String& procName);
     Vector<Integer> getAllUsesStatements(StatementType stmtType);
     Vector<String> getAllUsesVariablesFromStatementType(StatementType stmtType);
     Vector<String> getAllUsesVariablesFromProgram();
     Vector<String> getAllUsesProcedures();
     Vector<Pair<Integer, String>> getAllUsesStatementTuple(StatementType stmtType);
+    VectorView<Pair<Integer, String>> viewAllUsesStatementTuple(StatementType stmtType) const;
     Vector<Pair<String, String>> getAllUsesProcedureTuple();
 
 private:
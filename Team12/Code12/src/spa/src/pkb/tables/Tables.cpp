@@ -13,6 +13,11 @@ std::vector<String> ProcedureTable::getAllProcedures()
     return listOfProcedureNames;
 }
 
+VectorView<String> ProcedureTable::viewAllProcedures() const
+{
+    return VectorView<String>(listOfProcedureNames);
+}
+
 Boolean ProcedureTable::isProcedureInProgram(const String& procName)
 {
     return setOfProceduresNames.find(procName) != setOfProceduresNames.end();
@@ -93,6 +98,10 @@ Vector<String> VariableTable::getAllVariables()
 {
     return listOfVariables;
 }
+VectorView<String> VariableTable::viewAllVariables() const
+{
+    return VectorView<String>(listOfVariables);
+}
 Boolean VariableTable::isVariableInProgram(const String& varName)
 {
     return setOfVariables.find(varName) != setOfVariables.end();
@@ -136,6 +145,16 @@ Vector<Integer> StatementTable::getAllStatements(StatementType stmtType)
     return listOfAllStatement.byType[stmtType];
 }
 
+/**
+ * Gets a view of all statements of a statement type, without copying them.
+ *
+ * @param stmtType Type of the statements, or AnyStatement for all statements.
+ */
+VectorView<Integer> StatementTable::viewAllStatements(StatementType stmtType) const
+{
+    return VectorView<Integer>(listOfAllStatement.byType[stmtType]);
+}
+
 /**
  * For Call Statements only. For other statement types, use the overloaded method of the same name with second argument
  * as StatementType.
@@ -225,6 +244,53 @@ StatementType StatementTable::getStatementType(StatementNumber stmtNum)
     return statementTypes.find(stmtNum)->second;
 }
 
+// Attribute Table
+AttributeTable::AttributeTable(): attributeNames({String()}), attributeIds(), statementAttributes() {}
+
+/**
+ * Inserts the name of the procedure called by a call statement,
+ * or the variable read or printed by a read or print statement.
+ *
+ * @param stmtNum Statement number of the statement.
+ * @param name Name of the attribute of the statement.
+ */
+void AttributeTable::insertIntoAttributeTable(StatementNumber stmtNum, const String& name)
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    assert(stmtNum >= 1 && "Statement number must be a natural number between 1 and 2^31-1");
+    auto position = attributeIds.find(name);
+    size_t id;
+    if (position == attributeIds.end()) {
+        id = attributeNames.size();
+        attributeNames.push_back(name);
+        attributeIds.insert({name, id});
+    } else {
+        id = position->second;
+    }
+    size_t index = static_cast<size_t>(stmtNum);
+    if (index >= statementAttributes.size()) {
+        statementAttributes.resize(index + 1, 0);
+    }
+    statementAttributes[index] = id;
+}
+
+/**
+ * Given a call, read or print statement, returns the name of the procedure
+ * called or the variable read or printed. The name is empty if the
+ * statement number is invalid or not of a call, read or print statement.
+ *
+ * @param stmtNum Statement number of the statement.
+ * @return Name of the attribute of the statement.
+ */
+const String& AttributeTable::getStatementAttribute(StatementNumber stmtNum) const
+{
+    size_t index = static_cast<size_t>(stmtNum);
+    if (stmtNum < 1 || index >= statementAttributes.size()) {
+        return attributeNames[0];
+    }
+    return attributeNames[statementAttributes[index]];
+}
+
 // Constant Table
 void ConstantTable::insertIntoConstantTable(Integer constant)
 {
@@ -241,3 +307,7 @@ Vector<Integer> ConstantTable::getAllConstants()
 {
     return listOfConstants;
 }
+VectorView<Integer> ConstantTable::viewAllConstants() const
+{
+    return VectorView<Integer>(listOfConstants);
+}
@@ -14,6 +14,7 @@ class ProcedureTable {
 public:
     void insertIntoProcedureTable(const String& procName, StatementNumber firstStmtNum, StatementNumber lastStmtNum);
     Vector<String> getAllProcedures();
+    VectorView<String> viewAllProcedures() const;
     Boolean isProcedureInProgram(const String& procName);
     StatementNumberRange getStatementRangeByProcedure(const ProcedureName& procedureName);
     Vector<ProcedureName> getContainingProcedure(StatementNumber statementNumber);
@@ -30,6 +31,7 @@ public:
     void insertIntoVariableTable(const String& varName);
     Boolean isVariableInProgram(const String& varName);
     Vector<String> getAllVariables();
+    VectorView<String> viewAllVariables() const;
 
 private:
     Vector<String> listOfVariables; // getAllVar
@@ -41,6 +43,7 @@ public:
     void insertIntoStatementTable(Integer stmtNum, StatementType stmtType);
     Boolean isStatementInProgram(Integer stmtNum);
     Vector<Integer> getAllStatements(StatementType stmtType);
+    VectorView<Integer> viewAllStatements(StatementType stmtType) const;
     // Iteration 2
     void insertIntoStatementTable(Integer stmtNum, const ProcedureName& procName);
     Vector<String> getProcedureCalled(Integer callStmtNum);
@@ -61,11 +64,29 @@ private:
     HashMap<ProcedureName, HashSet<StatementNumber>> stmtsCallingSet; // de-duplication
 };
 
+/**
+ * Names of the attributes of call, read and print statements
+ * (call.procName, read.varName and print.varName), with the
+ * name of each statement looked up by its statement number.
+ */
+class AttributeTable {
+public:
+    AttributeTable();
+    void insertIntoAttributeTable(StatementNumber stmtNum, const String& name);
+    const String& getStatementAttribute(StatementNumber stmtNum) const;
+
+private:
+    Vector<String> attributeNames;        // name of each id, with no name at id 0
+    HashMap<String, size_t> attributeIds; // id of each name
+    Vector<size_t> statementAttributes;   // id of the name of each statement, by statement number
+};
+
 class ConstantTable {
 public:
     void insertIntoConstantTable(Integer constant);
     Boolean isConstantInProgram(Integer constant);
     Vector<Integer> getAllConstants();
+    VectorView<Integer> viewAllConstants() const;
 
 private:
     Vector<Integer> listOfConstants; // getAllConstants
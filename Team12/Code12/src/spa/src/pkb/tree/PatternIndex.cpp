@@ -0,0 +1,314 @@
+/**
+ * Implementation of the index of the expressions
+ * in the assignment statements of a program.
+ */
+
+#include "PatternIndex.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+const size_t PatternIndex::NoExpression = std::numeric_limits<size_t>::max();
+
+// Empty list of statements, for expressions that are not indexed
+const Vector<StatementNumber> NoStatements;
+
+bool PatternIndex::ArithmeticKey::operator==(const ArithmeticKey& other) const
+{
+    return opr == other.opr && leftIndex == other.leftIndex && rightIndex == other.rightIndex;
+}
+
+size_t PatternIndex::ArithmeticKeyHash::operator()(const ArithmeticKey& key) const
+{
+    size_t hash = std::hash<size_t>()(key.leftIndex);
+    hash = hash * 31 + std::hash<size_t>()(key.rightIndex);
+    return hash * 31 + static_cast<size_t>(key.opr);
+}
+
+PatternIndex::PatternIndex(): numberOfExpressions(0), containersUsing(), allContainers() {}
+
+void PatternIndex::addProgram(const ProgramNode& program)
+{
+    for (const std::unique_ptr<ProcedureNode>& procedure : program.procedureList) {
+        addStatementList(*procedure->statementListNode);
+    }
+}
+
+void PatternIndex::addStatementList(const StmtlstNode& stmtLstNode)
+{
+    for (const std::unique_ptr<StatementNode>& statement : stmtLstNode.statementList) {
+        switch (statement->getStatementType()) {
+        case AssignmentStatement: {
+            // NOLINTNEXTLINE
+            const auto* assign = static_cast<const AssignmentStatementNode*>(statement.get());
+            addAssignment(assign->getStatementNumber(), assign->variable.varName, assign->expression);
+            break;
+        }
+        case IfStatement: {
+            // NOLINTNEXTLINE
+            const auto* ifStatement = static_cast<const IfStatementNode*>(statement.get());
+            addContainer(ifStatement->getStatementNumber(), IfStatement, ifStatement->predicate);
+            addStatementList(*ifStatement->ifStatementList);
+            addStatementList(*ifStatement->elseStatementList);
+            break;
+        }
+        case WhileStatement: {
+            // NOLINTNEXTLINE
+            const auto* whileStatement = static_cast<const WhileStatementNode*>(statement.get());
+            addContainer(whileStatement->getStatementNumber(), WhileStatement, whileStatement->predicate);
+            addStatementList(*whileStatement->statementList);
+            break;
+        }
+        default:
+            break;
+        }
+    }
+}
+
+void PatternIndex::addAssignment(StatementNumber stmtNum, const Name& variable, const Expression* expression)
+{
+    Vector<size_t> subexpressionIndexes;
+    size_t expressionIndex = internExpression(expression, subexpressionIndexes);
+    assignsWithExpression[expressionIndex].push_back(stmtNum);
+    for (size_t subexpressionIndex : subexpressionIndexes) {
+        Vector<StatementNumber>& assigns = assignsWithSubexpression[subexpressionIndex];
+        // a subexpression may appear more than once in the same statement
+        if (assigns.empty() || assigns.back() != stmtNum) {
+            assigns.push_back(stmtNum);
+        }
+    }
+    allAssigns.push_back(stmtNum);
+    assignedVariables.insert({stmtNum, variable});
+    assignsModifying[internVariable(variable)].push_back(stmtNum);
+}
+
+/**
+ * Adds the variables used in an expression
+ * to a list, if they are not in it already.
+ */
+void addVariablesInExpression(const Expression* expression, Vector<Name>& variables)
+{
+    if (expression->isArithmetic()) {
+        // NOLINTNEXTLINE
+        const auto* arithmetic = static_cast<const ArithmeticExpression*>(expression);
+        addVariablesInExpression(arithmetic->leftFactor, variables);
+        addVariablesInExpression(arithmetic->rightFactor, variables);
+        return;
+    }
+    // NOLINTNEXTLINE
+    const BasicDataType* data = static_cast<const ReferenceExpression*>(expression)->basicData;
+    if (data->isConstant()) {
+        return;
+    }
+    // NOLINTNEXTLINE
+    const Name& variable = static_cast<const Variable*>(data)->varName;
+    // conditions only use a few variables, so a list is searched
+    if (std::find(variables.begin(), variables.end(), variable) == variables.end()) {
+        variables.push_back(variable);
+    }
+}
+
+/**
+ * Adds the variables used in a condition
+ * to a list, if they are not in it already.
+ */
+void addVariablesInCondition(const ConditionalExpression* condition, Vector<Name>& variables)
+{
+    switch (condition->getConditionalType()) {
+    case NotConditionalExpression:
+        // NOLINTNEXTLINE
+        addVariablesInCondition(static_cast<const NotExpression*>(condition)->expression, variables);
+        break;
+    case AndConditionalExpression: {
+        // NOLINTNEXTLINE
+        const auto* andExpr = static_cast<const AndExpression*>(condition);
+        addVariablesInCondition(andExpr->leftExpression, variables);
+        addVariablesInCondition(andExpr->rightExpression, variables);
+        break;
+    }
+    case OrConditionalExpression: {
+        // NOLINTNEXTLINE
+        const auto* orExpr = static_cast<const OrExpression*>(condition);
+        addVariablesInCondition(orExpr->leftExpression, variables);
+        addVariablesInCondition(orExpr->rightExpression, variables);
+        break;
+    }
+    case RelationalConditionalExpression: {
+        // NOLINTNEXTLINE
+        const auto* relExpr = static_cast<const RelationalExpression*>(condition);
+        addVariablesInExpression(relExpr->leftFactor, variables);
+        addVariablesInExpression(relExpr->rightFactor, variables);
+        break;
+    }
+    default:
+        throw std::runtime_error("Unknown expression type in PatternIndex addVariablesInCondition");
+    }
+}
+
+void PatternIndex::addContainer(StatementNumber stmtNum, StatementType type, const ConditionalExpression* condition)
+{
+    size_t containers = getContainers(type);
+    Vector<Name> variables;
+    addVariablesInCondition(condition, variables);
+    for (const Name& variable : variables) {
+        containersUsing[containers][internVariable(variable)].push_back(stmtNum);
+    }
+    allContainers[containers].push_back(stmtNum);
+    controlVariables.insert({stmtNum, std::move(variables)});
+}
+
+/**
+ * Gets the index of a variable, giving it the next index if it is new.
+ */
+size_t PatternIndex::internVariable(const Name& variable)
+{
+    auto inserted = variableIds.insert({variable, assignsModifying.size()});
+    if (inserted.second) {
+        assignsModifying.emplace_back();
+        containersUsing[IfContainers].emplace_back();
+        containersUsing[WhileContainers].emplace_back();
+    }
+    return inserted.first->second;
+}
+
+/**
+ * Gets the statements of a variable from a list
+ * of statements by the index of the variable.
+ */
+const Vector<StatementNumber>&
+PatternIndex::findStatementsOfVariable(const Vector<Vector<StatementNumber>>& statements, const Name& variable) const
+{
+    auto variableId = variableIds.find(variable);
+    return variableId == variableIds.end() ? NoStatements : statements[variableId->second];
+}
+
+/**
+ * Gets the index of the arrays of if or while statements
+ * for a type of container statement.
+ */
+size_t PatternIndex::getContainers(StatementType type)
+{
+    switch (type) {
+    case IfStatement:
+        return IfContainers;
+    case WhileStatement:
+        return WhileContainers;
+    default:
+        throw std::runtime_error("Statement type is not a container in PatternIndex getContainers");
+    }
+}
+
+/**
+ * Finds the index of an expression, giving it and any of its
+ * subexpressions that are new the next indexes.
+ *
+ * @param expression The expression to intern.
+ * @param subexpressionIndexes List to add the index of the
+ *                             expression and every subexpression to.
+ * @return The index of the expression.
+ */
+size_t PatternIndex::internExpression(const Expression* expression, Vector<size_t>& subexpressionIndexes)
+{
+    size_t index = numberOfExpressions;
+    if (expression->isArithmetic()) {
+        // NOLINTNEXTLINE
+        const auto* arithmetic = static_cast<const ArithmeticExpression*>(expression);
+        ArithmeticKey key{arithmetic->opr, internExpression(arithmetic->leftFactor, subexpressionIndexes),
+                          internExpression(arithmetic->rightFactor, subexpressionIndexes)};
+        index = arithmeticIndexes.insert({key, numberOfExpressions}).first->second;
+    } else {
+        // NOLINTNEXTLINE
+        const BasicDataType* data = static_cast<const ReferenceExpression*>(expression)->basicData;
+        if (data->isConstant()) {
+            // NOLINTNEXTLINE
+            index = constantIndexes.insert({static_cast<const Constant*>(data)->value, numberOfExpressions})
+                        .first->second;
+        } else {
+            // NOLINTNEXTLINE
+            index = variableIndexes.insert({static_cast<const Variable*>(data)->varName, numberOfExpressions})
+                        .first->second;
+        }
+    }
+    if (index == numberOfExpressions) {
+        numberOfExpressions++;
+        assignsWithExpression.emplace_back();
+        assignsWithSubexpression.emplace_back();
+    }
+    subexpressionIndexes.push_back(index);
+    return index;
+}
+
+/**
+ * Finds the index of an expression, without interning it.
+ *
+ * @return The index of the expression, or NoExpression if
+ *         it is not in any assignment statement indexed.
+ */
+size_t PatternIndex::findExpression(const Expression* expression) const
+{
+    if (expression->isArithmetic()) {
+        // NOLINTNEXTLINE
+        const auto* arithmetic = static_cast<const ArithmeticExpression*>(expression);
+        size_t leftIndex = findExpression(arithmetic->leftFactor);
+        size_t rightIndex = leftIndex == NoExpression ? NoExpression : findExpression(arithmetic->rightFactor);
+        if (rightIndex == NoExpression) {
+            return NoExpression;
+        }
+        auto arithmeticIndex = arithmeticIndexes.find(ArithmeticKey{arithmetic->opr, leftIndex, rightIndex});
+        return arithmeticIndex == arithmeticIndexes.end() ? NoExpression : arithmeticIndex->second;
+    }
+    // NOLINTNEXTLINE
+    const BasicDataType* data = static_cast<const ReferenceExpression*>(expression)->basicData;
+    if (data->isConstant()) {
+        // NOLINTNEXTLINE
+        auto constantIndex = constantIndexes.find(static_cast<const Constant*>(data)->value);
+        return constantIndex == constantIndexes.end() ? NoExpression : constantIndex->second;
+    }
+    // NOLINTNEXTLINE
+    auto variableIndex = variableIndexes.find(static_cast<const Variable*>(data)->varName);
+    return variableIndex == variableIndexes.end() ? NoExpression : variableIndex->second;
+}
+
+const Vector<StatementNumber>& PatternIndex::getAllAssigns() const
+{
+    return allAssigns;
+}
+
+const Name& PatternIndex::getAssignedVariable(StatementNumber stmtNum) const
+{
+    return assignedVariables.at(stmtNum);
+}
+
+const Vector<StatementNumber>& PatternIndex::getAssignsModifying(const Name& variable) const
+{
+    return findStatementsOfVariable(assignsModifying, variable);
+}
+
+const Vector<StatementNumber>& PatternIndex::getAssignsWithExpression(const Expression* expression) const
+{
+    size_t index = findExpression(expression);
+    return index == NoExpression ? NoStatements : assignsWithExpression[index];
+}
+
+const Vector<StatementNumber>& PatternIndex::getAssignsWithSubexpression(const Expression* expression) const
+{
+    size_t index = findExpression(expression);
+    return index == NoExpression ? NoStatements : assignsWithSubexpression[index];
+}
+
+const Vector<StatementNumber>& PatternIndex::getAllContainers(StatementType type) const
+{
+    return allContainers[getContainers(type)];
+}
+
+const Vector<StatementNumber>& PatternIndex::getContainersUsing(StatementType type, const Name& variable) const
+{
+    return findStatementsOfVariable(containersUsing[getContainers(type)], variable);
+}
+
+const Vector<Name>& PatternIndex::getControlVariables(StatementNumber stmtNum) const
+{
+    return controlVariables.at(stmtNum);
+}
@@ -0,0 +1,126 @@
+/**
+ * Index of the expressions in the assignment statements, and
+ * of the variables in the conditions of if and while statements,
+ * of a program, used to match patterns without searching
+ * through the Abstract Syntax Tree.
+ */
+
+#ifndef SPA_PKB_PATTERN_INDEX_H
+#define SPA_PKB_PATTERN_INDEX_H
+
+#include <array>
+
+#include "pkb/PkbTypes.h"
+
+/**
+ * Every expression and subexpression of the assignment statements
+ * is hash-consed, so that equal expressions share a single index
+ * no matter where they appear. Each index then lists the
+ * assignment statements with that exact expression, and the
+ * assignment statements with that expression somewhere in them.
+ *
+ * An expression from a query is matched by finding its index,
+ * which only looks up the parts of the query expression, and
+ * then reading the list of the index.
+ *
+ * Each variable also lists the assignment statements that assign
+ * to it, and the if and while statements that use it in their
+ * condition, so that patterns with a known variable only need
+ * the statements of that variable.
+ */
+class PatternIndex {
+public:
+    PatternIndex();
+
+    // Indexes the assignment statements in all procedures of a program.
+    void addProgram(const ProgramNode& program);
+
+    /**
+     * Indexes an assignment statement. Statements should
+     * be added in ascending order of statement numbers,
+     * so that the lists of statements are sorted.
+     *
+     * @param stmtNum The statement number of the assignment.
+     * @param variable The variable assigned to.
+     * @param expression The expression that is assigned.
+     */
+    void addAssignment(StatementNumber stmtNum, const Name& variable, const Expression* expression);
+
+    /**
+     * Indexes an if or while statement by the variables used in
+     * its condition. Statements should be added in ascending order
+     * of statement numbers, so that the lists of statements are sorted.
+     *
+     * @param stmtNum The statement number of the container statement.
+     * @param type IfStatement or WhileStatement.
+     * @param condition The condition of the container statement.
+     */
+    void addContainer(StatementNumber stmtNum, StatementType type, const ConditionalExpression* condition);
+
+    // Gets all assignment statements indexed.
+    const Vector<StatementNumber>& getAllAssigns() const;
+    // Gets the variable assigned to by an assignment statement indexed.
+    const Name& getAssignedVariable(StatementNumber stmtNum) const;
+    // Gets the assignment statements that assign to a variable.
+    const Vector<StatementNumber>& getAssignsModifying(const Name& variable) const;
+    // Gets the assignment statements whose expression is equal to an expression.
+    const Vector<StatementNumber>& getAssignsWithExpression(const Expression* expression) const;
+    // Gets the assignment statements with an expression as a subexpression, or as the whole expression.
+    const Vector<StatementNumber>& getAssignsWithSubexpression(const Expression* expression) const;
+
+    // Gets all if or while statements indexed.
+    const Vector<StatementNumber>& getAllContainers(StatementType type) const;
+    // Gets the if or while statements that use a variable in their condition.
+    const Vector<StatementNumber>& getContainersUsing(StatementType type, const Name& variable) const;
+    // Gets the variables used in the condition of an if or while statement indexed, without duplicates.
+    const Vector<Name>& getControlVariables(StatementNumber stmtNum) const;
+
+private:
+    // Index of an expression that is not in any assignment statement
+    static const size_t NoExpression;
+
+    // An arithmetic expression, by the indexes of its two factors
+    struct ArithmeticKey {
+        ExpressionOperator opr;
+        size_t leftIndex;
+        size_t rightIndex;
+
+        bool operator==(const ArithmeticKey& other) const;
+    };
+    struct ArithmeticKeyHash {
+        size_t operator()(const ArithmeticKey& key) const;
+    };
+
+    HashMap<Name, size_t> variableIndexes;
+    HashMap<Integer, size_t> constantIndexes;
+    std::unordered_map<ArithmeticKey, size_t, ArithmeticKeyHash> arithmeticIndexes;
+    size_t numberOfExpressions;
+
+    // assignment statements by the index of their whole expression
+    Vector<Vector<StatementNumber>> assignsWithExpression;
+    // assignment statements by the index of each of their subexpressions
+    Vector<Vector<StatementNumber>> assignsWithSubexpression;
+    Vector<StatementNumber> allAssigns;
+    HashMap<StatementNumber, Name> assignedVariables;
+
+    // Indexes of if statements and while statements in the arrays below
+    static const size_t IfContainers = 0;
+    static const size_t WhileContainers = 1;
+
+    // statements of each variable, by the index of the variable
+    HashMap<Name, size_t> variableIds;
+    Vector<Vector<StatementNumber>> assignsModifying;
+    std::array<Vector<Vector<StatementNumber>>, 2> containersUsing;
+    std::array<Vector<StatementNumber>, 2> allContainers;
+    HashMap<StatementNumber, Vector<Name>> controlVariables;
+
+    size_t internExpression(const Expression* expression, Vector<size_t>& subexpressionIndexes);
+    size_t findExpression(const Expression* expression) const;
+    size_t internVariable(const Name& variable);
+    const Vector<StatementNumber>& findStatementsOfVariable(const Vector<Vector<StatementNumber>>& statements,
+                                                            const Name& variable) const;
+    static size_t getContainers(StatementType type);
+    void addStatementList(const StmtlstNode& stmtLstNode);
+};
+
+#endif // SPA_PKB_PATTERN_INDEX_H
@@ -6,12 +6,32 @@
 #include "TreeStore.h"
 
 #include <iterator>
+#include <utility>
 
 // Instantiate a new TreeStore
 TreeStore::TreeStore():
-    rootNode(nullptr), cfgByProcedure(), proceduresWithCfg(), cfgBipByProcedure(), proceduresWithCfgBip()
+    rootNode(nullptr), patternIndex(), cfgByProcedure(), proceduresWithCfg(), flatCfgByProcedure(), flatCfgByStatement(),
+    cfgBip()
 {}
 
+/**
+ * Adds the nodes of a CFG to a set of nodes to be deleted,
+ * unless the CFG was allocated in the arena of a program,
+ * in which case it is freed together with the program.
+ *
+ * @param cfgRootNode Root node of the CFG.
+ * @param nodesToDelete Set of nodes to be deleted.
+ */
+void collectNodesToDelete(CfgNode* cfgRootNode, std::unordered_set<CfgNode*>& nodesToDelete)
+{
+    if (ArenaAllocated::getOwningArena(cfgRootNode) != nullptr) {
+        return;
+    }
+    std::vector<CfgNode*> childNodes = cfgRootNode->findAllChildren();
+    std::copy(childNodes.begin(), childNodes.end(), std::inserter(nodesToDelete, nodesToDelete.begin()));
+    nodesToDelete.insert(cfgRootNode);
+}
+
 // Clear all the trees when deleted
 TreeStore::~TreeStore()
 {
@@ -19,31 +39,53 @@ TreeStore::~TreeStore()
     std::unordered_set<CfgNode*> nodesToDelete;
     // traverse CFG
     for (std::pair<ProcedureName, CfgNode*> mapEntry : cfgByProcedure) {
-        std::vector<CfgNode*> childNodes = mapEntry.second->findAllChildren();
-        std::copy(childNodes.begin(), childNodes.end(), std::inserter(nodesToDelete, nodesToDelete.begin()));
-    }
-    // traverse CFG BIP
-    for (std::pair<ProcedureName, CfgNode*> mapEntry : cfgBipByProcedure) {
-        std::vector<CfgNode*> childNodes = mapEntry.second->findAllChildren();
-        std::copy(childNodes.begin(), childNodes.end(), std::inserter(nodesToDelete, nodesToDelete.begin()));
+        collectNodesToDelete(mapEntry.second, nodesToDelete);
     }
     // delete the CFG nodes
     for (CfgNode* node : nodesToDelete) {
         delete node;
     }
-    // delete AST
+    // delete AST, along with its arena
     delete rootNode;
 }
 
+// Take over the trees of another TreeStore
+TreeStore::TreeStore(TreeStore&& other) noexcept: TreeStore()
+{
+    *this = std::move(other);
+}
+
+// Swap trees with another TreeStore, which will delete
+// the trees previously held by this one
+TreeStore& TreeStore::operator=(TreeStore&& other) noexcept
+{
+    std::swap(rootNode, other.rootNode);
+    std::swap(patternIndex, other.patternIndex);
+    std::swap(cfgByProcedure, other.cfgByProcedure);
+    std::swap(proceduresWithCfg, other.proceduresWithCfg);
+    std::swap(flatCfgByProcedure, other.flatCfgByProcedure);
+    std::swap(flatCfgByStatement, other.flatCfgByStatement);
+    std::swap(cfgBip, other.cfgBip);
+    return *this;
+}
+
 // AST RootNode
 void TreeStore::assignRootNode(ProgramNode* rootNodeToAssign)
 {
     rootNode = rootNodeToAssign;
+    patternIndex = PatternIndex();
+    if (rootNode != nullptr) {
+        patternIndex.addProgram(*rootNode);
+    }
 }
 ProgramNode* TreeStore::getRootNode()
 {
     return rootNode;
 }
+const PatternIndex& TreeStore::getPatternIndex() const
+{
+    return patternIndex;
+}
 
 // CFG
 void TreeStore::storeCFG(CfgNode* cfg, const ProcedureName& procedureName)
@@ -64,21 +106,49 @@ Vector<String> TreeStore::getProceduresWithCFG()
     return proceduresWithCfg;
 }
 
-// CFG Bip
-void TreeStore::storeCFGBip(CfgNode* cfgBip, const ProcedureName& procedureName)
+// Flat CFG
+void TreeStore::storeFlatCFG(const CfgNode* cfg, const ProcedureName& procedureName)
+{
+    storeFlatCFG(std::unique_ptr<FlatCfg>(new FlatCfg(cfg)), procedureName);
+}
+void TreeStore::storeFlatCFG(std::unique_ptr<FlatCfg> frozenCfg, const ProcedureName& procedureName)
 {
-    cfgBipByProcedure[procedureName] = cfgBip;
-    proceduresWithCfgBip.push_back(procedureName);
+    std::unique_ptr<FlatCfg>& flatCfg = flatCfgByProcedure[procedureName];
+    flatCfg = std::move(frozenCfg);
+    if (flatCfg->countStatements() == 0) {
+        return;
+    }
+    size_t lastStatement = static_cast<size_t>(flatCfg->getLastStatement());
+    if (flatCfgByStatement.size() <= lastStatement) {
+        flatCfgByStatement.resize(lastStatement + 1, nullptr);
+    }
+    for (StatementNumber stmtNum = flatCfg->getFirstStatement(); stmtNum <= flatCfg->getLastStatement(); stmtNum++) {
+        flatCfgByStatement[stmtNum] = flatCfg.get();
+    }
 }
-CfgNode* TreeStore::getCFGBip(const ProcedureName& procedureName)
+const FlatCfg* TreeStore::getFlatCFG(const ProcedureName& procedureName) const
 {
-    if (cfgBipByProcedure.find(procedureName) == cfgBipByProcedure.end()) {
+    auto flatCfg = flatCfgByProcedure.find(procedureName);
+    return flatCfg == flatCfgByProcedure.end() ? nullptr : flatCfg->second.get();
+}
+const FlatCfg* TreeStore::getFlatCFGOfStatement(StatementNumber stmtNum) const
+{
+    if (stmtNum < 0 || static_cast<size_t>(stmtNum) >= flatCfgByStatement.size()) {
         return nullptr;
-    } else {
-        return cfgBipByProcedure[procedureName];
     }
+    return flatCfgByStatement[stmtNum];
+}
+
+// CFG Bip
+void TreeStore::storeCFGBip()
+{
+    Vector<Pair<ProcedureName, const FlatCfg*>> procedureCfgs;
+    for (const std::pair<const ProcedureName, std::unique_ptr<FlatCfg>>& mapEntry : flatCfgByProcedure) {
+        procedureCfgs.emplace_back(mapEntry.first, mapEntry.second.get());
+    }
+    cfgBip = std::unique_ptr<BipSupergraph>(new BipSupergraph(procedureCfgs));
 }
-Vector<String> TreeStore::getProceduresWithCFGBip()
+const BipSupergraph* TreeStore::getCFGBip() const
 {
-    return proceduresWithCfgBip;
+    return cfgBip.get();
 }
@@ -6,32 +6,44 @@
 #ifndef SPA_PKB_TREE_STORE_H
 #define SPA_PKB_TREE_STORE_H
 
+#include <memory>
+
+#include "PatternIndex.h"
+#include "cfg/BipSupergraph.h"
 #include "cfg/CfgTypes.h"
+#include "cfg/FlatCfg.h"
 #include "pkb/PkbTypes.h"
 
 class TreeStore {
 private:
     // AST
     ProgramNode* rootNode;
+    // Expressions of the assignment statements in the AST
+    PatternIndex patternIndex;
     // CFG
     HashMap<ProcedureName, CfgNode*> cfgByProcedure;
     Vector<ProcedureName> proceduresWithCfg;
-    // CFG BIP
-    HashMap<ProcedureName, CfgNode*> cfgBipByProcedure;
-    Vector<ProcedureName> proceduresWithCfgBip;
+    // Flat CFG, frozen from the CFG of each procedure
+    HashMap<ProcedureName, std::unique_ptr<FlatCfg>> flatCfgByProcedure;
+    // Flat CFG of the procedure containing each statement
+    Vector<const FlatCfg*> flatCfgByStatement;
+    // CFG BIP, linking the flat CFGs of all procedures
+    std::unique_ptr<BipSupergraph> cfgBip;
 
 public:
     TreeStore();
     ~TreeStore();
-    TreeStore(const TreeStore&) = default;
-    TreeStore(TreeStore&&) = delete;
-    TreeStore& operator=(const TreeStore&) = default;
-    TreeStore& operator=(TreeStore&&) = delete;
+    TreeStore(const TreeStore&) = delete;
+    TreeStore(TreeStore&& other) noexcept;
+    TreeStore& operator=(const TreeStore&) = delete;
+    TreeStore& operator=(TreeStore&& other) noexcept;
 
-    // Stores the AST root node in the PKB.
+    // Stores the AST root node in the PKB, and indexes its patterns.
     void assignRootNode(ProgramNode* rootNodeToAssign);
     // Gets the AST root node from the PKB.
     ProgramNode* getRootNode();
+    // Gets the index of the patterns in the AST.
+    const PatternIndex& getPatternIndex() const;
 
     // Stores the CFG root node in the PKB, for a procedure.
     void storeCFG(CfgNode* cfg, const ProcedureName& procedureName);
@@ -40,12 +52,19 @@ public:
     // Gets all procedures with a CFG node.
     Vector<String> getProceduresWithCFG();
 
-    // Stores the CFG with branching into procedures in the PKB, for a procedure.
-    void storeCFGBip(CfgNode* cfgBip, const ProcedureName& procedureName);
-    // Gets the CFG with branching into procedures in the PKB, for a procedure.
-    CfgNode* getCFGBip(const ProcedureName& procedureName);
-    // Gets all procedures with a CFG node branching into procedures.
-    Vector<String> getProceduresWithCFGBip();
+    // Freezes the CFG of a procedure into a flat CFG, and stores it in the PKB.
+    void storeFlatCFG(const CfgNode* cfg, const ProcedureName& procedureName);
+    // Stores a flat CFG that was already frozen in the PKB, for a procedure.
+    void storeFlatCFG(std::unique_ptr<FlatCfg> flatCfg, const ProcedureName& procedureName);
+    // Gets the flat CFG in the PKB, for a procedure.
+    const FlatCfg* getFlatCFG(const ProcedureName& procedureName) const;
+    // Gets the flat CFG in the PKB, for the procedure containing a statement.
+    const FlatCfg* getFlatCFGOfStatement(StatementNumber stmtNum) const;
+
+    // Links the flat CFGs stored into the CFG with branching into procedures, and stores it in the PKB.
+    void storeCFGBip();
+    // Gets the CFG with branching into procedures in the PKB, or nullptr if it was not stored.
+    const BipSupergraph* getCFGBip() const;
 };
 
 #endif // SPA_PKB_TREE_STORE_H
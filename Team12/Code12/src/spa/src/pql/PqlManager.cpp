@@ -5,37 +5,66 @@
 #include "PqlManager.h"
 
 #include "pql/evaluator/Evaluator.h"
-#include "pql/optimiser/Optimiser.h"
-#include "pql/preprocessor/Preprocessor.h"
 #include "pql/projector/Projector.h"
 
-FormattedQueryResult PqlManager::executeQuery(const String& query, QueryResultFormatType format, Ui& ui,
-                                              Boolean optimise)
+// maximum number of queries kept in the query cache
+const size_t QueryCacheCapacity = 1024;
+
+QueryCache& PqlManager::getQueryCache()
 {
-    // Call the Preprocessor to parse the query
-    AbstractQuery abstractQuery = Preprocessor::processQuery(query);
+    static QueryCache queryCache(QueryCacheCapacity);
+    return queryCache;
+}
 
-    if (optimise) {
-        // Optimise the query
-        optimiseQuery(abstractQuery);
-    }
+Void PqlManager::executeQuery(const String& query, ResultSink& sink, Ui& ui, Boolean optimise)
+{
+    executeQuery(query, sink, ui, optimise, NoRowLimit);
+}
+
+Void PqlManager::executeQuery(const String& query, ResultSink& sink, Ui& ui, Boolean optimise, size_t rowLimit)
+{
+    // Parse and optimise the query, unless it has been executed before
+    const AbstractQuery& abstractQuery = getQueryCache().getQueryPlan(query, optimise);
 
     /*
      * Pass the parsed query (AbstractQuery) to the PQL
      * query evaluator
      */
-    RawQueryResult rawQueryResult = evaluateQuery(abstractQuery);
+    RawQueryResult rawQueryResult = evaluateQuery(abstractQuery, rowLimit);
 
-    // Once, we have the result, format it then return the formatted results
+    // Once, we have the result, hand it to the sink
     Projector projector;
-    FormattedQueryResult formattedQueryResult = FormattedQueryResult::emptyFormattedQueryResult();
+    projector.projectResults(rawQueryResult, sink, ui);
+}
+
+FormattedQueryResult PqlManager::executeQuery(const String& query, QueryResultFormatType format, Ui& ui,
+                                              Boolean optimise)
+{
+    // Format the results into a single String
+    FormattedResultSink sink(format);
+    executeQuery(query, sink, ui, optimise);
+    return sink.getFormattedQueryResult();
+}
 
-    if (format == AutotesterFormat) {
-        formattedQueryResult = projector.formatAutotester(rawQueryResult, ui);
-    } else if (format == UiFormat) {
-        formattedQueryResult = projector.formatUI(rawQueryResult, ui);
-    }
+PreparedQuery PqlManager::prepareQuery(const String& query, Boolean optimise)
+{
+    return PreparedQuery(query, optimise);
+}
 
-    // Finally, return the formatted result
-    return formattedQueryResult;
+Void PqlManager::executePreparedQuery(PreparedQuery& preparedQuery, const Vector<String>& parameters, ResultSink& sink,
+                                      Ui& ui)
+{
+    // Bind the parameters, and evaluate with the caches of the previous executions
+    RawQueryResult rawQueryResult = preparedQuery.execute(parameters, NoRowLimit);
+
+    Projector projector;
+    projector.projectResults(rawQueryResult, sink, ui);
+}
+
+FormattedQueryResult PqlManager::executePreparedQuery(PreparedQuery& preparedQuery, const Vector<String>& parameters,
+                                                      QueryResultFormatType format, Ui& ui)
+{
+    FormattedResultSink sink(format);
+    executePreparedQuery(preparedQuery, parameters, sink, ui);
+    return sink.getFormattedQueryResult();
 }
@@ -7,12 +7,44 @@
 #define SPA_PQL_PQL_MANAGER_H
 
 #include "Types.h"
+#include "PreparedQuery.h"
+#include "QueryCache.h"
 #include "Ui.h"
 #include "projector/FormattedQueryResult.h"
 #include "projector/QueryResultFormatType.h"
+#include "projector/ResultSink.h"
 
 class PqlManager {
 public:
+    /**
+     * Executes a PQL query, and interacts with the PKB,
+     * for the results of that query, then moves every
+     * result into the sink once evaluation has finished.
+     *
+     * @param query The PQL query.
+     * @param sink The consumer of the results (Note: If
+     * either PQL query invalid, or is valid but yields
+     * no result, no results will be added to it).
+     * @param ui The UI to display errors to.
+     * @param optimise Whether Query Optimiser should be used
+     *                 to reorder clauses in this query.
+     */
+    static Void executeQuery(const String& query, ResultSink& sink, Ui& ui, Boolean optimise);
+
+    /**
+     * Executes a PQL query like executeQuery above, but stops
+     * once rowLimit results have been found. The remaining
+     * rows of the results are never enumerated.
+     *
+     * @param query The PQL query.
+     * @param sink The consumer of the results.
+     * @param ui The UI to display errors to.
+     * @param optimise Whether Query Optimiser should be used
+     *                 to reorder clauses in this query.
+     * @param rowLimit The maximum number of results to add to the sink.
+     */
+    static Void executeQuery(const String& query, ResultSink& sink, Ui& ui, Boolean optimise, size_t rowLimit);
+
     /**
      * Executes a PQL query, and interacts with the PKB,
      * for the results of that query.
@@ -30,6 +62,56 @@ public:
      */
     static FormattedQueryResult executeQuery(const String& query, QueryResultFormatType format, Ui& ui,
                                              Boolean optimise);
+
+    /**
+     * Prepares a PQL query with placeholders for its literals,
+     * such as "stmt s; Select s such that Next*(?, s)", so that
+     * it can be executed many times with different values.
+     *
+     * @param query The PQL query, with ? in place of each Integer,
+     *              and "?" in place of each name, to be bound.
+     * @param optimise Whether Query Optimiser should be used
+     *                 to reorder clauses in this query.
+     * @return The PreparedQuery, which is preprocessed and
+     *         optimised once for all of its executions.
+     */
+    static PreparedQuery prepareQuery(const String& query, Boolean optimise);
+
+    /**
+     * Executes a prepared PQL query with a value bound to each
+     * of its placeholders, then moves every result into the sink
+     * once evaluation has finished. The Next and Affects results cached by
+     * one execution are reused by the next, until the PKB changes.
+     *
+     * @param preparedQuery The query from prepareQuery.
+     * @param parameters The values of the placeholders, in order.
+     * @param sink The consumer of the results.
+     * @param ui The UI to display errors to.
+     */
+    static Void executePreparedQuery(PreparedQuery& preparedQuery, const Vector<String>& parameters, ResultSink& sink,
+                                     Ui& ui);
+
+    /**
+     * Executes a prepared PQL query with a value bound to each
+     * of its placeholders, like executePreparedQuery above.
+     *
+     * @param preparedQuery The query from prepareQuery.
+     * @param parameters The values of the placeholders, in order.
+     * @param format The format, to format the results.
+     * @param ui The UI to display errors to.
+     *
+     * @return FormattedQueryResult, representing the PQL query results.
+     */
+    static FormattedQueryResult executePreparedQuery(PreparedQuery& preparedQuery, const Vector<String>& parameters,
+                                                     QueryResultFormatType format, Ui& ui);
+
+    /**
+     * Gets the cache of the AbstractQuery of each PQL query
+     * executed, which counts how often queries are reused.
+     * The AbstractQuery does not depend on the PKB, so the
+     * cache does not have to be cleared when it changes.
+     */
+    static QueryCache& getQueryCache();
 };
 
 #endif // SPA_PQL_PQL_MANAGER_H
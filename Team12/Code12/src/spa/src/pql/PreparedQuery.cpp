@@ -0,0 +1,138 @@
+/**
+ * Implementation of a PQL query with placeholders.
+ */
+
+#include "PreparedQuery.h"
+
+#include <algorithm>
+
+#include "Util.h"
+#include "pql/optimiser/Optimiser.h"
+#include "pql/preprocessor/Preprocessor.h"
+
+PreparedQuery::PreparedQuery(const String& query, Boolean optimise):
+    abstractQuery(Preprocessor::processQueryWithPlaceholders(query)), placeholders(), parameterCount(0),
+    resultsTable()
+{
+    if (optimise) {
+        optimiseQuery(abstractQuery);
+    }
+    if (abstractQuery.isInvalid()) {
+        return;
+    }
+
+    /*
+     * Find the placeholders once the clauses have been reordered.
+     * The Optimiser may also have copied a placeholder into other
+     * clauses (e.g. with s.stmt# = ?), so one placeholder
+     * can be bound to more than one Reference.
+     */
+    const ClauseVector& clauses = abstractQuery.getClauses();
+    for (Integer i = 0; i < clauses.count(); i++) {
+        Clause* clause = clauses.get(i);
+        switch (clause->getType()) {
+        case SuchThatClauseType: {
+            // NOLINTNEXTLINE
+            Relationship& relationship = static_cast<SuchThatClause*>(clause)->getRelationshipUnsafe();
+            findPlaceholder(relationship.getLeftRef(), i, true);
+            findPlaceholder(relationship.getRightRef(), i, false);
+            break;
+        }
+        case PatternClauseType:
+            // NOLINTNEXTLINE
+            findPlaceholder(static_cast<PatternClause*>(clause)->getEntRef(), i, true);
+            break;
+        case WithClauseType: {
+            // NOLINTNEXTLINE
+            WithClause* withClause = static_cast<WithClause*>(clause);
+            findPlaceholder(withClause->getLeftReference(), i, true);
+            findPlaceholder(withClause->getRightReference(), i, false);
+            break;
+        }
+        case NonExistentClauseType:
+            break;
+        }
+    }
+
+    resultsTable = std::unique_ptr<ResultsTable>(new ResultsTable(abstractQuery.getDeclarationTable()));
+}
+
+size_t PreparedQuery::getParameterCount() const
+{
+    return parameterCount;
+}
+
+RawQueryResult PreparedQuery::execute(const Vector<String>& parameters, size_t rowLimit)
+{
+    if (abstractQuery.isInvalid()) {
+        return evaluateQuery(abstractQuery, rowLimit);
+    }
+
+    if (parameters.size() != parameterCount) {
+        return RawQueryResult::getSyntaxError("Expected " + std::to_string(parameterCount) + " parameters but found "
+                                              + std::to_string(parameters.size()));
+    }
+
+    for (const Placeholder& placeholder : placeholders) {
+        const String& value = parameters[placeholder.parameterIndex];
+        Boolean isValidValue = placeholder.referenceType == IntegerRefType ? util::isPossibleConstant(value)
+                                                                           : util::isPossibleIdentifier(value);
+        if (!isValidValue) {
+            return RawQueryResult::getSyntaxError("Invalid value for parameter "
+                                                  + std::to_string(placeholder.parameterIndex + 1) + ": " + value);
+        }
+
+        bindPlaceholder(placeholder, value);
+    }
+
+    return evaluateQuery(abstractQuery, *resultsTable, rowLimit);
+}
+
+Void PreparedQuery::findPlaceholder(const Reference& reference, size_t clauseIndex, Boolean isLeftReference)
+{
+    ReferenceType referenceType = reference.getReferenceType();
+    ReferenceValue value = reference.getValue();
+    if ((referenceType != IntegerRefType && referenceType != LiteralRefType) || value.empty()
+        || value[0] != Preprocessor::PlaceholderPrefix) {
+        return;
+    }
+
+    // the number of the placeholder follows the prefix, counting from 1
+    size_t parameterIndex = std::stoul(value.substr(1)) - 1;
+    placeholders.push_back(Placeholder{clauseIndex, isLeftReference, referenceType, parameterIndex});
+    parameterCount = std::max(parameterCount, parameterIndex + 1);
+}
+
+Void PreparedQuery::bindPlaceholder(const Placeholder& placeholder, const String& value)
+{
+    Reference reference(placeholder.referenceType, value);
+    Clause* clause = abstractQuery.getClauses().get(static_cast<Integer>(placeholder.clauseIndex));
+    switch (clause->getType()) {
+    case SuchThatClauseType: {
+        // NOLINTNEXTLINE
+        Relationship& relationship = static_cast<SuchThatClause*>(clause)->getRelationshipUnsafe();
+        if (placeholder.isLeftReference) {
+            relationship.setLeftRef(reference);
+        } else {
+            relationship.setRightRef(reference);
+        }
+        break;
+    }
+    case PatternClauseType:
+        // NOLINTNEXTLINE
+        static_cast<PatternClause*>(clause)->setEntRef(reference);
+        break;
+    case WithClauseType: {
+        // NOLINTNEXTLINE
+        WithClause* withClause = static_cast<WithClause*>(clause);
+        if (placeholder.isLeftReference) {
+            withClause->setLeftReference(reference);
+        } else {
+            withClause->setRightReference(reference);
+        }
+        break;
+    }
+    case NonExistentClauseType:
+        break;
+    }
+}
@@ -0,0 +1,73 @@
+/**
+ * A PQL query with placeholders, which is preprocessed
+ * and optimised once, then executed many times with
+ * different values bound to its placeholders.
+ */
+
+#ifndef SPA_PQL_PREPARED_QUERY_H
+#define SPA_PQL_PREPARED_QUERY_H
+
+#include <memory>
+
+#include "Types.h"
+#include "pql/evaluator/Evaluator.h"
+#include "pql/preprocessor/AqTypes.h"
+
+class PreparedQuery {
+public:
+    /**
+     * Preprocesses and optimises a PQL query with placeholders,
+     * such as "stmt s; Select s such that Next*(?, s)". The
+     * placeholders are ? in place of an Integer, and "?" in
+     * place of a name, and are numbered from 1 in the order
+     * that they appear in the query.
+     *
+     * If the query is invalid, executing it returns the error,
+     * like executing the query without placeholders would.
+     *
+     * @param query The PQL query with placeholders.
+     * @param optimise Whether the clauses of the query
+     *                 should be reordered by the Optimiser.
+     */
+    PreparedQuery(const String& query, Boolean optimise);
+
+    // Gets the number of placeholders in the query.
+    size_t getParameterCount() const;
+
+    /**
+     * Evaluates the query with a value bound to each of its
+     * placeholders. The Next and Affects results cached by
+     * the evaluation are kept for the next execution, so
+     * the query must be prepared again once the PKB changes.
+     *
+     * @param parameters The value of each placeholder, in order,
+     *                   which is an Integer for a ? placeholder,
+     *                   or a name for a "?" placeholder.
+     * @param rowLimit The maximum number of results to return.
+     * @return The results of the query, or a syntax error if the
+     *         parameters do not match the placeholders.
+     */
+    RawQueryResult execute(const Vector<String>& parameters, size_t rowLimit);
+
+private:
+    // A Reference in a Clause of the query that is a placeholder.
+    struct Placeholder {
+        size_t clauseIndex;
+        Boolean isLeftReference;
+        ReferenceType referenceType;
+        size_t parameterIndex;
+    };
+
+    AbstractQuery abstractQuery;
+    Vector<Placeholder> placeholders;
+    size_t parameterCount;
+    // kept between executions, along with the caches of its evaluators
+    std::unique_ptr<ResultsTable> resultsTable;
+
+    // Records the Reference as a placeholder, if it is one.
+    Void findPlaceholder(const Reference& reference, size_t clauseIndex, Boolean isLeftReference);
+    // Binds the value to the Reference of a placeholder.
+    Void bindPlaceholder(const Placeholder& placeholder, const String& value);
+};
+
+#endif // SPA_PQL_PREPARED_QUERY_H
@@ -0,0 +1,78 @@
+/**
+ * Implementation of the cache of preprocessed PQL queries.
+ */
+
+#include "QueryCache.h"
+
+#include "lexer/Lexer.h"
+#include "pql/optimiser/Optimiser.h"
+#include "pql/preprocessor/Preprocessor.h"
+
+QueryCache::QueryCache(size_t capacity): capacity(capacity), hits(0), misses(0), plans(), invalidPlan() {}
+
+const AbstractQuery& QueryCache::getQueryPlan(const String& query, Boolean optimise)
+{
+    String key = (optimise ? "1" : "0") + normaliseQuery(query);
+    auto cachedPlan = plans.find(key);
+    if (cachedPlan != plans.end()) {
+        hits++;
+        return *cachedPlan->second;
+    }
+
+    misses++;
+    std::unique_ptr<AbstractQuery> plan(new AbstractQuery(Preprocessor::processQuery(query)));
+    if (optimise) {
+        optimiseQuery(*plan);
+    }
+    if (plan->isInvalid()) {
+        // error messages quote the query as written, so they are not shared
+        invalidPlan = std::move(plan);
+        return *invalidPlan;
+    }
+    if (plans.size() >= capacity) {
+        plans.clear();
+    }
+    return *plans.emplace(std::move(key), std::move(plan)).first->second;
+}
+
+size_t QueryCache::getHits() const
+{
+    return hits;
+}
+
+size_t QueryCache::getMisses() const
+{
+    return misses;
+}
+
+size_t QueryCache::size() const
+{
+    return plans.size();
+}
+
+Void QueryCache::clear()
+{
+    plans.clear();
+    invalidPlan.reset();
+    hits = 0;
+    misses = 0;
+}
+
+String QueryCache::normaliseQuery(const String& query)
+{
+    String normalisedQuery;
+    normalisedQuery.reserve(query.size());
+    Boolean isAfterWhitespace = false;
+    for (char c : query) {
+        if (isWhitespace(&c)) {
+            isAfterWhitespace = true;
+            continue;
+        }
+        if (isAfterWhitespace && !normalisedQuery.empty()) {
+            normalisedQuery.push_back(' ');
+        }
+        isAfterWhitespace = false;
+        normalisedQuery.push_back(c);
+    }
+    return normalisedQuery;
+}
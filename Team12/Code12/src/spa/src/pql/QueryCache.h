@@ -0,0 +1,72 @@
+/**
+ * A cache of the AbstractQuery that each PQL query is
+ * preprocessed (and optimised) into, so that a query
+ * that is executed again skips both steps.
+ */
+
+#ifndef SPA_PQL_QUERY_CACHE_H
+#define SPA_PQL_QUERY_CACHE_H
+
+#include <memory>
+#include <unordered_map>
+
+#include "Types.h"
+#include "pql/preprocessor/AqTypes.h"
+
+class QueryCache {
+public:
+    /**
+     * Creates an empty cache, which holds the
+     * plans of at most capacity queries.
+     */
+    explicit QueryCache(size_t capacity);
+
+    /**
+     * Gets the AbstractQuery of a PQL query, preprocessing
+     * and optimising the query if it is not in the cache.
+     * Valid queries that only differ in their whitespace
+     * share the same AbstractQuery. Invalid queries are
+     * not cached, as their error messages quote the query.
+     *
+     * The cache is cleared once it is full, so the
+     * AbstractQuery returned is only valid until the
+     * next call to getQueryPlan or clear.
+     *
+     * @param query The PQL query.
+     * @param optimise Whether the clauses of the query
+     *                 should be reordered by the Optimiser.
+     * @return The AbstractQuery of the PQL query.
+     */
+    const AbstractQuery& getQueryPlan(const String& query, Boolean optimise);
+
+    // Gets the number of calls to getQueryPlan that found the query in the cache.
+    size_t getHits() const;
+
+    // Gets the number of calls to getQueryPlan that had to preprocess the query.
+    size_t getMisses() const;
+
+    // Gets the number of queries in the cache.
+    size_t size() const;
+
+    // Removes every query from the cache, and resets the counters.
+    Void clear();
+
+    /**
+     * Normalises the whitespace in a PQL query, by replacing every run of
+     * whitespace with a single space and removing it from both ends. The
+     * Preprocessor only distinguishes between whitespace and none, so a
+     * valid normalised query has the same AbstractQuery as the original.
+     */
+    static String normaliseQuery(const String& query);
+
+private:
+    size_t capacity;
+    size_t hits;
+    size_t misses;
+    // plans by whether they were optimised, followed by the normalised query
+    std::unordered_map<String, std::unique_ptr<AbstractQuery>> plans;
+    // the last invalid query, which is not cached
+    std::unique_ptr<AbstractQuery> invalidPlan;
+};
+
+#endif // SPA_PQL_QUERY_CACHE_H
@@ -4,8 +4,8 @@
 
 #include "Evaluator.h"
 
-#include <sstream>
 #include <stdexcept>
+#include <unordered_set>
 #include <utility>
 
 #include "attribute/AttributeMap.h"
@@ -29,32 +29,46 @@ Vector<String> convertToTupleString(const PairedResult& resultPairs)
     return tupleStrings;
 }
 
-Vector<String> convertToTupleString(const NtupledResult& resultTuples)
+String convertRowToTupleString(const Vector<String>& tuple)
 {
     std::string delimiter = " ";
+    String tupleString;
+    size_t length = tuple.size();
+    for (size_t i = 0; i + 1 < length; i++) {
+        tupleString.append(tuple[i]).append(delimiter);
+    }
+    if (length > 0) {
+        tupleString.append(tuple[length - 1]);
+    }
+    return tupleString;
+}
+
+Vector<String> convertToTupleString(const NtupledResult& resultTuples)
+{
     Vector<String> tupleStrings;
+    tupleStrings.reserve(resultTuples.size());
     for (const std::vector<std::string>& tuple : resultTuples) {
-        std::ostringstream stringStream;
-        size_t length = tuple.size();
-        for (size_t i = 0; i + 1 < length; i++) {
-            stringStream << tuple[i] << delimiter;
-        }
-        if (length > 0) {
-            stringStream << tuple[length - 1];
-        }
-        tupleStrings.emplace_back(stringStream.str());
+        tupleStrings.emplace_back(convertRowToTupleString(tuple));
     }
     return tupleStrings;
 }
 
-RawQueryResult evaluateQuery(const AbstractQuery& abstractQuery)
+RawQueryResult evaluateQuery(const AbstractQuery& abstractQuery, size_t rowLimit)
+{
+    ResultsTable resultsTable(abstractQuery.getDeclarationTable());
+    Evaluator evaluator(abstractQuery, resultsTable, rowLimit);
+    return evaluator.evaluateQuery();
+}
+
+RawQueryResult evaluateQuery(const AbstractQuery& abstractQuery, ResultsTable& resultsTable, size_t rowLimit)
 {
-    Evaluator evaluator(abstractQuery);
+    resultsTable.clearResults();
+    Evaluator evaluator(abstractQuery, resultsTable, rowLimit);
     return evaluator.evaluateQuery();
 }
 
-Evaluator::Evaluator(const AbstractQuery& abstractQuery):
-    query(abstractQuery), resultsTable{abstractQuery.getDeclarationTable()}
+Evaluator::Evaluator(const AbstractQuery& abstractQuery, ResultsTable& resultsTable, size_t rowLimit):
+    query(abstractQuery), resultsTable(resultsTable), rowLimit(rowLimit)
 {}
 
 RawQueryResult Evaluator::evaluateQuery()
@@ -83,12 +97,14 @@ RawQueryResult Evaluator::evaluateQuery()
  */
 RawQueryResult Evaluator::evaluateValidQuery()
 {
-    // initiate Affects and Next evaluators
-    resultsTable.manageEvaluator(new AffectsEvaluator(resultsTable, new AffectsEvaluatorFacade()));
-    resultsTable.manageEvaluator(new NextEvaluator(resultsTable, new NextEvaluatorFacade()));
-    // initiate AffectsBip and NextBip evaluators
-    resultsTable.manageEvaluatorBip(new AffectsBipEvaluator(resultsTable, new AffectsBipFacade()));
-    resultsTable.manageEvaluatorBip(new NextBipEvaluator(resultsTable, new NextBipFacade()));
+    // initiate Affects and Next evaluators, unless kept from a previous evaluation
+    if (resultsTable.getNextEvaluator() == nullptr) {
+        resultsTable.manageEvaluator(new AffectsEvaluator(resultsTable, new AffectsEvaluatorFacade()));
+        resultsTable.manageEvaluator(new NextEvaluator(resultsTable, new NextEvaluatorFacade()));
+        // initiate AffectsBip and NextBip evaluators
+        resultsTable.manageEvaluatorBip(new AffectsBipEvaluator(resultsTable, new AffectsBipFacade()));
+        resultsTable.manageEvaluatorBip(new NextBipEvaluator(resultsTable, new NextBipFacade()));
+    }
     // evaluate clauses in the list order
     const ClauseVector& clauses = query.getClauses();
     for (int i = 0; i < clauses.count(); i++) {
@@ -112,32 +128,29 @@ RawQueryResult Evaluator::evaluateValidQuery()
 RawQueryResult Evaluator::evaluateSelectSynonym()
 {
     Vector<ResultSynonym> selectedSynonyms = query.getSelectedSynonyms();
-    Vector<String> resultsWithAttributes;
-    switch (selectedSynonyms.size()) {
-    case 0: {
-        resultsWithAttributes = Vector<String>({resultsTable.getResultsZero() ? "TRUE" : "FALSE"});
-        break;
+    if (selectedSynonyms.empty()) {
+        return RawQueryResult(Vector<String>({resultsTable.getResultsZero() ? "TRUE" : "FALSE"}));
     }
-    case 1: {
-        ClauseResult resultsForSynonym = resultsTable.getResultsOne(selectedSynonyms[0].getSynonym());
-        resultsWithAttributes = mapAttributesOne(resultsTable, resultsForSynonym, selectedSynonyms[0]);
-        break;
+    Vector<Synonym> synonymsList;
+    for (const ResultSynonym& rs : selectedSynonyms) {
+        synonymsList.push_back(rs.getSynonym());
     }
-    case 2: {
-        PairedResult resultsForSynonym
-            = resultsTable.getResultsTwo(selectedSynonyms[0].getSynonym(), selectedSynonyms[1].getSynonym());
-        resultsWithAttributes = convertToTupleString(
-            mapAttributesTwo(resultsTable, resultsForSynonym, selectedSynonyms[0], selectedSynonyms[1]));
-        break;
-    }
-    default: {
-        Vector<Synonym> synonymsList;
-        for (const ResultSynonym& rs : selectedSynonyms) {
-            synonymsList.push_back(rs.getSynonym());
+    /*
+     * Read the rows from a cursor, so that rows past the row limit
+     * are never created. Distinct rows may share the same attributes
+     * (e.g. c.procName), so those are checked for duplicates.
+     */
+    TupleCursor cursor = resultsTable.getResultsCursor(synonymsList);
+    AttributeMapper attributeMapper(resultsTable, selectedSynonyms);
+    std::unordered_set<String> mappedTuples;
+    Vector<String> resultsWithAttributes;
+    Vector<String> row;
+    while (resultsWithAttributes.size() < rowLimit && cursor.next(row)) {
+        attributeMapper.mapRow(row);
+        String tuple = convertRowToTupleString(row);
+        if (!attributeMapper.canMapRowsTogether() || mappedTuples.insert(tuple).second) {
+            resultsWithAttributes.push_back(std::move(tuple));
         }
-        NtupledResult resultsForSynonym = resultsTable.getResultsN(synonymsList);
-        resultsWithAttributes = convertToTupleString(mapAttributesN(resultsTable, resultsForSynonym, selectedSynonyms));
-    }
     }
     return RawQueryResult(std::move(resultsWithAttributes));
 }
@@ -9,14 +9,20 @@
 #ifndef SPA_PQL_EVALUATOR_H
 #define SPA_PQL_EVALUATOR_H
 
+#include <limits>
+
 #include "ResultsTable.h"
 #include "pql/preprocessor/AqTypes.h"
 #include "pql/projector/RawQueryResult.h"
 
+// Row limit for queries that should return all of their results
+const size_t NoRowLimit = std::numeric_limits<size_t>::max();
+
 class Evaluator {
 private:
     const AbstractQuery& query;
-    ResultsTable resultsTable;
+    ResultsTable& resultsTable;
+    const size_t rowLimit;
 
     RawQueryResult evaluateValidQuery();
     RawQueryResult evaluateSelectSynonym();
@@ -25,8 +31,14 @@ private:
 public:
     /**
      * Constructor for a Evaluator for an abstract query.
+     *
+     * @param abstractQuery The query to evaluate.
+     * @param resultsTable An empty ResultsTable for the declarations
+     *                     of the query, to store the results in.
+     * @param rowLimit The maximum number of results to return.
+     *                 Rows past the limit are never enumerated.
      */
-    explicit Evaluator(const AbstractQuery& abstractQuery);
+    Evaluator(const AbstractQuery& abstractQuery, ResultsTable& resultsTable, size_t rowLimit = NoRowLimit);
 
     /**
      * Evaluates the query stored in this Evaluator.
@@ -60,17 +72,49 @@ Vector<String> convertToTupleString(const PairedResult& resultPairs);
  */
 Vector<String> convertToTupleString(const NtupledResult& resultTuples);
 
+/**
+ * Converts a single n-tuple to a string, with elements
+ * separated by spaces.
+ *
+ * Example: {"e", "1", "n"} is converted to "e 1 n".
+ *
+ * @param tuple The n-tuple to be converted.
+ * @return The tuple as a single string.
+ */
+String convertRowToTupleString(const Vector<String>& tuple);
+
 /**
  * Evaluates a PQL query, and interacts with the PKB,
  * for the results of that query.
  *
  * @param query The PQL query.
+ * @param rowLimit The maximum number of results to return.
  *
  * @return RawQueryResult, representing the PQL
  * query results (Note: If either PQL query invalid, or is
  * valid but yields no result, an empty RawQueryResult
  * would be returned).
  */
-RawQueryResult evaluateQuery(const AbstractQuery& abstractQuery);
+RawQueryResult evaluateQuery(const AbstractQuery& abstractQuery, size_t rowLimit = NoRowLimit);
+
+/**
+ * Evaluates a PQL query like evaluateQuery above, but stores
+ * the results in a ResultsTable that is kept between calls.
+ * The results of the previous call are cleared, but the
+ * Next and Affects evaluators of the ResultsTable, and
+ * their caches, are reused across calls.
+ *
+ * As the caches hold results from the PKB, the
+ * ResultsTable must not be reused once the PKB changes.
+ *
+ * @param query The PQL query.
+ * @param resultsTable The ResultsTable for the declarations
+ *                     of the query, to store results in.
+ * @param rowLimit The maximum number of results to return.
+ *
+ * @return RawQueryResult, representing the PQL query results.
+ */
+RawQueryResult evaluateQuery(const AbstractQuery& abstractQuery, ResultsTable& resultsTable,
+                             size_t rowLimit = NoRowLimit);
 
 #endif // SPA_PQL_EVALUATOR_H
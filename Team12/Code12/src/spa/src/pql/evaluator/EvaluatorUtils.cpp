@@ -105,8 +105,14 @@ std::size_t IntegerPairHasher::operator()(const Pair<Integer, Integer>& intPair)
 }
 
 ClauseResult convertToClauseResult(const Vector<Integer>& intList)
+{
+    return convertToClauseResult(VectorView<Integer>(intList));
+}
+
+ClauseResult convertToClauseResult(VectorView<Integer> intList)
 {
     ClauseResult strList;
+    strList.reserve(intList.size());
     for (Integer i : intList) {
         strList.push_back(std::to_string(i));
     }
@@ -114,8 +120,14 @@ ClauseResult convertToClauseResult(const Vector<Integer>& intList)
 }
 
 PairedResult convertToPairedResult(const Vector<Pair<Integer, Integer>>& intPairsList)
+{
+    return convertToPairedResult(VectorView<Pair<Integer, Integer>>(intPairsList));
+}
+
+PairedResult convertToPairedResult(VectorView<Pair<Integer, Integer>> intPairsList)
 {
     PairedResult strPairsList;
+    strPairsList.reserve(intPairsList.size());
     for (const Pair<Integer, Integer>& p : intPairsList) {
         strPairsList.push_back(std::make_pair(std::to_string(p.first), std::to_string(p.second)));
     }
@@ -132,8 +144,14 @@ PairedResult convertToPairedResult(const Vector<Pair<String, Integer>>& intPairs
 }
 
 PairedResult convertToPairedResult(const Vector<Pair<Integer, String>>& intPairsList)
+{
+    return convertToPairedResult(VectorView<Pair<Integer, String>>(intPairsList));
+}
+
+PairedResult convertToPairedResult(VectorView<Pair<Integer, String>> intPairsList)
 {
     PairedResult strPairsList;
+    strPairsList.reserve(intPairsList.size());
     for (const Pair<Integer, String>& p : intPairsList) {
         strPairsList.push_back(std::make_pair(std::to_string(p.first), p.second));
     }
@@ -151,9 +169,10 @@ std::unordered_map<DesignEntityType, StatementType> getStatementTypesMap()
 
 StatementType mapToStatementType(DesignEntityType entType)
 {
-    std::unordered_map<DesignEntityType, StatementType> queryPkbTypesMap = getStatementTypesMap();
-    if (queryPkbTypesMap.find(entType) != queryPkbTypesMap.end()) {
-        return queryPkbTypesMap[entType];
+    static const std::unordered_map<DesignEntityType, StatementType> queryPkbTypesMap = getStatementTypesMap();
+    auto mapEntry = queryPkbTypesMap.find(entType);
+    if (mapEntry != queryPkbTypesMap.end()) {
+        return mapEntry->second;
     } else {
         throw std::runtime_error("Wrong entity type in mapToStatementType");
     }
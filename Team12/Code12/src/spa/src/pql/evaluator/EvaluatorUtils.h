@@ -7,6 +7,7 @@
 #include <utility>
 
 #include "Types.h"
+#include "pkb/PkbTypes.h"
 #include "pql/preprocessor/AqTypes.h"
 
 typedef Vector<String> ClauseResult;
@@ -118,6 +119,12 @@ struct IntegerPairHasher {
  */
 ClauseResult convertToClauseResult(const Vector<Integer>& intList);
 
+/*
+ * Converts a view of integers in the PKB to a string vector,
+ * without copying the integers out of the PKB first.
+ */
+ClauseResult convertToClauseResult(VectorView<Integer> intList);
+
 /*
  * An utility method to convert pairs of integers to pairs of strings.
  * Pairs of strings are used to represent relationships between result
@@ -129,6 +136,12 @@ ClauseResult convertToClauseResult(const Vector<Integer>& intList);
  */
 PairedResult convertToPairedResult(const Vector<Pair<Integer, Integer>>& intPairsList);
 
+/*
+ * Converts a view of pairs of integers in the PKB to pairs of
+ * strings, without copying the pairs out of the PKB first.
+ */
+PairedResult convertToPairedResult(VectorView<Pair<Integer, Integer>> intPairsList);
+
 /*
  * An utility method to convert pairs of string and integer to pairs
  * of two strings. Pairs of strings are used to represent relationships
@@ -151,6 +164,12 @@ PairedResult convertToPairedResult(const Vector<Pair<String, Integer>>& intPairs
  */
 PairedResult convertToPairedResult(const Vector<Pair<Integer, String>>& intPairsList);
 
+/*
+ * Converts a view of pairs of integer and string in the PKB to pairs
+ * of two strings, without copying the pairs out of the PKB first.
+ */
+PairedResult convertToPairedResult(VectorView<Pair<Integer, String>> intPairsList);
+
 /*
  * Given a DesignEntityType, this function maps it to
  * a StatementType, which is a type compatible for calling
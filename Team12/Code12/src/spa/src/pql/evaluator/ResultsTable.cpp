@@ -86,6 +86,72 @@ void ResultsTable::filterAfterVerification(const Synonym& syn, const ClauseResul
     hasResult = !resultsSet.empty();
 }
 
+/**
+ * Removes the results of a clause for a synonym that are not
+ * among the values the synonym can still take, and narrows
+ * those values down to the remaining results.
+ *
+ * @param syn The synonym of the results.
+ * @param results The results of the clause for the synonym.
+ * @return True, if any results remain.
+ */
+Boolean ResultsTable::narrowCandidates(const Synonym& syn, ClauseResult& results)
+{
+    auto candidates = candidatesMap.find(syn);
+    if (candidates != candidatesMap.end()) {
+        const ResultsSet& candidateValues = candidates->second;
+        results.erase(std::remove_if(results.begin(), results.end(),
+                                     [&candidateValues](const String& value) {
+                                         return candidateValues.find(value) == candidateValues.end();
+                                     }),
+                      results.end());
+    }
+    candidatesMap[syn] = ResultsSet(results.begin(), results.end());
+    return !results.empty();
+}
+
+/**
+ * Removes the pairs of results of a clause for two synonyms
+ * where either value is not among the values its synonym can
+ * still take, and narrows the values of both synonyms down
+ * to those in the remaining pairs.
+ *
+ * @param s1 The synonym of the first value of each pair.
+ * @param s2 The synonym of the second value of each pair.
+ * @param tuples The pairs of results of the clause.
+ * @return True, if any pairs remain.
+ */
+Boolean ResultsTable::narrowCandidates(const Synonym& s1, const Synonym& s2, PairedResult& tuples)
+{
+    if (s1 == s2) {
+        // the values of a synonym paired with itself are left to the merge
+        return !tuples.empty();
+    }
+    auto firstCandidates = candidatesMap.find(s1);
+    auto secondCandidates = candidatesMap.find(s2);
+    const ResultsSet* firstValues = firstCandidates == candidatesMap.end() ? nullptr : &firstCandidates->second;
+    const ResultsSet* secondValues = secondCandidates == candidatesMap.end() ? nullptr : &secondCandidates->second;
+    if (firstValues != nullptr || secondValues != nullptr) {
+        tuples.erase(std::remove_if(tuples.begin(), tuples.end(),
+                                    [firstValues, secondValues](const std::pair<String, String>& tuple) {
+                                        return (firstValues != nullptr
+                                                && firstValues->find(tuple.first) == firstValues->end())
+                                               || (secondValues != nullptr
+                                                   && secondValues->find(tuple.second) == secondValues->end());
+                                    }),
+                     tuples.end());
+    }
+    ResultsSet newFirstValues;
+    ResultsSet newSecondValues;
+    for (const std::pair<String, String>& tuple : tuples) {
+        newFirstValues.insert(tuple.first);
+        newSecondValues.insert(tuple.second);
+    }
+    candidatesMap[s1] = std::move(newFirstValues);
+    candidatesMap[s2] = std::move(newSecondValues);
+    return !tuples.empty();
+}
+
 /**
  * Given a new clause results, find common elements with
  * the new clause results and the old results for the
@@ -268,6 +334,32 @@ NtupledResult ResultsTable::joinAllSynonyms(const Vector<Synonym>& syns)
     return allDifferent ? relationships->retrieveUniqueRowsMatching(syns) : calculateMatchingTuples(syns);
 }
 
+/**
+ * Splits a vector of distinct synonyms into groups, where the
+ * results of synonyms in the same group are related to each
+ * other in the RelationshipsGraph, and results of synonyms in
+ * different groups are independent.
+ *
+ * @param synonyms The distinct synonyms to be grouped.
+ * @return The groups of synonyms, each in the order that the
+ *         synonyms appear in the vector.
+ */
+Vector<Vector<Synonym>> ResultsTable::groupRelatedSynonyms(const Vector<Synonym>& synonyms) const
+{
+    Vector<Vector<Synonym>> groups;
+    for (const Synonym& synonym : synonyms) {
+        auto relatedGroup = std::find_if(groups.begin(), groups.end(), [this, &synonym](const Vector<Synonym>& group) {
+            return hasRelationships(group.front(), synonym);
+        });
+        if (relatedGroup == groups.end()) {
+            groups.push_back({synonym});
+        } else {
+            relatedGroup->push_back(synonym);
+        }
+    }
+    return groups;
+}
+
 std::function<void()> ResultsTable::createEvaluatorOne(ResultsTable* table, const Synonym& syn,
                                                        const ClauseResult& results)
 {
@@ -492,6 +584,16 @@ Void ResultsTable::manageEvaluatorBip(NextEvaluator* nextBipEval)
     nextBipEvaluator = nextBipEval;
 }
 
+Void ResultsTable::clearResults()
+{
+    resultsMap.clear();
+    relationships.reset(new RelationshipsGraph());
+    queue = EvaluationQueue();
+    candidatesMap.clear();
+    hasResult = true;
+    hasEvaluated = false;
+}
+
 Void ResultsTable::eliminatePotentialValue(const Synonym& synonym, const String& value)
 {
     if (resultsMap.find(synonym) != resultsMap.end()) {
@@ -515,6 +617,12 @@ Boolean ResultsTable::doesSynonymHaveConstraints(const Synonym& syn) const
     }
 }
 
+const ResultsSet* ResultsTable::getCandidates(const Synonym& syn) const
+{
+    auto candidates = candidatesMap.find(syn);
+    return candidates == candidatesMap.end() ? nullptr : &candidates->second;
+}
+
 Boolean ResultsTable::hasRelationships(const Synonym& leftSynonym, const Synonym& rightSynonym) const
 {
     if (!relationships->hasSeenBefore(leftSynonym) || !relationships->hasSeenBefore(rightSynonym)
@@ -557,12 +665,52 @@ PairedResult ResultsTable::getResultsTwo(const Synonym& syn1, const Synonym& syn
 NtupledResult ResultsTable::getResultsN(const Vector<Synonym>& syns)
 {
     assert(syns.size() > 1); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    TupleCursor cursor = getResultsCursor(syns);
+    NtupledResult tuples;
+    Vector<String> row;
+    while (cursor.next(row)) {
+        tuples.push_back(row);
+    }
+    return tuples;
+}
+
+TupleCursor ResultsTable::getResultsCursor(const Vector<Synonym>& syns)
+{
     mergeResults();
     if (!hasResults()) {
-        return std::vector<std::vector<String>>();
-    } else {
-        return joinAllSynonyms(syns);
+        return TupleCursor();
+    }
+    std::unordered_set<Synonym> distinctSynonyms(syns.begin(), syns.end());
+    if (distinctSynonyms.size() < syns.size()) {
+        // repeated synonyms are matched pairwise by calculateMatchingTuples
+        Vector<Pair<size_t, size_t>> columnSources;
+        for (size_t column = 0; column < syns.size(); column++) {
+            columnSources.emplace_back(0, column);
+        }
+        return TupleCursor({joinAllSynonyms(syns)}, std::move(columnSources));
     }
+    Vector<Vector<Synonym>> groups = groupRelatedSynonyms(syns);
+    Vector<NtupledResult> groupRows;
+    std::unordered_map<Synonym, Pair<size_t, size_t>> synonymSources;
+    for (const Vector<Synonym>& group : groups) {
+        for (size_t column = 0; column < group.size(); column++) {
+            synonymSources.insert({group[column], {groupRows.size(), column}});
+        }
+        if (group.size() == 1) {
+            NtupledResult rows;
+            for (const String& value : get(group.front())) {
+                rows.push_back({value});
+            }
+            groupRows.push_back(std::move(rows));
+        } else {
+            groupRows.push_back(relationships->retrieveUniqueRowsMatching(group));
+        }
+    }
+    Vector<Pair<size_t, size_t>> columnSources;
+    for (const Synonym& syn : syns) {
+        columnSources.push_back(synonymSources.at(syn));
+    }
+    return TupleCursor(std::move(groupRows), std::move(columnSources));
 }
 
 Void ResultsTable::storeResultsZero(Boolean hasResults)
@@ -572,12 +720,13 @@ Void ResultsTable::storeResultsZero(Boolean hasResults)
 
 Void ResultsTable::storeResultsOne(const Synonym& syn, const ClauseResult& res)
 {
-    if (res.empty()) {
+    ClauseResult results = res;
+    if (!narrowCandidates(syn, results)) {
         // if results are empty, invalidate the entire results table
         hasResult = false;
     } else {
         // store the synonym in the evaluator queue
-        queue.push(createEvaluatorOne(this, syn, res));
+        queue.push(createEvaluatorOne(this, syn, results));
     }
 }
 
@@ -612,7 +761,7 @@ Void ResultsTable::storeResultsTwo(const Reference& rfc1, const ClauseResult& re
             // pairs between same synonym, so we just store one result
             storeResultsOne(s1, res1);
         } else {
-            queue.push(createEvaluatorTwo(this, s1, s2, tuples));
+            storeResultsTwo(s1, s2, tuples);
         }
     }
 }
@@ -627,17 +776,18 @@ Void ResultsTable::storeResultsTwo(const Synonym& syn, const ClauseResult& resSy
         // ignore the reference
         storeResultsOne(syn, resSyn);
     } else {
-        queue.push(createEvaluatorTwo(this, syn, ref.getValue(), tuples));
+        storeResultsTwo(syn, ref.getValue(), tuples);
     }
 }
 
 Void ResultsTable::storeResultsTwo(const Synonym& syn1, const Synonym& syn2, const PairedResult& tuples)
 {
-    if (tuples.empty()) {
+    PairedResult narrowedTuples = tuples;
+    if (!narrowCandidates(syn1, syn2, narrowedTuples)) {
         // short-circuit if tuples are empty
         hasResult = false;
     } else {
-        queue.push(createEvaluatorTwo(this, syn1, syn2, tuples));
+        queue.push(createEvaluatorTwo(this, syn1, syn2, narrowedTuples));
     }
 }
 
@@ -646,13 +796,13 @@ ClauseResult retrieveAllMatching(DesignEntityType entTypeOfSynonym)
 {
     ClauseResult results;
     if (isStatementDesignEntity(entTypeOfSynonym)) {
-        results = convertToClauseResult(getAllStatements(mapToStatementType(entTypeOfSynonym)));
+        results = convertToClauseResult(viewAllStatements(mapToStatementType(entTypeOfSynonym)));
     } else if (entTypeOfSynonym == VariableType) {
         results = getAllVariables();
     } else if (entTypeOfSynonym == ProcedureType) {
         results = getAllProcedures();
     } else if (entTypeOfSynonym == ConstantType) {
-        results = convertToClauseResult(getAllConstants());
+        results = convertToClauseResult(viewAllConstants());
     } else {
         throw std::runtime_error("Unknown DesignEntityType in retrieveAllMatching");
     }
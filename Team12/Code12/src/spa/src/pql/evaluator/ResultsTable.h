@@ -16,6 +16,7 @@
 #include <unordered_set>
 
 #include "EvaluatorUtils.h"
+#include "TupleCursor.h"
 
 typedef std::queue<std::function<void()>> EvaluationQueue;
 typedef std::unordered_set<String> ResultsSet;
@@ -32,6 +33,8 @@ private:
     DeclarationTable declarations;
     std::unique_ptr<RelationshipsGraph> relationships;
     EvaluationQueue queue;
+    // values that each synonym can still take, narrowed whenever a clause is stored
+    std::unordered_map<Synonym, ResultsSet> candidatesMap;
     Boolean hasResult;
     Boolean hasEvaluated;
     // cache results for Next, Affects
@@ -44,8 +47,11 @@ private:
     Boolean checkIfSynonymInMap(const Synonym& syn) const;
     void filterAfterVerification(const Synonym& syn, const ClauseResult& results);
     ResultsSet findCommonElements(const ClauseResult& newResults, const Synonym& synonym);
+    Boolean narrowCandidates(const Synonym& syn, ClauseResult& results);
+    Boolean narrowCandidates(const Synonym& s1, const Synonym& s2, PairedResult& tuples);
     NtupledResult calculateMatchingTuples(const Vector<Synonym>& synonyms);
     NtupledResult joinAllSynonyms(const Vector<Synonym>& syns);
+    Vector<Vector<Synonym>> groupRelatedSynonyms(const Vector<Synonym>& synonyms) const;
 
     /**
      * Creates a evaluation closure for one synonym's results.
@@ -247,6 +253,14 @@ public:
      */
     Void manageEvaluatorBip(NextEvaluator* nextBipEval);
 
+    /**
+     * Removes the results stored by every clause, so that
+     * the ResultsTable can be used to evaluate the query
+     * again. The evaluators managed by the ResultsTable are
+     * kept, along with the results that they have cached.
+     */
+    Void clearResults();
+
     /**
      * Returns true if the result table is marked as having
      * no results at all, which happens if a clause returns
@@ -287,6 +301,22 @@ public:
      */
     Boolean doesSynonymHaveConstraints(const Synonym& syn) const;
 
+    /**
+     * Gets the values that a synonym can still take, from the
+     * results of the clauses stored in the table so far. Unlike
+     * getResultsOne, the results queue is not merged, so there may
+     * be values that merging would remove, but the results of the
+     * query for the synonym are always among these values.
+     *
+     * Clause evaluators can use these values to find only the
+     * results of a clause that agree with the clauses before it.
+     *
+     * @param syn The synonym to look up.
+     * @return The values of the synonym, or nullptr if no
+     *         clause stored so far has results for it.
+     */
+    const ResultsSet* getCandidates(const Synonym& syn) const;
+
     /**
      * Checks the relationship table for two synonyms, to
      * see whether there is any relationships between the
@@ -343,6 +373,25 @@ public:
      */
     NtupledResult getResultsN(const Vector<Synonym>& syns);
 
+    /**
+     * Initiates merging of the results queue, unless a certain
+     * result in the queue was empty. Afterwards, returns a cursor
+     * over the results for all synonyms in the vector, which
+     * enumerates the n-tuples one at a time.
+     *
+     * When the synonyms are all different, the Cartesian product
+     * of results of unrelated synonyms is never stored, so only
+     * the n-tuples that are actually read from the cursor are
+     * created. Repeated synonyms are matched in the same way
+     * as before, through calculateMatchingTuples.
+     *
+     * @param syns The synonyms to get results for.
+     *
+     * @return A cursor over the result n-tuples for
+     *         (syns[0], syns[1], ..., syns[n]).
+     */
+    TupleCursor getResultsCursor(const Vector<Synonym>& syns);
+
     /**
      * Stores the result for a clause with no synonyms.
      * If true, nothing happens. But if false, the entire
@@ -0,0 +1,78 @@
+/**
+ * Implementation of the cursor over rows of query results.
+ */
+
+#include "TupleCursor.h"
+
+#include <cstdint>
+
+TupleCursor::TupleCursor(): hasStarted(false), isExhausted(true) {}
+
+TupleCursor::TupleCursor(Vector<NtupledResult> groupRows, Vector<Pair<size_t, size_t>> columnSources):
+    groupRows(std::move(groupRows)), columnSources(std::move(columnSources)), hasStarted(false),
+    isExhausted(this->groupRows.empty() || this->columnSources.empty())
+{
+    for (const NtupledResult& rows : this->groupRows) {
+        if (rows.empty()) {
+            // the product of the groups is empty
+            isExhausted = true;
+        }
+    }
+    rowIndexes.assign(this->groupRows.size(), 0);
+}
+
+/*
+ * Advances the indexes of the rows in each group to the next
+ * combination, with the last group changing the fastest.
+ *
+ * @return True, if there is a next combination. Otherwise, false.
+ */
+Boolean TupleCursor::advance()
+{
+    for (size_t group = groupRows.size(); group > 0; group--) {
+        size_t& index = rowIndexes[group - 1];
+        index++;
+        if (index < groupRows[group - 1].size()) {
+            return true;
+        }
+        index = 0;
+    }
+    return false;
+}
+
+Boolean TupleCursor::next(Vector<String>& row)
+{
+    if (isExhausted) {
+        return false;
+    }
+    if (hasStarted && !advance()) {
+        isExhausted = true;
+        return false;
+    }
+    hasStarted = true;
+    row.resize(columnSources.size());
+    for (size_t column = 0; column < columnSources.size(); column++) {
+        const Pair<size_t, size_t>& source = columnSources[column];
+        row[column] = groupRows[source.first][rowIndexes[source.first]][source.second];
+    }
+    return true;
+}
+
+size_t TupleCursor::countRows() const
+{
+    if (groupRows.empty() || columnSources.empty()) {
+        return 0;
+    }
+    size_t count = 1;
+    for (const NtupledResult& rows : groupRows) {
+        if (rows.empty()) {
+            return 0;
+        }
+        if (count > SIZE_MAX / rows.size()) {
+            count = SIZE_MAX;
+        } else {
+            count *= rows.size();
+        }
+    }
+    return count;
+}
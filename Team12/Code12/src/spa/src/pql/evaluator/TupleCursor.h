@@ -0,0 +1,63 @@
+/**
+ * A cursor over the rows of results for the synonyms
+ * selected in a query, which enumerates the rows one at
+ * a time instead of materialising all of them.
+ */
+
+#ifndef SPA_PQL_TUPLE_CURSOR_H
+#define SPA_PQL_TUPLE_CURSOR_H
+
+#include "EvaluatorUtils.h"
+
+/**
+ * The selected synonyms are split into groups of synonyms whose
+ * results are related to each other. The rows of each group are
+ * known, but the groups are independent, so every combination of
+ * one row from each group is a row of the results. The cursor walks
+ * through these combinations like an odometer, so the Cartesian
+ * product of the groups is never stored.
+ */
+class TupleCursor {
+public:
+    /**
+     * Constructs a cursor that has no rows.
+     */
+    TupleCursor();
+
+    /**
+     * Constructs a cursor over the combinations of rows of groups.
+     *
+     * @param groupRows The distinct rows of each group of synonyms.
+     * @param columnSources For each column of the rows returned, the
+     *                      index of the group and the index of the
+     *                      column in the rows of that group, to take
+     *                      the value of the column from.
+     */
+    TupleCursor(Vector<NtupledResult> groupRows, Vector<Pair<size_t, size_t>> columnSources);
+
+    /**
+     * Moves the cursor to the next row of results.
+     *
+     * @param row Set to the values of the next row, if there is one.
+     * @return True, if there was a next row. Otherwise, false.
+     */
+    Boolean next(Vector<String>& row);
+
+    /**
+     * Counts the rows that will be enumerated by the cursor in
+     * total, without enumerating them. Saturates at SIZE_MAX.
+     */
+    size_t countRows() const;
+
+private:
+    Vector<NtupledResult> groupRows;
+    Vector<Pair<size_t, size_t>> columnSources;
+    // index of the current row in each group
+    Vector<size_t> rowIndexes;
+    Boolean hasStarted;
+    Boolean isExhausted;
+
+    Boolean advance();
+};
+
+#endif // SPA_PQL_TUPLE_CURSOR_H
@@ -5,13 +5,28 @@
 
 #include "AttributeMap.h"
 
+#include <algorithm>
 #include <functional>
 
 #include "pkb/PKB.h"
 
-typedef std::unordered_map<DesignEntityType,
-                           std::unordered_map<AttributeType, std::function<std::string(const std::string&)>>>
-    SignificanceMap;
+typedef std::function<const String&(const String&)> AttributeMapping;
+typedef std::unordered_map<DesignEntityType, std::unordered_map<AttributeType, AttributeMapping>> SignificanceMap;
+
+/**
+ * Maps the value of a call, read or print statement to the name
+ * of the procedure called or the variable read or printed, from
+ * the names of the statements stored in the PKB.
+ */
+const String& getNameOfStatement(const String& stmtNum)
+{
+    // values of statements are always digits, so they need no checks
+    Integer number = 0;
+    for (char digit : stmtNum) {
+        number = number * 10 + (digit - '0');
+    }
+    return getStatementAttribute(number);
+}
 
 /**
  * Returns a map that describes which attribute type is significant
@@ -21,25 +36,12 @@ typedef std::unordered_map<DesignEntityType,
  * mapping function that takes in the default value and returns
  * the different value corresponding to the attribute type.
  */
-SignificanceMap getSignificanceMap()
+const SignificanceMap& getSignificanceMap()
 {
-    return SignificanceMap({{CallType,
-                             {{ProcNameType,
-                               [](const std::string& stmtNum) {
-                                   Vector<String> procedures = getProcedureCalled(std::stoi(stmtNum));
-                                   return procedures.empty() ? "" : procedures[0];
-                               }}}},
-                            {ReadType,
-                             {{VarNameType,
-                               [](const std::string& stmtNum) {
-                                   Vector<String> variables = getModifiesVariablesFromStatement(std::stoi(stmtNum));
-                                   return variables.empty() ? "" : variables[0];
-                               }}}},
-                            {PrintType, {{VarNameType, [](const std::string& stmtNum) {
-                                              Vector<String> variables
-                                                  = getUsesVariablesFromStatement(std::stoi(stmtNum));
-                                              return variables.empty() ? "" : variables[0];
-                                          }}}}});
+    static const SignificanceMap significanceMap({{CallType, {{ProcNameType, getNameOfStatement}}},
+                                                  {ReadType, {{VarNameType, getNameOfStatement}}},
+                                                  {PrintType, {{VarNameType, getNameOfStatement}}}});
+    return significanceMap;
 }
 
 /**
@@ -58,101 +60,40 @@ bool isSignificant(DesignEntityType typeOfSynonym, AttributeType typeOfAttribute
     if (positionOfSynonymTypeInMap == map.end()) {
         return false;
     } else {
-        std::unordered_map<AttributeType, std::function<std::string(const std::string&)>> innerMap
-            = positionOfSynonymTypeInMap->second;
+        const std::unordered_map<AttributeType, AttributeMapping>& innerMap = positionOfSynonymTypeInMap->second;
         return innerMap.find(typeOfAttribute) != innerMap.end();
     }
 }
 
-/**
- * For a single default value, transforms it into the correct
- * value based on the synonym and attribute type provided.
- *
- * @param value The default value matching the synonym.
- * @param synonymType The type of synonym.
- * @param attributeType The type of the attribute.
- * @param map The SignificanceMap which stores the function.
- * @return The correct value matching the attribute.
- */
-String getResultForSingleValue(const String& value, DesignEntityType synonymType, AttributeType attributeType,
-                               const SignificanceMap& map)
-{
-    if (isSignificant(synonymType, attributeType, map)) {
-        return map.at(synonymType).at(attributeType)(value);
-    } else {
-        return value;
-    }
-}
-
-ClauseResult mapAttributesOne(const ResultsTable& results, const ClauseResult& values, const ResultSynonym& synonym)
+AttributeMapper::AttributeMapper(const ResultsTable& results, const Vector<ResultSynonym>& syns): hasMappings(false)
 {
-    DesignEntityType synonymType = results.getTypeOfSynonym(synonym.getSynonym());
-    AttributeType attributeType = synonym.getAttribute().getType();
-    SignificanceMap significanceMap = getSignificanceMap();
-    if (!isSignificant(synonymType, attributeType, significanceMap)) {
-        return values;
-    } else {
-        std::unordered_set<std::string> attributesResult;
-        for (const String& value : values) {
-            attributesResult.insert(significanceMap[synonymType][attributeType](value));
+    const SignificanceMap& significanceMap = getSignificanceMap();
+    for (const ResultSynonym& synonym : syns) {
+        DesignEntityType synonymType = results.getTypeOfSynonym(synonym.getSynonym());
+        AttributeType attributeType = synonym.getAttribute().getType();
+        if (isSignificant(synonymType, attributeType, significanceMap)) {
+            columnMappings.push_back(significanceMap.at(synonymType).at(attributeType));
+            hasMappings = true;
+        } else {
+            columnMappings.emplace_back();
         }
-        return ClauseResult(attributesResult.begin(), attributesResult.end());
     }
 }
 
-PairedResult mapAttributesTwo(const ResultsTable& results, const PairedResult& pairs, const ResultSynonym& syn1,
-                              const ResultSynonym& syn2)
+Boolean AttributeMapper::canMapRowsTogether() const
 {
-    SignificanceMap significanceMap = getSignificanceMap();
-    DesignEntityType syn1Type = results.getTypeOfSynonym(syn1.getSynonym());
-    AttributeType syn1Attr = syn1.getAttribute().getType();
-    DesignEntityType syn2Type = results.getTypeOfSynonym(syn2.getSynonym());
-    AttributeType syn2Attr = syn2.getAttribute().getType();
-    bool syn1Significant = isSignificant(syn1Type, syn1Attr, significanceMap);
-    bool syn2Significant = isSignificant(syn2Type, syn2Attr, significanceMap);
-
-    if (!syn1Significant && !syn2Significant) {
-        return pairs;
-    }
-    std::unordered_set<ResultsRelation, ResultsRelationHasher> attributesResult;
-    if (syn1Significant && syn2Significant) {
-        for (const std::pair<std::string, std::string>& pair : pairs) {
-            attributesResult.insert(ResultsRelation(significanceMap[syn1Type][syn1Attr](pair.first),
-                                                    significanceMap[syn2Type][syn2Attr](pair.second)));
-        }
-    } else if (syn1Significant) {
-        for (const std::pair<std::string, std::string>& pair : pairs) {
-            attributesResult.insert(ResultsRelation(significanceMap[syn1Type][syn1Attr](pair.first), pair.second));
-        }
-    } else {
-        // syn2Significant
-        for (const std::pair<std::string, std::string>& pair : pairs) {
-            attributesResult.insert(ResultsRelation(pair.first, significanceMap[syn2Type][syn2Attr](pair.second)));
-        }
-    }
-    PairedResult resultsList;
-    for (const ResultsRelation& rr : attributesResult) {
-        resultsList.emplace_back(rr.value1, rr.value2);
-    }
-    return resultsList;
+    return hasMappings;
 }
 
-NtupledResult mapAttributesN(const ResultsTable& results, const NtupledResult& tuples,
-                             const Vector<ResultSynonym>& syns)
+Void AttributeMapper::mapRow(Vector<String>& row) const
 {
-    SignificanceMap significanceMap = getSignificanceMap();
-    std::unordered_set<std::vector<std::string>, NtupleHasher> attributesResult;
-    for (const std::vector<std::string>& tuple : tuples) {
-        std::vector<std::string> mappedTuple;
-        size_t length = tuple.size();
-        mappedTuple.reserve(length);
-        for (size_t i = 0; i < length; i++) {
-            const ResultSynonym& currentSynonym = syns.at(i);
-            mappedTuple.push_back(getResultForSingleValue(tuple[i],
-                                                          results.getTypeOfSynonym(currentSynonym.getSynonym()),
-                                                          currentSynonym.getAttribute().getType(), significanceMap));
+    if (!hasMappings) {
+        return;
+    }
+    size_t length = std::min(row.size(), columnMappings.size());
+    for (size_t i = 0; i < length; i++) {
+        if (columnMappings[i]) {
+            row[i] = columnMappings[i](row[i]);
         }
-        attributesResult.insert(mappedTuple);
     }
-    return NtupledResult(attributesResult.begin(), attributesResult.end());
 }
@@ -1,60 +1,44 @@
 /**
- * Methods to retrieve a synonym's attributes from the
- * Program Knowledge Base, given the exact values that
- * matches that synonym in the query.
+ * Retrieves the attributes of synonyms from the Program
+ * Knowledge Base, given the exact values that match those
+ * synonyms in the rows of results of the query.
  */
 
 #ifndef SPA_PQL_ATTRIBUTE_MAP_H
 #define SPA_PQL_ATTRIBUTE_MAP_H
 
+#include <functional>
+
 #include "pql/evaluator/ResultsTable.h"
 
 /**
- * Given the values for a single synonym, retrieve the
- * corresponding attributes for those values based on
- * the attribute specified within ResultsSynonym.
- *
- * The returned list is a unique set of values matching
- * both the synonym and its attribute.
- *
- * @param results The results table to look up.
- * @param values The original values for the synonym.
- * @param synonym The synonym and its attribute.
- * @return Values corresponding to the correct attribute.
+ * Maps rows of results for the selected synonyms to the selected
+ * attributes of the synonyms, one row at a time, so that the rows
+ * can be mapped as they are read from a TupleCursor.
  */
-ClauseResult mapAttributesOne(const ResultsTable& results, const ClauseResult& values, const ResultSynonym& synonym);
+class AttributeMapper {
+public:
+    AttributeMapper(const ResultsTable& results, const Vector<ResultSynonym>& syns);
 
-/**
- * Given paired values for two synonyms, retrieve the
- * corresponding attributes for those values based on
- * the attributes specified within both ResultsSynonyms.
- *
- * The returned list is a unique set of pairs with
- * values matching both synonyms and their attributes.
- *
- * @param results The results table to look up.
- * @param pairs The original values for (syn1, syn2).
- * @param syn1 The first synonym and its attribute.
- * @param syn2 The second synonym and its attribute.
- * @return Pairs of values corresponding to the correct attributes.
- */
-PairedResult mapAttributesTwo(const ResultsTable& results, const PairedResult& pairs, const ResultSynonym& syn1,
-                              const ResultSynonym& syn2);
+    /**
+     * Checks whether different rows may be mapped to the same
+     * row of attributes (e.g. two calls to the same procedure,
+     * for c.procName), in which case duplicates have to be
+     * removed after mapping.
+     */
+    Boolean canMapRowsTogether() const;
 
-/**
- * Given n-tupled values for n synonyms, retrieve the
- * corresponding attributes for those values based on
- * the attributes specified within all ResultsSynonyms.
- *
- * The returned list is a unique set of n-tuples with
- * values matching all the synonyms and their attributes.
- *
- * @param results The results table to look up.
- * @param tuples The original values for (syns[1], syns[2], ..., syns[n]).
- * @param syns The synonyms and their attributes.
- * @return N-tuples of values corresponding to the correct attributes.
- */
-NtupledResult mapAttributesN(const ResultsTable& results, const NtupledResult& tuples,
-                             const Vector<ResultSynonym>& syns);
+    /**
+     * Replaces the values in a row with their attributes.
+     *
+     * @param row A row of values for the selected synonyms.
+     */
+    Void mapRow(Vector<String>& row) const;
+
+private:
+    // for each column, the mapping to its attribute, or empty if not needed
+    Vector<std::function<const String&(const String&)>> columnMappings;
+    Boolean hasMappings;
+};
 
 #endif // SPA_PQL_ATTRIBUTE_MAP_H
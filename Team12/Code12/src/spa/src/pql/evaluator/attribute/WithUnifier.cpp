@@ -1,148 +1,110 @@
 /**
  * Implementation of WithUnifier for Query Evaluator.
- * WithUnifier performs a unification to obtain results.x`
+ * WithUnifier performs a unification to obtain results.
  */
 
 #include "WithUnifier.h"
 
 #include <functional>
+#include <stdexcept>
 
 #include "pkb/PKB.h"
 #include "pql/evaluator/relationships/RelationshipsUtil.h"
 
 /**
- * Helper class to associate the default result of a
- * synonym with the result of a certain attribute
+ * Helper class to hold the values of a synonym, together with
+ * the values of the attribute of the synonym in a with clause.
+ *
+ * Values are kept as they are in the PKB, with statement numbers
+ * and constants as integers and names as strings, and are only
+ * converted into strings for the results of the clause.
  */
-class WithPair {
+class WithValues {
 public:
-    String synonymResult;
-    String attributeResult;
-    WithPair(String synonym, String attribute): synonymResult(std::move(synonym)), attributeResult(std::move(attribute))
-    {}
+    // values of an integer attribute, which are also the values of the synonym
+    Vector<Integer> integers;
+    // values of a name attribute
+    Vector<String> names;
+    // the statement that each name belongs to, or empty if the names are also the values of the synonym
+    Vector<Integer> statements;
 
-    explicit WithPair(const Pair<String, String>& synAttrPair):
-        synonymResult(synAttrPair.first), attributeResult(synAttrPair.second)
-    {}
-};
+    explicit WithValues(Vector<Integer> integers): integers(std::move(integers)), names(), statements() {}
 
-/**
- * Given raw results from the PKB, convert them into WithPairs
- * where the attribute result is the same as the synonym result.
- *
- * @param numericalResults Raw results {r1, r2, ..., rn} from PKB.
- * @return WithPairs of (rn, rn) where rn == rn and rn is a string.
- */
-std::vector<WithPair> convertToWithPairs(const Vector<Integer>& numericalResults)
-{
-    std::vector<WithPair> pairs;
-    for (Integer res : numericalResults) {
-        std::string resStr = std::to_string(res);
-        pairs.emplace_back(resStr, resStr);
-    }
-    return pairs;
-}
+    explicit WithValues(Vector<String> names): integers(), names(std::move(names)), statements() {}
 
-/**
- * Given raw results from the PKB, convert them into WithPairs
- * where the attribute result is the same as the synonym result.
- *
- * @param stringResults Raw results {r1, r2, ..., rn} from PKB.
- * @return WithPairs of (rn, rn) where rn == rn.
- */
-std::vector<WithPair> convertToWithPairs(const Vector<String>& stringResults)
-{
-    std::vector<WithPair> pairs;
-    for (const String& res : stringResults) {
-        pairs.emplace_back(res, res);
+    WithValues(Vector<String> names, Vector<Integer> statements):
+        integers(), names(std::move(names)), statements(std::move(statements))
+    {}
+
+    Boolean isInteger() const
+    {
+        return names.empty() && !integers.empty();
     }
-    return pairs;
-}
 
-/**
- * Given raw results from the PKB, convert them into WithPairs.
- *
- * @param pairedResult Raw results {(s1, r1), (s2, r2), ..., (sn, rn)} from PKB.
- * @return WithPairs of (sn, rn) where sn is a string.
- */
-std::vector<WithPair> convertToWithPairs(const Vector<Pair<Integer, String>>& pairedResult)
-{
-    std::vector<WithPair> pairs;
-    for (const Pair<Integer, String>& res : pairedResult) {
-        pairs.emplace_back(std::to_string(res.first), res.second);
+    /**
+     * Gets the value of the synonym at an index, as a string.
+     */
+    String getSynonymValue(size_t index) const
+    {
+        if (!integers.empty()) {
+            return std::to_string(integers[index]);
+        }
+        return statements.empty() ? names[index] : std::to_string(statements[index]);
     }
-    return pairs;
-}
+};
 
-/**
- * Given raw results from the PKB, convert them into WithPairs.
- *
- * @param pairedResult Raw results {(s1, r1), (s2, r2), ..., (sn, rn)} from PKB.
- * @return WithPairs of (sn, rn).
- */
-std::vector<WithPair> convertToWithPairs(const Vector<Pair<String, String>>& pairedResult)
+std::function<WithValues()> createGetStatementsFunction(StatementType stmtType)
 {
-    std::vector<WithPair> pairs;
-    for (const Pair<String, String>& res : pairedResult) {
-        pairs.emplace_back(res);
-    }
-    return pairs;
+    return [stmtType]() {
+        return WithValues(getAllStatements(stmtType));
+    };
 }
 
-std::function<std::vector<WithPair>()> createGetStatementsFunction(StatementType stmtType)
+std::function<WithValues()> createGetNamesOfStatementsFunction(StatementType stmtType)
 {
     return [stmtType]() {
-        return convertToWithPairs(getAllStatements(stmtType));
+        Vector<Integer> statements = getAllStatements(stmtType);
+        Vector<String> names;
+        names.reserve(statements.size());
+        for (Integer stmtNum : statements) {
+            names.push_back(getStatementAttribute(stmtNum));
+        }
+        return WithValues(std::move(names), std::move(statements));
     };
 }
 
-typedef std::unordered_map<DesignEntityType, std::unordered_map<AttributeType, std::function<std::vector<WithPair>()>>>
+typedef std::unordered_map<DesignEntityType, std::unordered_map<AttributeType, std::function<WithValues()>>>
     AttributeTypeToClosureMap;
 
-typedef std::unordered_map<DesignEntityType, std::function<std::vector<WithPair>()>> SynonymTypeToClosureMap;
+typedef std::unordered_map<DesignEntityType, std::function<WithValues()>> SynonymTypeToClosureMap;
 
 AttributeTypeToClosureMap getAttributeTypeMap()
 {
     return {{StmtType, {{StmtNumberType, createGetStatementsFunction(AnyStatement)}}},
             {ReadType,
              {{StmtNumberType, createGetStatementsFunction(ReadStatement)},
-              {VarNameType,
-               []() {
-                   return convertToWithPairs(getAllModifiesStatementTuple(ReadStatement));
-               }}}},
+              {VarNameType, createGetNamesOfStatementsFunction(ReadStatement)}}},
             {PrintType,
              {{StmtNumberType, createGetStatementsFunction(PrintStatement)},
-              {VarNameType,
-               []() {
-                   return convertToWithPairs(getAllUsesStatementTuple(PrintStatement));
-               }}}},
+              {VarNameType, createGetNamesOfStatementsFunction(PrintStatement)}}},
             {CallType,
              {{StmtNumberType, createGetStatementsFunction(CallStatement)},
-              {ProcNameType,
-               []() {
-                   // TODO: Use PKB direct method
-                   std::vector<WithPair> pairs;
-                   Vector<Integer> allCallStatements = getAllStatements(CallStatement);
-                   for (Integer call : allCallStatements) {
-                       pairs.emplace_back(std::to_string(call), getProcedureCalled(call).at(0));
-                   }
-                   return pairs;
-               }}}},
+              {ProcNameType, createGetNamesOfStatementsFunction(CallStatement)}}},
             {WhileType, {{StmtNumberType, createGetStatementsFunction(WhileStatement)}}},
             {IfType, {{StmtNumberType, createGetStatementsFunction(IfStatement)}}},
             {AssignType, {{StmtNumberType, createGetStatementsFunction(AssignmentStatement)}}},
             {VariableType,
              {{VarNameType,
                []() {
-                   return convertToWithPairs(getAllVariables());
+                   return WithValues(getAllVariables());
                }}}},
             {ConstantType,
              {{ValueType,
                []() {
-                   return convertToWithPairs(getAllConstants());
+                   return WithValues(getAllConstants());
                }}}},
             {ProcedureType, {{ProcNameType, []() {
-                                  return convertToWithPairs(getAllProcedures());
+                                  return WithValues(getAllProcedures());
                               }}}}};
 }
 
@@ -157,15 +119,15 @@ SynonymTypeToClosureMap getSynonymTypeMap()
             {AssignType, createGetStatementsFunction(AssignmentStatement)},
             {VariableType,
              []() {
-                 return convertToWithPairs(getAllVariables());
+                 return WithValues(getAllVariables());
              }},
             {ConstantType,
              []() {
-                 return convertToWithPairs(getAllConstants());
+                 return WithValues(getAllConstants());
              }},
             {ProcedureType,
              []() {
-                 return convertToWithPairs(getAllProcedures());
+                 return WithValues(getAllProcedures());
              }},
             {Prog_LineType, createGetStatementsFunction(AnyStatement)}};
 }
@@ -179,9 +141,9 @@ AttributeTypeToClosureMap attributeTypeMap = getAttributeTypeMap();
  * Knowledge Base, with the help of hash maps.
  *
  * @param ref Reference to retrieve results for.
- * @return List of (syn, syn.attr) matching this reference.
+ * @return Values of the synonym and its attribute.
  */
-Vector<WithPair> retrieveResultsForVariableReference(const Reference& ref)
+WithValues retrieveResultsForVariableReference(const Reference& ref)
 {
     if (ref.getReferenceType() == AttributeRefType) {
         return attributeTypeMap[ref.getDesignEntity().getType()][ref.getAttribute().getType()]();
@@ -191,6 +153,53 @@ Vector<WithPair> retrieveResultsForVariableReference(const Reference& ref)
     }
 }
 
+/**
+ * Finds the values of a synonym whose integer attribute
+ * is equal to an integer, by looking it up in the PKB.
+ *
+ * @param type The type of the synonym.
+ * @param value The integer the attribute is equal to.
+ * @return The value of the synonym, if there is one.
+ */
+ClauseResult findSynonymWithInteger(DesignEntityType type, Integer value)
+{
+    Boolean isFound;
+    if (type == ConstantType) {
+        isFound = isConstantInProgram(value);
+    } else {
+        StatementType stmtType = mapToStatementType(type);
+        StatementType typeOfValue = getStatementType(value);
+        isFound = typeOfValue != NonExistentStatement && (stmtType == AnyStatement || stmtType == typeOfValue);
+    }
+    return isFound ? ClauseResult({std::to_string(value)}) : ClauseResult();
+}
+
+/**
+ * Finds the values of a synonym whose name attribute is
+ * equal to a name, by looking it up in the PKB.
+ *
+ * @param type The type of the synonym.
+ * @param name The name the attribute is equal to.
+ * @return The values of the synonym.
+ */
+ClauseResult findSynonymsWithName(DesignEntityType type, const String& name)
+{
+    switch (type) {
+    case VariableType:
+        return isVariableInProgram(name) ? ClauseResult({name}) : ClauseResult();
+    case ProcedureType:
+        return isProcedureInProgram(name) ? ClauseResult({name}) : ClauseResult();
+    case ReadType:
+        return convertToClauseResult(getModifiesStatements(name, ReadStatement));
+    case PrintType:
+        return convertToClauseResult(getUsesStatements(name, PrintStatement));
+    case CallType:
+        return convertToClauseResult(getAllCallStatementsByProcedure(name));
+    default:
+        throw std::runtime_error("Unknown or invalid design entity type in findSynonymsWithName");
+    }
+}
+
 /**
  * Unifies an expression where the left expression is
  * a literal and the right expression is a variable.
@@ -201,24 +210,10 @@ Vector<WithPair> retrieveResultsForVariableReference(const Reference& ref)
  */
 Void unifyLeftKnown(const Reference& literalRef, const Reference& varRef, ResultsTable* resultsTable)
 {
-    ReferenceType typeOfLiteral = literalRef.getReferenceType();
-    Vector<WithPair> resultsForVariable = retrieveResultsForVariableReference(varRef);
-    std::function<bool(const String&, const String&)> comparisonFunction = [](const String& str1, const String& str2) {
-        return str1 == str2;
-    };
-    if (typeOfLiteral == IntegerRefType) {
-        comparisonFunction = [](const String& intStr1, const String& intStr2) {
-            return std::stoi(intStr1) == std::stoi(intStr2);
-        };
-    }
-    ClauseResult matchingResults;
-    String rawLiteral = literalRef.getValue();
-    for (const WithPair& pair : resultsForVariable) {
-        // try to find a substitution that matches
-        if (comparisonFunction(pair.attributeResult, rawLiteral)) {
-            matchingResults.push_back(pair.synonymResult);
-        }
-    }
+    DesignEntityType typeOfSynonym = varRef.getDesignEntity().getType();
+    ClauseResult matchingResults = literalRef.getReferenceType() == IntegerRefType
+                                       ? findSynonymWithInteger(typeOfSynonym, std::stoi(literalRef.getValue()))
+                                       : findSynonymsWithName(typeOfSynonym, literalRef.getValue());
     resultsTable->storeResultsOne(varRef.getValue(), matchingResults);
 }
 
@@ -255,6 +250,39 @@ Void unifyBothKnown(const Reference& leftRef, const Reference& rightRef, Results
     resultsTable->storeResultsZero(unificationSuccessful);
 }
 
+/**
+ * Finds the pairs of indexes of equal keys in two lists of keys,
+ * by partitioning the smaller list into a hash table and probing
+ * it with each key of the larger list.
+ *
+ * @param leftKeys The keys of the left side.
+ * @param rightKeys The keys of the right side.
+ * @return Pairs of the index of a left key and the index of a right key equal to it.
+ */
+template <typename Key>
+Vector<Pair<size_t, size_t>> joinKeys(const Vector<Key>& leftKeys, const Vector<Key>& rightKeys)
+{
+    Boolean isLeftSmaller = leftKeys.size() <= rightKeys.size();
+    const Vector<Key>& buildKeys = isLeftSmaller ? leftKeys : rightKeys;
+    const Vector<Key>& probeKeys = isLeftSmaller ? rightKeys : leftKeys;
+    HashMap<Key, Vector<size_t>> partitions;
+    for (size_t index = 0; index < buildKeys.size(); index++) {
+        partitions[buildKeys[index]].push_back(index);
+    }
+    Vector<Pair<size_t, size_t>> matches;
+    for (size_t probeIndex = 0; probeIndex < probeKeys.size(); probeIndex++) {
+        auto partition = partitions.find(probeKeys[probeIndex]);
+        if (partition == partitions.end()) {
+            continue;
+        }
+        for (size_t buildIndex : partition->second) {
+            matches.push_back(isLeftSmaller ? Pair<size_t, size_t>(buildIndex, probeIndex)
+                                            : Pair<size_t, size_t>(probeIndex, buildIndex));
+        }
+    }
+    return matches;
+}
+
 /**
  * Unifies an expression where both expressions
  * are Synonym or Synonym.Attributes.
@@ -265,21 +293,25 @@ Void unifyBothKnown(const Reference& leftRef, const Reference& rightRef, Results
  */
 Void unifyBothAny(const Reference& leftRef, const Reference& rightRef, ResultsTable* resultsTable)
 {
+    WithValues resultsForLeft = retrieveResultsForVariableReference(leftRef);
     if (leftRef == rightRef) {
         // all substitutions work
-        resultsTable->storeResultsZero(true);
+        ClauseResult allResults;
+        for (size_t index = 0; index < resultsForLeft.integers.size() + resultsForLeft.names.size(); index++) {
+            allResults.push_back(resultsForLeft.getSynonymValue(index));
+        }
+        resultsTable->storeResultsOne(leftRef.getValue(), allResults);
+        return;
     }
-    Vector<WithPair> resultsForLeft = retrieveResultsForVariableReference(leftRef);
-    Vector<WithPair> resultsForRight = retrieveResultsForVariableReference(rightRef);
+    WithValues resultsForRight = retrieveResultsForVariableReference(rightRef);
+    // both sides have the same type of attribute in a valid query
+    Vector<Pair<size_t, size_t>> matches = resultsForLeft.isInteger() || resultsForRight.isInteger()
+                                               ? joinKeys(resultsForLeft.integers, resultsForRight.integers)
+                                               : joinKeys(resultsForLeft.names, resultsForRight.names);
     PairedResult matchingResults;
-    for (const WithPair& leftRes : resultsForLeft) {
-        for (const WithPair& rightRes : resultsForRight) {
-            // find substitutions that work and add them to results table
-            if (leftRes.attributeResult == rightRes.attributeResult) {
-                matchingResults.emplace_back(leftRes.synonymResult, rightRes.synonymResult);
-                break;
-            }
-        }
+    for (const Pair<size_t, size_t>& match : matches) {
+        matchingResults.emplace_back(resultsForLeft.getSynonymValue(match.first),
+                                     resultsForRight.getSynonymValue(match.second));
     }
     resultsTable->storeResultsTwo(leftRef.getValue(), rightRef.getValue(), matchingResults);
 }
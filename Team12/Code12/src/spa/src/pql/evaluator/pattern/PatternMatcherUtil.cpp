@@ -4,6 +4,7 @@
 
 #include "PatternMatcherUtil.h"
 
+#include <algorithm>
 #include <iterator>
 
 Void PatternMatcherTuple::addTargetStatement(Integer targetStatementNumber)
@@ -53,83 +54,66 @@ std::vector<std::pair<Integer, String>> PatternMatcherTuple::getRelationships()
     return relationshipsResults;
 }
 
-/**
- * Extracts and return all variables in the
- * given expression.
- *
- * @param expr          The given Expression.
- * @param variables     The variables set to store extracted
- *                      variables in.
- */
-Void getVariableInExpr(const Expression* expr, std::unordered_set<String>& variables)
+Void intersectStatements(const Vector<StatementNumber>& first, const Vector<StatementNumber>& second,
+                         Vector<StatementNumber>& intersection)
 {
-    if (expr->isArithmetic()) {
-        auto arithmeticExpr = static_cast<const ArithmeticExpression*>(expr); // NOLINT
-        const Expression* leftExpr = arithmeticExpr->leftFactor;
-        const Expression* rightExpr = arithmeticExpr->rightFactor;
-
-        getVariableInExpr(leftExpr, variables);
-        getVariableInExpr(rightExpr, variables);
-    } else {
-        // Reference Expression
-        auto refExpr = static_cast<const ReferenceExpression*>(expr); // NOLINT
-        const BasicDataType* basicDataType = refExpr->basicData;
-        if (basicDataType->isConstant()) {
-            return;
+    const Vector<StatementNumber>& smaller = first.size() <= second.size() ? first : second;
+    const Vector<StatementNumber>& larger = first.size() <= second.size() ? second : first;
+    for (StatementNumber stmtNum : smaller) {
+        if (std::binary_search(larger.begin(), larger.end(), stmtNum)) {
+            intersection.push_back(stmtNum);
         }
-
-        const auto* variable = static_cast<const Variable*>(basicDataType); // NOLINT
-        variables.insert(variable->varName);
     }
 }
 
-/**
- * Extracts and return all variables in the
- * given conditional expression.
- *
- * @param condExpr      The given ConditonalExpression.
- * @param variables     The variables set to store extracted
- *                      variables in.
- */
-Void getLiteralVariablesInCondExpr(const ConditionalExpression* condExpr, std::unordered_set<String>& variables)
+Void evaluateContainerPattern(PatternClause* pnClause, ResultsTable* resultsTable, StatementType containerType)
 {
-    auto conditionType = condExpr->getConditionalType();
-    switch (conditionType) {
-    case NotConditionalExpression: {
-        auto notCondExpr = static_cast<const NotExpression*>(condExpr); // NOLINT
-        const ConditionalExpression* negatedCondExpression = notCondExpr->expression;
-
-        getLiteralVariablesInCondExpr(negatedCondExpression, variables);
-        break;
-    }
-    case OrConditionalExpression: {
-        auto orCondExpr = static_cast<const OrExpression*>(condExpr); // NOLINT
-        const ConditionalExpression* leftCondExpr = orCondExpr->leftExpression;
-        const ConditionalExpression* rightCondExpr = orCondExpr->rightExpression;
-
-        getLiteralVariablesInCondExpr(leftCondExpr, variables);
-        getLiteralVariablesInCondExpr(rightCondExpr, variables);
+    const PatternIndex& index = getPatternIndex();
+    Reference controlVariableRef = pnClause->getEntRef();
+    PatternMatcherTuple allResults;
+    switch (controlVariableRef.getReferenceType()) {
+    case WildcardRefType:
+        for (StatementNumber stmtNum : index.getAllContainers(containerType)) {
+            allResults.addTargetStatement(stmtNum);
+        }
+        resultsTable->storeResultsOne(pnClause->getPatternSynonym(), allResults.getTargetStatements());
         break;
-    }
-    case AndConditionalExpression: {
-        auto andCondExpr = static_cast<const AndExpression*>(condExpr); // NOLINT
-        const ConditionalExpression* leftCondExpr = andCondExpr->leftExpression;
-        const ConditionalExpression* rightCondExpr = andCondExpr->rightExpression;
-
-        getLiteralVariablesInCondExpr(leftCondExpr, variables);
-        getLiteralVariablesInCondExpr(rightCondExpr, variables);
+    case LiteralRefType:
+        for (StatementNumber stmtNum : index.getContainersUsing(containerType, controlVariableRef.getValue())) {
+            allResults.addTargetStatement(stmtNum);
+        }
+        resultsTable->storeResultsOne(pnClause->getPatternSynonym(), allResults.getTargetStatements());
         break;
-    }
-    case RelationalConditionalExpression: {
-        auto relCondExpr = static_cast<const RelationalExpression*>(condExpr); // NOLINT
-        const Expression* leftExpr = relCondExpr->leftFactor;
-        const Expression* rightExpr = relCondExpr->rightFactor;
-
-        getVariableInExpr(leftExpr, variables);
-        getVariableInExpr(rightExpr, variables);
+    case SynonymRefType: {
+        // values that the synonyms can still take, from the clauses evaluated before
+        const ResultsSet* containerCandidates = resultsTable->getCandidates(pnClause->getPatternSynonym());
+        const ResultsSet* variableCandidates = resultsTable->getCandidates(controlVariableRef.getValue());
+        if (variableCandidates != nullptr
+            && (containerCandidates == nullptr || variableCandidates->size() <= containerCandidates->size())) {
+            for (const String& variable : *variableCandidates) {
+                for (StatementNumber stmtNum : index.getContainersUsing(containerType, variable)) {
+                    allResults.addTargetStatement(stmtNum, variable);
+                }
+            }
+        } else if (containerCandidates != nullptr) {
+            for (const String& container : *containerCandidates) {
+                StatementNumber stmtNum = std::stoi(container);
+                for (const Name& variable : index.getControlVariables(stmtNum)) {
+                    allResults.addTargetStatement(stmtNum, variable);
+                }
+            }
+        } else {
+            for (StatementNumber stmtNum : index.getAllContainers(containerType)) {
+                for (const Name& variable : index.getControlVariables(stmtNum)) {
+                    allResults.addTargetStatement(stmtNum, variable);
+                }
+            }
+        }
+        resultsTable->storeResultsTwo(pnClause->getPatternSynonym(), allResults.getTargetStatements(),
+                                      controlVariableRef, convertToPairedResult(allResults.getRelationships()));
         break;
     }
     default:
-        throw std::runtime_error("Unknown or invalid expression type in getLiteralVariablesInCondExpr");
+        throw std::runtime_error("Unknown or invalid reference type in evaluateContainerPattern");
     }
-}
\ No newline at end of file
+}
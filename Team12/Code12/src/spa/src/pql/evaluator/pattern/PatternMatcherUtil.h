@@ -65,7 +65,26 @@ public:
     std::vector<std::pair<Integer, String>> getRelationships() const;
 };
 
-Void getVariableInExpr(const Expression* expr, std::unordered_set<String>& variables);
-Void getLiteralVariablesInCondExpr(const ConditionalExpression* condExpr, std::unordered_set<String>& variables);
+/**
+ * Finds the statements in both of two sorted lists of statements,
+ * by searching the larger list for each statement in the smaller.
+ *
+ * @param first A list of statements in ascending order.
+ * @param second Another list of statements in ascending order.
+ * @param intersection The vector to add the common statements to,
+ *                     in ascending order.
+ */
+Void intersectStatements(const Vector<StatementNumber>& first, const Vector<StatementNumber>& second,
+                         Vector<StatementNumber>& intersection);
+
+/**
+ * Evaluates an if or while pattern clause from the
+ * control variables in the pattern index of the PKB.
+ *
+ * @param pnClause A pattern clause in the query.
+ * @param resultsTable The results table to store the results in.
+ * @param containerType IfStatement or WhileStatement.
+ */
+Void evaluateContainerPattern(PatternClause* pnClause, ResultsTable* resultsTable, StatementType containerType);
 
 #endif // SPA_PQL_PATTERN_MATCHER_UTIL_H
@@ -9,10 +9,9 @@
 #include "PatternMatcherUtil.h"
 
 /**
- * Given a while pattern clause, retrieves the SIMPLE
- * program from the Program Knowledge Base (root node of
- * Abstract Syntax Tree) and tries to find the while
- * statement by matching the variable in the clause.
+ * Given a while pattern clause, finds the while statements
+ * that match the variable in the clause, from the control
+ * variables in the pattern index of the Program Knowledge Base.
  *
  * @param pnClause A pattern clause in the query.
  * @param resultsTable The results table to store the results in.
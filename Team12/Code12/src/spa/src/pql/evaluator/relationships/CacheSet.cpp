@@ -9,7 +9,11 @@
 
 CacheSet::CacheSet(std::unordered_set<StatementNumber> unorderedSet): set(std::move(unorderedSet)) {}
 
-CacheSet::CacheSet(const Vector<StatementNumber>& nonStarRelationshipResults)
+CacheSet::CacheSet(const Vector<StatementNumber>& nonStarRelationshipResults):
+    CacheSet(VectorView<StatementNumber>(nonStarRelationshipResults))
+{}
+
+CacheSet::CacheSet(VectorView<StatementNumber> nonStarRelationshipResults)
 {
     for (auto stmtNum : nonStarRelationshipResults) {
         set.insert(stmtNum);
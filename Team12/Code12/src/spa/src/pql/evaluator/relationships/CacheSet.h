@@ -28,6 +28,7 @@ public:
      * without the filtering of the Statement Type.
      */
     explicit CacheSet(const Vector<StatementNumber>& nonStarRelationshipResults);
+    explicit CacheSet(VectorView<StatementNumber> nonStarRelationshipResults);
 
     /**
      * Inserts a StatementNumber into the set.
@@ -4,96 +4,91 @@
  */
 #include "CallsEvaluator.h"
 
-#include <stdexcept>
+#include "RelationshipEvaluator.h"
 
-#include "RelationshipsUtil.h"
-
-class CallsEvaluator {
-private:
-    Reference leftRef;
-    Reference rightRef;
-    Boolean isStar;
-    ResultsTable* resultsTable;
-    Boolean (*pkbBothKnownFunction)(const String&, const String&);
+/**
+ * Traits of the Calls relationship between procedures,
+ * for RelationshipEvaluator. As recursive calls are not
+ * allowed, no procedure calls itself.
+ */
+class CallsTraits {
+public:
+    typedef ProcedureName LeftValue;
+    typedef ProcedureName RightValue;
+    static const Boolean leftIsStatement = false;
+    static const Boolean rightIsStatement = false;
+    static const Boolean canRelateToItself = false;
 
-    // case where left is known (integer), right is variable
-    Void evaluateLeftKnown() const;
-    // case where left is variable, right is known (integer)
-    Void evaluateRightKnown() const;
-    // case where both are variable
-    Void evaluateBothAny() const;
-    // case where both are known
-    Void evaluateBothKnown(const String& leftRefVal, const String& rightRefVal) const;
+    static Boolean holds(const ProcedureName& caller, const ProcedureName& callee)
+    {
+        return checkIfCallsHolds(caller, callee);
+    }
+    static ClauseResult findRight(const ProcedureName& caller, StatementType)
+    {
+        return getAllCallees(caller);
+    }
+    static ClauseResult findLeft(const ProcedureName& callee, StatementType)
+    {
+        return getAllCallers(callee);
+    }
+    static ClauseResult findAllLeft(StatementType, StatementType)
+    {
+        return getAllCallees();
+    }
+    static ClauseResult findAllRight(StatementType, StatementType)
+    {
+        return getAllCallers();
+    }
+    static PairedResult findAllPairs(StatementType, StatementType)
+    {
+        return getAllCallsTuple();
+    }
+};
 
+/**
+ * Traits of the Calls* relationship between procedures,
+ * for RelationshipEvaluator.
+ */
+class CallsStarTraits {
 public:
-    CallsEvaluator(Reference leftRef, Reference rightRef, Boolean isStar, ResultsTable* resultsTable):
-        leftRef(std::move(leftRef)), rightRef(std::move(rightRef)), isStar(isStar), resultsTable(resultsTable),
-        pkbBothKnownFunction(isStar ? checkIfCallsHoldsStar : checkIfCallsHolds)
-    {}
-    Void evaluateCallsClause() const;
+    typedef ProcedureName LeftValue;
+    typedef ProcedureName RightValue;
+    static const Boolean leftIsStatement = false;
+    static const Boolean rightIsStatement = false;
+    static const Boolean canRelateToItself = false;
+
+    static Boolean holds(const ProcedureName& caller, const ProcedureName& callee)
+    {
+        return checkIfCallsHoldsStar(caller, callee);
+    }
+    static ClauseResult findRight(const ProcedureName& caller, StatementType)
+    {
+        return getAllCalleesStar(caller);
+    }
+    static ClauseResult findLeft(const ProcedureName& callee, StatementType)
+    {
+        return getAllCallersStar(callee);
+    }
+    static ClauseResult findAllLeft(StatementType, StatementType)
+    {
+        return getAllCalleesStar();
+    }
+    static ClauseResult findAllRight(StatementType, StatementType)
+    {
+        return getAllCallersStar();
+    }
+    static PairedResult findAllPairs(StatementType, StatementType)
+    {
+        return getAllCallsTupleStar();
+    }
 };
 
 Void evaluateCallsClause(const Reference& leftRef, const Reference& rightRef, Boolean isStar,
                          ResultsTable* resultsTable)
 {
-    CallsEvaluator evaluator(leftRef, rightRef, isStar, resultsTable);
-    evaluator.evaluateCallsClause();
-}
-
-Void CallsEvaluator::evaluateLeftKnown() const
-{
-    Vector<ProcedureName> (*function)(const ProcedureName&) = getAllCallees;
-    Vector<ProcedureName> (*starFunction)(const ProcedureName&) = getAllCalleesStar;
-    resultsTable->storeResultsOne(rightRef, (isStar ? starFunction : function)(leftRef.getValue()));
-}
-
-Void CallsEvaluator::evaluateRightKnown() const
-{
-    Vector<ProcedureName> (*function)(const ProcedureName&) = getAllCallers;
-    Vector<ProcedureName> (*starFunction)(const ProcedureName&) = getAllCallersStar;
-    resultsTable->storeResultsOne(leftRef, (isStar ? starFunction : function)(rightRef.getValue()));
-}
-
-Void CallsEvaluator::evaluateBothAny() const
-{
-    ClauseResult leftResults;
-    ClauseResult rightResults;
-    PairedResult tuples;
     if (isStar) {
-        leftResults = getAllCalleesStar();
-        rightResults = getAllCallersStar();
-        tuples = getAllCallsTupleStar();
-    } else {
-        leftResults = getAllCallees();
-        rightResults = getAllCallers();
-        tuples = getAllCallsTuple();
-    }
-    resultsTable->storeResultsTwo(leftRef, leftResults, rightRef, rightResults, tuples);
-}
-
-Void CallsEvaluator::evaluateBothKnown(const String& leftRefVal, const String& rightRefVal) const
-{
-    resultsTable->storeResultsZero(pkbBothKnownFunction(leftRefVal, rightRefVal));
-}
-
-Void CallsEvaluator::evaluateCallsClause() const
-{
-    ReferenceType leftRefType = leftRef.getReferenceType();
-    ReferenceType rightRefType = rightRef.getReferenceType();
-    if (leftRefType == LiteralRefType && canMatchMultiple(rightRefType)) {
-        evaluateLeftKnown();
-    } else if (canMatchMultiple(leftRefType) && rightRefType == LiteralRefType) {
-        evaluateRightKnown();
-    } else if (leftRefType == LiteralRefType && rightRefType == LiteralRefType) {
-        evaluateBothKnown(leftRef.getValue(), rightRef.getValue());
-    } else if (!leftRef.isWildCard() && leftRef.getValue() == rightRef.getValue()) {
-        // if left == right, for Calls this will always return empty
-        // this is because recursive calls are not allowed
-        resultsTable->storeResultsOne(leftRef, std::vector<String>());
-    } else if (canMatchMultiple(leftRefType) && canMatchMultiple(rightRefType)) {
-        evaluateBothAny();
+        RelationshipEvaluator<CallsStarTraits>::evaluate(leftRef, rightRef, resultsTable);
     } else {
-        throw std::runtime_error(
-            "Error in CallsEvaluator::evaluateCallsClause: No synonyms or string literals in Calls clause");
+        RelationshipEvaluator<CallsTraits>::evaluate(leftRef, rightRef, resultsTable);
     }
 }
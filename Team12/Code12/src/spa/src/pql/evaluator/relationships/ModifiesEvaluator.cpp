@@ -4,113 +4,90 @@
  */
 #include "ModifiesEvaluator.h"
 
-#include <stdexcept>
-
-#include "RelationshipsUtil.h"
-
-class ModifiesEvaluator {
-private:
-    Reference leftRef;
-    Reference rightRef;
-    ResultsTable* resultsTable;
-    // these will determine whether it is a statement or procedure Modifies
-    ReferenceType leftRefType;
-
-    // case where left is known, right is variable
-    Void evaluateLeftKnown() const;
-    // case where left is variable, right is known (string)
-    Void evaluateRightKnown() const;
-    // case where both are variable
-    Void evaluateBothAny() const;
-    // case where both are known
-    Void evaluateBothKnown() const;
+#include "RelationshipEvaluator.h"
 
+/**
+ * Traits of the Modifies relationship between statements and
+ * variables, for RelationshipEvaluator.
+ */
+class ModifiesStatementTraits {
 public:
-    ModifiesEvaluator(Reference leftRef, Reference rightRef, ResultsTable* resultsTable):
-        leftRef(std::move(leftRef)), rightRef(std::move(rightRef)), resultsTable(resultsTable),
-        leftRefType(leftRef.getReferenceType())
-    {}
-    Void evaluateModifiesClause() const;
-};
+    typedef Integer LeftValue;
+    typedef String RightValue;
+    static const Boolean leftIsStatement = true;
+    static const Boolean rightIsStatement = false;
+    static const Boolean canRelateToItself = false;
 
-Void evaluateModifiesClause(const Reference& leftRef, const Reference& rightRef, ResultsTable* resultsTable)
-{
-    ModifiesEvaluator evaluator(leftRef, rightRef, resultsTable);
-    evaluator.evaluateModifiesClause();
-}
+    static Boolean holds(Integer stmtNum, const String& varName)
+    {
+        return checkIfStatementModifies(stmtNum, varName);
+    }
+    static ClauseResult findRight(Integer stmtNum, StatementType)
+    {
+        return getModifiesVariablesFromStatement(stmtNum);
+    }
+    static ClauseResult findLeft(const String& varName, StatementType stmtType)
+    {
+        return convertToClauseResult(getModifiesStatements(varName, stmtType));
+    }
+    static ClauseResult findAllLeft(StatementType stmtType, StatementType)
+    {
+        return convertToClauseResult(getAllModifiesStatements(stmtType));
+    }
+    static ClauseResult findAllRight(StatementType stmtType, StatementType)
+    {
+        return getAllModifiesVariablesFromStatementType(stmtType);
+    }
+    static PairedResult findAllPairs(StatementType stmtType, StatementType)
+    {
+        return convertToPairedResult(viewAllModifiesStatementTuple(stmtType));
+    }
+};
 
-Void ModifiesEvaluator::evaluateLeftKnown() const
-{
-    ClauseResult tempResult = leftRefType == IntegerRefType
-                                  ? getModifiesVariablesFromStatement(std::stoi(leftRef.getValue()))
-                                  : getModifiesVariablesFromProcedure(leftRef.getValue());
-    resultsTable->storeResultsOne(rightRef, tempResult);
-}
+/**
+ * Traits of the Modifies relationship between procedures and
+ * variables, for RelationshipEvaluator.
+ */
+class ModifiesProcedureTraits {
+public:
+    typedef ProcedureName LeftValue;
+    typedef String RightValue;
+    static const Boolean leftIsStatement = false;
+    static const Boolean rightIsStatement = false;
+    static const Boolean canRelateToItself = false;
 
-Void ModifiesEvaluator::evaluateRightKnown() const
-{
-    DesignEntityType leftType = resultsTable->getTypeOfSynonym(leftRef.getValue());
-    if (isStatementDesignEntity(leftType)) {
-        resultsTable->storeResultsOne(
-            leftRef, convertToClauseResult(getModifiesStatements(rightRef.getValue(), mapToStatementType(leftType))));
-    } else {
-        // left ref is a procedure
-        resultsTable->storeResultsOne(leftRef, getModifiesProcedures(rightRef.getValue()));
+    static Boolean holds(const ProcedureName& procName, const String& varName)
+    {
+        return checkIfProcedureModifies(procName, varName);
     }
-}
-
-Void ModifiesEvaluator::evaluateBothAny() const
-{
-    Boolean isStatementLeft
-        = leftRefType == SynonymRefType && isStatementDesignEntity(resultsTable->getTypeOfSynonym(leftRef.getValue()));
-    ClauseResult leftResults;
-    ClauseResult rightResults;
-    PairedResult tuples;
-    if (isStatementLeft) {
-        StatementType leftStmtType = mapToStatementType(resultsTable->getTypeOfSynonym(leftRef.getValue()));
-        // select stmt
-        leftResults = convertToClauseResult(getAllModifiesStatements(leftStmtType));
-        // select variable with statement
-        rightResults = getAllModifiesVariablesFromStatementType(leftStmtType);
-        // select all tuples Modifies(stmt, variable)
-        tuples = convertToPairedResult(getAllModifiesStatementTuple(leftStmtType));
-    } else if (leftRefType == SynonymRefType) {
-        // select procedure
-        leftResults = getAllModifiesProcedures();
-        // select variable with procedure
-        rightResults = getAllModifiesVariablesFromProgram();
-        // select all tuples Modifies(procedure, variable)
-        tuples = getAllModifiesProcedureTuple();
-    } else {
-        throw std::runtime_error("Unknown case in ModifiesExtractor::evaluateBothAny");
+    static ClauseResult findRight(const ProcedureName& procName, StatementType)
+    {
+        return getModifiesVariablesFromProcedure(procName);
     }
-    resultsTable->storeResultsTwo(leftRef, leftResults, rightRef, rightResults, tuples);
-}
-
-Void ModifiesEvaluator::evaluateBothKnown() const
-{
-    Boolean modifiesHolds;
-    if (leftRefType == IntegerRefType) {
-        modifiesHolds = checkIfStatementModifies(std::stoi(leftRef.getValue()), rightRef.getValue());
-    } else {
-        // leftRefType == LiteralRefType
-        modifiesHolds = checkIfProcedureModifies(leftRef.getValue(), rightRef.getValue());
+    static ClauseResult findLeft(const String& varName, StatementType)
+    {
+        return getModifiesProcedures(varName);
     }
-    resultsTable->storeResultsZero(modifiesHolds);
-}
+    static ClauseResult findAllLeft(StatementType, StatementType)
+    {
+        return getAllModifiesProcedures();
+    }
+    static ClauseResult findAllRight(StatementType, StatementType)
+    {
+        return getAllModifiesVariablesFromProgram();
+    }
+    static PairedResult findAllPairs(StatementType, StatementType)
+    {
+        return getAllModifiesProcedureTuple();
+    }
+};
 
-Void ModifiesEvaluator::evaluateModifiesClause() const
+Void evaluateModifiesClause(const Reference& leftRef, const Reference& rightRef, ResultsTable* resultsTable)
 {
-    ReferenceType rightRefType = rightRef.getReferenceType();
-    if (canMatchOnlyOne(leftRefType) && canMatchMultiple(rightRefType)) {
-        evaluateLeftKnown();
-    } else if (canMatchMultiple(leftRefType) && canMatchOnlyOne(rightRefType)) {
-        evaluateRightKnown();
-    } else if (canMatchOnlyOne(leftRefType) && canMatchOnlyOne(rightRefType)) {
-        evaluateBothKnown();
-    } else if (canMatchMultiple(leftRefType) && canMatchMultiple(rightRefType)) {
-        evaluateBothAny();
+    // the left reference determines whether it is a statement or procedure Modifies
+    if (isStatementReference(leftRef, resultsTable)) {
+        RelationshipEvaluator<ModifiesStatementTraits>::evaluate(leftRef, rightRef, resultsTable);
     } else {
-        throw std::runtime_error("Error in ModifiesEvaluator::evaluateModifiesClause: invalid arguments in Modifies");
+        RelationshipEvaluator<ModifiesProcedureTraits>::evaluate(leftRef, rightRef, resultsTable);
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,158 @@
+/**
+ * A template for the evaluators of such that clauses with
+ * relationships that are read from the tables in the PKB.
+ * Each relationship is described by a traits class, and
+ * the evaluator generated from it is specialised for that
+ * relationship at compile time.
+ */
+#ifndef SPA_PQL_RELATIONSHIP_EVALUATOR_H
+#define SPA_PQL_RELATIONSHIP_EVALUATOR_H
+
+#include <stdexcept>
+
+#include "RelationshipsUtil.h"
+
+/**
+ * Converts the value of a Reference to the type of
+ * the entities on one side of a relationship, namely
+ * a statement number (Integer) or a name (String).
+ */
+template <typename Value>
+Value toRelationshipValue(const String& refValue);
+
+template <>
+inline Integer toRelationshipValue<Integer>(const String& refValue)
+{
+    return std::stoi(refValue);
+}
+
+template <>
+inline String toRelationshipValue<String>(const String& refValue)
+{
+    return refValue;
+}
+
+/**
+ * Gets the StatementType of the statements that a Reference
+ * can match, where a wildcard matches any statement.
+ */
+inline StatementType getStatementTypeOfReference(const Reference& ref, ResultsTable* resultsTable)
+{
+    return ref.isWildCard() ? AnyStatement : mapToStatementType(resultsTable->getTypeOfSynonym(ref.getValue()));
+}
+
+/**
+ * Evaluates such that clauses of the relationship described by
+ * Traits. Every case of the references in the clause (left known,
+ * right known, both known or both able to match multiple results)
+ * calls the PKB accessors of Traits directly, so the relationship
+ * and whether it is transitive are decided at compile time.
+ *
+ * Traits must provide the following members:
+ *
+ * LeftValue, RightValue: The types of the entities on each side
+ *     of the relationship, either Integer or String.
+ * leftIsStatement, rightIsStatement: Whether the entities on each
+ *     side are statements, which can be filtered by StatementType.
+ *     The StatementType passed for the other side is AnyStatement.
+ * canRelateToItself: Whether an entity can be related to itself,
+ *     otherwise a clause with the same synonym on both sides of
+ *     the relationship has no results.
+ * holds(left, right): Checks if the relationship holds.
+ * findRight(left, rightType): Finds the right entities of a left one.
+ * findLeft(right, leftType): Finds the left entities of a right one.
+ * findAllLeft(leftType, rightType), findAllRight(leftType, rightType),
+ * findAllPairs(leftType, rightType): Finds the entities on each side,
+ *     and the pairs of them, of every relationship in the program.
+ */
+template <typename Traits>
+class RelationshipEvaluator {
+private:
+    typedef typename Traits::LeftValue LeftValue;
+    typedef typename Traits::RightValue RightValue;
+
+    static StatementType getLeftStatementType(const Reference& leftRef, ResultsTable* resultsTable)
+    {
+        return Traits::leftIsStatement ? getStatementTypeOfReference(leftRef, resultsTable) : AnyStatement;
+    }
+
+    static StatementType getRightStatementType(const Reference& rightRef, ResultsTable* resultsTable)
+    {
+        return Traits::rightIsStatement ? getStatementTypeOfReference(rightRef, resultsTable) : AnyStatement;
+    }
+
+    // case where left is known, right is variable
+    static Void evaluateLeftKnown(const Reference& leftRef, const Reference& rightRef, ResultsTable* resultsTable)
+    {
+        resultsTable->storeResultsOne(rightRef,
+                                      Traits::findRight(toRelationshipValue<LeftValue>(leftRef.getValue()),
+                                                        getRightStatementType(rightRef, resultsTable)));
+    }
+
+    // case where left is variable, right is known
+    static Void evaluateRightKnown(const Reference& leftRef, const Reference& rightRef, ResultsTable* resultsTable)
+    {
+        resultsTable->storeResultsOne(leftRef, Traits::findLeft(toRelationshipValue<RightValue>(rightRef.getValue()),
+                                                                getLeftStatementType(leftRef, resultsTable)));
+    }
+
+    // case where both are known
+    static Void evaluateBothKnown(const Reference& leftRef, const Reference& rightRef, ResultsTable* resultsTable)
+    {
+        resultsTable->storeResultsZero(Traits::holds(toRelationshipValue<LeftValue>(leftRef.getValue()),
+                                                     toRelationshipValue<RightValue>(rightRef.getValue())));
+    }
+
+    // case where both are variable
+    static Void evaluateBothAny(const Reference& leftRef, const Reference& rightRef, ResultsTable* resultsTable)
+    {
+        StatementType leftStmtType = getLeftStatementType(leftRef, resultsTable);
+        StatementType rightStmtType = getRightStatementType(rightRef, resultsTable);
+        // if either synonym is restricted by earlier clauses, only find the relationships of its values
+        if (evaluateFromCandidates(
+                leftRef, rightRef, resultsTable,
+                [rightStmtType](const String& leftValue) {
+                    return Traits::findRight(toRelationshipValue<LeftValue>(leftValue), rightStmtType);
+                },
+                [leftStmtType](const String& rightValue) {
+                    return Traits::findLeft(toRelationshipValue<RightValue>(rightValue), leftStmtType);
+                })) {
+            return;
+        }
+        resultsTable->storeResultsTwo(leftRef, Traits::findAllLeft(leftStmtType, rightStmtType), rightRef,
+                                      Traits::findAllRight(leftStmtType, rightStmtType),
+                                      Traits::findAllPairs(leftStmtType, rightStmtType));
+    }
+
+public:
+    /**
+     * Processes a single such that clause of the relationship in
+     * a PQL query, and stores the results in the results table.
+     *
+     * @param leftRef The left reference in the relationship.
+     * @param rightRef The right reference in the relationship.
+     * @param resultsTable Table containing past results, to store
+     *                     the results of evaluating this clause.
+     */
+    static Void evaluate(const Reference& leftRef, const Reference& rightRef, ResultsTable* resultsTable)
+    {
+        ReferenceType leftRefType = leftRef.getReferenceType();
+        ReferenceType rightRefType = rightRef.getReferenceType();
+        if (canMatchOnlyOne(leftRefType) && canMatchMultiple(rightRefType)) {
+            evaluateLeftKnown(leftRef, rightRef, resultsTable);
+        } else if (canMatchMultiple(leftRefType) && canMatchOnlyOne(rightRefType)) {
+            evaluateRightKnown(leftRef, rightRef, resultsTable);
+        } else if (canMatchOnlyOne(leftRefType) && canMatchOnlyOne(rightRefType)) {
+            evaluateBothKnown(leftRef, rightRef, resultsTable);
+        } else if (!Traits::canRelateToItself && !leftRef.isWildCard() && leftRef.getValue() == rightRef.getValue()) {
+            // the same synonym on both sides never has any results
+            resultsTable->storeResultsOne(leftRef, ClauseResult());
+        } else if (canMatchMultiple(leftRefType) && canMatchMultiple(rightRefType)) {
+            evaluateBothAny(leftRef, rightRef, resultsTable);
+        } else {
+            throw std::runtime_error("Error in RelationshipEvaluator::evaluate: invalid references in clause");
+        }
+    }
+};
+
+#endif // SPA_PQL_RELATIONSHIP_EVALUATOR_H
@@ -0,0 +1,51 @@
+/**
+ * Implementation of utility functions for Query
+ * Evaluator, for "such that" clauses describing
+ * relationships between design entities.
+ */
+#include "RelationshipsUtil.h"
+
+#include <unordered_set>
+
+/**
+ * Gets the values that a reference can still take in the
+ * results table, or nullptr if it is not restricted.
+ */
+const ResultsSet* getCandidatesForReference(const Reference& ref, ResultsTable* resultsTable)
+{
+    return ref.getReferenceType() == SynonymRefType ? resultsTable->getCandidates(ref.getValue()) : nullptr;
+}
+
+Boolean evaluateFromCandidates(const Reference& leftRef, const Reference& rightRef, ResultsTable* resultsTable,
+                               const RelatedValuesFunction& findRight, const RelatedValuesFunction& findLeft)
+{
+    const ResultsSet* leftCandidates = getCandidatesForReference(leftRef, resultsTable);
+    const ResultsSet* rightCandidates = getCandidatesForReference(rightRef, resultsTable);
+    if (leftCandidates == nullptr && rightCandidates == nullptr) {
+        return false;
+    }
+    PairedResult tuples;
+    if (rightCandidates == nullptr
+        || (leftCandidates != nullptr && leftCandidates->size() <= rightCandidates->size())) {
+        for (const String& leftValue : *leftCandidates) {
+            for (const String& rightValue : findRight(leftValue)) {
+                tuples.emplace_back(leftValue, rightValue);
+            }
+        }
+    } else {
+        for (const String& rightValue : *rightCandidates) {
+            for (const String& leftValue : findLeft(rightValue)) {
+                tuples.emplace_back(leftValue, rightValue);
+            }
+        }
+    }
+    std::unordered_set<String> leftResults;
+    std::unordered_set<String> rightResults;
+    for (const std::pair<String, String>& tuple : tuples) {
+        leftResults.insert(tuple.first);
+        rightResults.insert(tuple.second);
+    }
+    resultsTable->storeResultsTwo(leftRef, ClauseResult(leftResults.begin(), leftResults.end()), rightRef,
+                                  ClauseResult(rightResults.begin(), rightResults.end()), tuples);
+    return true;
+}
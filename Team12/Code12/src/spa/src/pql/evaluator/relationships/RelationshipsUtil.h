@@ -8,6 +8,8 @@
 #ifndef SPA_PQL_EVALUATOR_RELATIONSHIPS_UTIL_H
 #define SPA_PQL_EVALUATOR_RELATIONSHIPS_UTIL_H
 
+#include <functional>
+
 #include "pkb/PKB.h"
 #include "pql/evaluator/ResultsTable.h"
 #include "pql/preprocessor/AqTypes.h"
@@ -76,4 +78,45 @@ inline Boolean canMatchOnlyOne(const ReferenceType& refType)
     return (refType == IntegerRefType || refType == LiteralRefType);
 }
 
+/**
+ * Checks if a Reference on the left of a Uses or Modifies
+ * relationship refers to statements, rather than procedures.
+ *
+ * @param ref The Reference to be checked.
+ * @param resultsTable The results table holding the
+ *                     declarations of the query.
+ * @return True, if the Reference is a statement number
+ *         or a synonym of statements. Otherwise, false.
+ */
+inline Boolean isStatementReference(const Reference& ref, ResultsTable* resultsTable)
+{
+    return ref.getReferenceType() == IntegerRefType
+           || (ref.getReferenceType() == SynonymRefType
+               && isStatementDesignEntity(resultsTable->getTypeOfSynonym(ref.getValue())));
+}
+
+//================ HELPER METHODS FOR CANDIDATE VALUES ================
+
+// Finds the values of one reference in a relationship that are related to a value of the other
+typedef std::function<ClauseResult(const String&)> RelatedValuesFunction;
+
+/**
+ * Evaluates a clause with two references that can match multiple
+ * results, from the values that the references can still take in
+ * the results table. The reference with fewer values is enumerated,
+ * so that only the results agreeing with the clauses evaluated
+ * before are found, instead of every relationship in the program.
+ *
+ * @param leftRef The left reference in the clause.
+ * @param rightRef The right reference in the clause.
+ * @param resultsTable The results table to store the results in.
+ * @param findRight Finds the right values related to a left value.
+ * @param findLeft Finds the left values related to a right value.
+ * @return True, if the results were stored. False, if neither
+ *         reference is a synonym that has values in the results
+ *         table, in which case nothing is stored.
+ */
+Boolean evaluateFromCandidates(const Reference& leftRef, const Reference& rightRef, ResultsTable* resultsTable,
+                               const RelatedValuesFunction& findRight, const RelatedValuesFunction& findLeft);
+
 #endif // SPA_PQL_EVALUATOR_RELATIONSHIPS_UTIL_H
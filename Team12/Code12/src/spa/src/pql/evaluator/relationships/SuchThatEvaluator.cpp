@@ -87,43 +87,65 @@ void evaluateNextBipTransitive(const Reference& leftRef, const Reference& rightR
     resultsTable->getNextBipEvaluator()->evaluateNextStarClause(leftRef, rightRef);
 }
 
-std::unordered_map<RelationshipType, auto (*)(const Reference&, const Reference&, ResultsTable*)->void>
-getSuchThatEvaluatorMap()
-{
-    return std::unordered_map<RelationshipType, auto (*)(const Reference&, const Reference&, ResultsTable*)->void>(
-        {{AffectsType, evaluateAffectsNormal},
-         {AffectsStarType, evaluateAffectsTransitive},
-         {CallsType, evaluateCallsNormal},
-         {CallsStarType, evaluateCallsTransitive},
-         {FollowsType, evaluateFollowsNormal},
-         {FollowsStarType, evaluateFollowsTransitive},
-         {ParentType, evaluateParentNormal},
-         {ParentStarType, evaluateParentTransitive},
-         {UsesType, evaluateUsesClause},
-         {UsesProcedureType, evaluateUsesClause},
-         {UsesStatementType, evaluateUsesClause},
-         {ModifiesType, evaluateModifiesClause},
-         {ModifiesStatementType, evaluateModifiesClause},
-         {ModifiesProcedureType, evaluateModifiesClause},
-         {NextType, evaluateNextNormal},
-         {NextStarType, evaluateNextTransitive},
-         // branch into procedures (BIP)
-         {AffectsBipType, evaluateAffectsBip},
-         {AffectsBipStarType, evaluateAffectsBipTransitive},
-         {NextBipType, evaluateNextBip},
-         {NextBipStarType, evaluateNextBipTransitive}});
-}
-
 Void evaluateSuchThat(SuchThatClause* stClause, ResultsTable* resultsTable)
 {
-    RelationshipType relRefType = stClause->getRelationship().getType();
-    std::unordered_map<RelationshipType, auto (*)(const Reference&, const Reference&, ResultsTable*)->void> evaluatorMap
-        = getSuchThatEvaluatorMap();
-    auto mapEntry = evaluatorMap.find(relRefType);
-    if (mapEntry == evaluatorMap.end()) {
+    const Reference& leftRef = stClause->getRelationship().getLeftRef();
+    const Reference& rightRef = stClause->getRelationship().getRightRef();
+    switch (stClause->getRelationship().getType()) {
+    case AffectsType:
+        evaluateAffectsNormal(leftRef, rightRef, resultsTable);
+        break;
+    case AffectsStarType:
+        evaluateAffectsTransitive(leftRef, rightRef, resultsTable);
+        break;
+    case CallsType:
+        evaluateCallsNormal(leftRef, rightRef, resultsTable);
+        break;
+    case CallsStarType:
+        evaluateCallsTransitive(leftRef, rightRef, resultsTable);
+        break;
+    case FollowsType:
+        evaluateFollowsNormal(leftRef, rightRef, resultsTable);
+        break;
+    case FollowsStarType:
+        evaluateFollowsTransitive(leftRef, rightRef, resultsTable);
+        break;
+    case ParentType:
+        evaluateParentNormal(leftRef, rightRef, resultsTable);
+        break;
+    case ParentStarType:
+        evaluateParentTransitive(leftRef, rightRef, resultsTable);
+        break;
+    case UsesType:
+    case UsesProcedureType:
+    case UsesStatementType:
+        evaluateUsesClause(leftRef, rightRef, resultsTable);
+        break;
+    case ModifiesType:
+    case ModifiesStatementType:
+    case ModifiesProcedureType:
+        evaluateModifiesClause(leftRef, rightRef, resultsTable);
+        break;
+    case NextType:
+        evaluateNextNormal(leftRef, rightRef, resultsTable);
+        break;
+    case NextStarType:
+        evaluateNextTransitive(leftRef, rightRef, resultsTable);
+        break;
+    // branch into procedures (BIP)
+    case AffectsBipType:
+        evaluateAffectsBip(leftRef, rightRef, resultsTable);
+        break;
+    case AffectsBipStarType:
+        evaluateAffectsBipTransitive(leftRef, rightRef, resultsTable);
+        break;
+    case NextBipType:
+        evaluateNextBip(leftRef, rightRef, resultsTable);
+        break;
+    case NextBipStarType:
+        evaluateNextBipTransitive(leftRef, rightRef, resultsTable);
+        break;
+    default:
         throw std::runtime_error("Unknown relationship type in evaluateSuchThat");
-    } else {
-        mapEntry->second(stClause->getRelationship().getLeftRef(), stClause->getRelationship().getRightRef(),
-                         resultsTable);
     }
 }
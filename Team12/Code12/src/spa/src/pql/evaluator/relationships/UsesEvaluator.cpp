@@ -4,113 +4,90 @@
  */
 #include "UsesEvaluator.h"
 
-#include <stdexcept>
-
-#include "RelationshipsUtil.h"
-
-class UsesEvaluator {
-private:
-    Reference leftRef;
-    Reference rightRef;
-    ResultsTable* resultsTable;
-    // these will determine whether it is a statement or procedure Uses
-    ReferenceType leftRefType;
-
-    // case where left is known, right is variable
-    Void evaluateLeftKnown() const;
-    // case where left is variable, right is known (string)
-    Void evaluateRightKnown() const;
-    // case where both are variable
-    Void evaluateBothAny() const;
-    // case where both are known
-    Void evaluateBothKnown() const;
+#include "RelationshipEvaluator.h"
 
+/**
+ * Traits of the Uses relationship between statements and
+ * variables, for RelationshipEvaluator.
+ */
+class UsesStatementTraits {
 public:
-    UsesEvaluator(Reference leftRef, Reference rightRef, ResultsTable* resultsTable):
-        leftRef(std::move(leftRef)), rightRef(std::move(rightRef)), resultsTable(resultsTable),
-        leftRefType(leftRef.getReferenceType())
-    {}
-    Void evaluateUsesClause() const;
-};
+    typedef Integer LeftValue;
+    typedef String RightValue;
+    static const Boolean leftIsStatement = true;
+    static const Boolean rightIsStatement = false;
+    static const Boolean canRelateToItself = false;
 
-Void evaluateUsesClause(const Reference& leftRef, const Reference& rightRef, ResultsTable* resultsTable)
-{
-    UsesEvaluator evaluator(leftRef, rightRef, resultsTable);
-    evaluator.evaluateUsesClause();
-}
+    static Boolean holds(Integer stmtNum, const String& varName)
+    {
+        return checkIfStatementUses(stmtNum, varName);
+    }
+    static ClauseResult findRight(Integer stmtNum, StatementType)
+    {
+        return getUsesVariablesFromStatement(stmtNum);
+    }
+    static ClauseResult findLeft(const String& varName, StatementType stmtType)
+    {
+        return convertToClauseResult(getUsesStatements(varName, stmtType));
+    }
+    static ClauseResult findAllLeft(StatementType stmtType, StatementType)
+    {
+        return convertToClauseResult(getAllUsesStatements(stmtType));
+    }
+    static ClauseResult findAllRight(StatementType stmtType, StatementType)
+    {
+        return getAllUsesVariablesFromStatementType(stmtType);
+    }
+    static PairedResult findAllPairs(StatementType stmtType, StatementType)
+    {
+        return convertToPairedResult(viewAllUsesStatementTuple(stmtType));
+    }
+};
 
-Void UsesEvaluator::evaluateLeftKnown() const
-{
-    ClauseResult tempResult = leftRefType == IntegerRefType
-                                  ? getUsesVariablesFromStatement(std::stoi(leftRef.getValue()))
-                                  : getUsesVariablesFromProcedure(leftRef.getValue());
-    resultsTable->storeResultsOne(rightRef, tempResult);
-}
+/**
+ * Traits of the Uses relationship between procedures and
+ * variables, for RelationshipEvaluator.
+ */
+class UsesProcedureTraits {
+public:
+    typedef ProcedureName LeftValue;
+    typedef String RightValue;
+    static const Boolean leftIsStatement = false;
+    static const Boolean rightIsStatement = false;
+    static const Boolean canRelateToItself = false;
 
-Void UsesEvaluator::evaluateRightKnown() const
-{
-    DesignEntityType leftType = resultsTable->getTypeOfSynonym(leftRef.getValue());
-    if (isStatementDesignEntity(leftType)) {
-        resultsTable->storeResultsOne(
-            leftRef, convertToClauseResult(getUsesStatements(rightRef.getValue(), mapToStatementType(leftType))));
-    } else {
-        // left ref is a procedure
-        resultsTable->storeResultsOne(leftRef, getUsesProcedures(rightRef.getValue()));
+    static Boolean holds(const ProcedureName& procName, const String& varName)
+    {
+        return checkIfProcedureUses(procName, varName);
     }
-}
-
-Void UsesEvaluator::evaluateBothAny() const
-{
-    Boolean isStatementLeft
-        = leftRefType == SynonymRefType && isStatementDesignEntity(resultsTable->getTypeOfSynonym(leftRef.getValue()));
-    ClauseResult leftResults;
-    ClauseResult rightResults;
-    PairedResult tuples;
-    if (isStatementLeft) {
-        StatementType leftStmtType = mapToStatementType(resultsTable->getTypeOfSynonym(leftRef.getValue()));
-        // select stmt
-        leftResults = convertToClauseResult(getAllUsesStatements(leftStmtType));
-        // select variable with statement
-        rightResults = getAllUsesVariablesFromStatementType(leftStmtType);
-        // select all tuples Uses(stmt, variable)
-        tuples = convertToPairedResult(getAllUsesStatementTuple(leftStmtType));
-    } else if (leftRefType == SynonymRefType) {
-        // select procedure
-        leftResults = getAllUsesProcedures();
-        // select variable with procedure
-        rightResults = getAllUsesVariablesFromProgram();
-        // select all tuples Uses(procedure, variable)
-        tuples = getAllUsesProcedureTuple();
-    } else {
-        throw std::runtime_error("Unknown case in UsesExtractor::evaluateBothAny");
+    static ClauseResult findRight(const ProcedureName& procName, StatementType)
+    {
+        return getUsesVariablesFromProcedure(procName);
     }
-    resultsTable->storeResultsTwo(leftRef, leftResults, rightRef, rightResults, tuples);
-}
-
-Void UsesEvaluator::evaluateBothKnown() const
-{
-    Boolean usesHolds;
-    if (leftRefType == IntegerRefType) {
-        usesHolds = checkIfStatementUses(std::stoi(leftRef.getValue()), rightRef.getValue());
-    } else {
-        // leftRefType == LiteralRefType
-        usesHolds = checkIfProcedureUses(leftRef.getValue(), rightRef.getValue());
+    static ClauseResult findLeft(const String& varName, StatementType)
+    {
+        return getUsesProcedures(varName);
     }
-    resultsTable->storeResultsZero(usesHolds);
-}
+    static ClauseResult findAllLeft(StatementType, StatementType)
+    {
+        return getAllUsesProcedures();
+    }
+    static ClauseResult findAllRight(StatementType, StatementType)
+    {
+        return getAllUsesVariablesFromProgram();
+    }
+    static PairedResult findAllPairs(StatementType, StatementType)
+    {
+        return getAllUsesProcedureTuple();
+    }
+};
 
-Void UsesEvaluator::evaluateUsesClause() const
+Void evaluateUsesClause(const Reference& leftRef, const Reference& rightRef, ResultsTable* resultsTable)
 {
-    ReferenceType rightRefType = rightRef.getReferenceType();
-    if (canMatchOnlyOne(leftRefType) && canMatchMultiple(rightRefType)) {
-        evaluateLeftKnown();
-    } else if (canMatchMultiple(leftRefType) && canMatchOnlyOne(rightRefType)) {
-        evaluateRightKnown();
-    } else if (canMatchOnlyOne(leftRefType) && canMatchOnlyOne(rightRefType)) {
-        evaluateBothKnown();
-    } else if (canMatchMultiple(leftRefType) && canMatchMultiple(rightRefType)) {
-        evaluateBothAny();
+    // the left reference determines whether it is a statement or procedure Uses
+    if (isStatementReference(leftRef, resultsTable)) {
+        RelationshipEvaluator<UsesStatementTraits>::evaluate(leftRef, rightRef, resultsTable);
     } else {
-        throw std::runtime_error("Error in UsesEvaluator::evaluateUsesClause: invalid arguments in Uses");
+        RelationshipEvaluator<UsesProcedureTraits>::evaluate(leftRef, rightRef, resultsTable);
     }
 }
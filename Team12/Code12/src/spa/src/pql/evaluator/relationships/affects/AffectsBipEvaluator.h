@@ -5,16 +5,16 @@
 #ifndef SPA_PQL_AFFECTS_BIP_EVALUATOR_H
 #define SPA_PQL_AFFECTS_BIP_EVALUATOR_H
 
+#include <memory>
+
 #include "AffectsBipFacade.h"
+#include "AffectsBipSummaries.h"
 #include "AffectsEvaluator.h"
-#include "pql/evaluator/relationships/bip/BipUtils.h"
-
-// Forward declaration of an optional statement number
-class MaybeStatementNumber;
 
 class AffectsBipEvaluator: public AffectsEvaluator {
 private:
     AffectsBipFacade* bipFacade;
+    std::unique_ptr<AffectsBipSummaries> summaries;
     // cache for AffectsBip*(modifier, user)
     CacheTable cacheModifierBipStarTable;      // cache table to store AffectsBip*(a, _) for known a
     CacheSet exploredModifierBipStarAssigns;   // cache set to tell if ALL AffectsBip*(a, _) is stored in table
@@ -23,14 +23,18 @@ private:
     Vector<Pair<Integer, Integer>> allAffectsBipStarTuples;
     bool bipStarCacheFullyPopulated;
 
-    // Helper methods for AffectsBip*
-    Boolean affectsBipStarSearch(Integer startingStmtNum, StatementPositionInCfg startingPosition,
-                                 Boolean ignoreStarting,
-                                 std::unordered_set<StatementPositionInCfg, StatementPositionHasher>& visitedAssigns,
-                                 MaybeStatementNumber endValue);
+    // Helper methods for AffectsBip and AffectsBip*
+    AffectsBipSummaries* getSummaries();
     Vector<Integer> cacheModifierBipStarAssigns(Integer leftRefVal);
     Void cacheAllBipStar();
 
+    /**
+     * Finds every AffectsBip relationship in the program, from
+     * the assignment statements reaching each statement, with the
+     * procedures of the CFG BIP summarised at their calls.
+     */
+    Void findAllAffects(AffectsTuple& resultsLists) override;
+
     // Method for Affects
     Void evaluateBothKnown(Integer leftRefVal, Integer rightRefVal) override;
 
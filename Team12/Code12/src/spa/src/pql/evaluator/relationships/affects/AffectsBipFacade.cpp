@@ -19,24 +19,14 @@ Vector<String> AffectsBipFacade::getModified(Integer stmtNum)
     }
 }
 
-Vector<Integer> AffectsBipFacade::getNext(Integer stmtNum)
+VectorView<Integer> AffectsBipFacade::getNext(Integer stmtNum)
 {
-    return getAllNextBipStatements(stmtNum, AnyStatement);
+    return viewAllNextBipStatements(stmtNum, AnyStatement);
 }
 
-Vector<Integer> AffectsBipFacade::getPrevious(Integer stmtNum)
+VectorView<Integer> AffectsBipFacade::getPrevious(Integer stmtNum)
 {
-    return getAllPreviousBipStatements(stmtNum, AnyStatement);
-}
-
-Vector<String> AffectsBipFacade::getRelevantProcedures()
-{
-    return getProceduresWithCFGBip();
-}
-
-CfgNode* AffectsBipFacade::getCfg(const String& procedureName)
-{
-    return BipFacade::getCfg(procedureName);
+    return viewAllPreviousBipStatements(stmtNum, AnyStatement);
 }
 
 Boolean AffectsBipFacade::doesStatementModify(Integer stmtNum, const String& variable)
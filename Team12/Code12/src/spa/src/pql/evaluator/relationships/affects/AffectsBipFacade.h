@@ -37,7 +37,7 @@ public:
      * Flow Graph with branching into other procedures,
      * as described by the "NextBip" relationship.
      */
-    Vector<Integer> getNext(Integer stmtNum) override;
+    VectorView<Integer> getNext(Integer stmtNum) override;
 
     /**
      * Returns a list of statement numbers that are directly
@@ -45,22 +45,7 @@ public:
      * Flow Graph with branching into other procedures,
      * as described by the "NextBip" relationship.
      */
-    Vector<Integer> getPrevious(Integer stmtNum) override;
-
-    /**
-     * Returns a list of procedures that have a Control Flow
-     * Graph with branching into procedures in the program.
-     */
-    Vector<String> getRelevantProcedures() override;
-
-    /**
-     * Returns the root node of the Control Flow Graph
-     * with branching into procedures (CFG BIP) of the
-     * procedure with the name provided. If the
-     * procedure does not have a CFG BIP, this
-     * will return nullptr.
-     */
-    CfgNode* getCfg(const String& procedureName) override;
+    VectorView<Integer> getPrevious(Integer stmtNum) override;
 
     /**
      * Checks whether a statement number modifies a variable,
@@ -0,0 +1,347 @@
+/**
+ * Implementation of the summaries of procedures
+ * for AffectsBip and AffectsBip* relationships.
+ */
+
+#include "AffectsBipSummaries.h"
+
+#include <cassert>
+
+// Index of a variable that does not exist, for statements that modify none
+const size_t NoVariable = static_cast<size_t>(-1);
+
+AffectsBipSummaries::AffectsBipSummaries(const BipSupergraph& cfgBip, AffectsBipFacade& facade):
+    cfgBip(cfgBip), numberOfStatements(static_cast<size_t>(cfgBip.getLastStatement()) + 1),
+    modifiedVariables(numberOfStatements, NoVariable), usedVariables(numberOfStatements),
+    allAssigns(numberOfStatements), chainSummaries(cfgBip.countProcedures())
+{
+    // number the variables modified and used by the statements
+    std::unordered_map<String, size_t> indexOfVariable;
+    auto getVariableIndex = [&indexOfVariable](const String& variable) {
+        return indexOfVariable.insert({variable, indexOfVariable.size()}).first->second;
+    };
+    Vector<Vector<size_t>> usedVariableIndexes(numberOfStatements);
+    for (StatementNumber stmtNum = 1; stmtNum <= cfgBip.getLastStatement(); stmtNum++) {
+        if (!cfgBip.containsStatement(stmtNum)) {
+            continue;
+        }
+        StatementType type = cfgBip.getStatementType(stmtNum);
+        if (type != AssignmentStatement && type != ReadStatement) {
+            continue;
+        }
+        Vector<String> modifiedList = facade.getModified(stmtNum);
+        // assumption that assign and read statements only modify one variable
+        assert(modifiedList.size() == 1); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+        modifiedVariables[stmtNum] = getVariableIndex(modifiedList[0]);
+        if (type == AssignmentStatement) {
+            allAssigns.set(stmtNum);
+            for (const String& variable : facade.getUsed(stmtNum)) {
+                usedVariableIndexes[stmtNum].push_back(getVariableIndex(variable));
+            }
+        }
+    }
+
+    size_t numberOfVariables = indexOfVariable.size();
+    assignsModifying.assign(numberOfVariables, Bitset(numberOfStatements));
+    for (StatementNumber stmtNum = 1; stmtNum <= cfgBip.getLastStatement(); stmtNum++) {
+        if (!allAssigns.test(stmtNum)) {
+            continue;
+        }
+        assignsModifying[modifiedVariables[stmtNum]].set(stmtNum);
+        usedVariables[stmtNum] = Bitset(numberOfVariables);
+        for (size_t variable : usedVariableIndexes[stmtNum]) {
+            usedVariables[stmtNum].set(variable);
+        }
+    }
+
+    summariseAssigns();
+}
+
+/**
+ * Finds the assignment statements that reach the end of a statement,
+ * given those that reach the start of it. An assignment or read
+ * statement stops all assignments to the variable it modifies. A call
+ * statement passes the assignments through the summary of the
+ * procedure called.
+ *
+ * @param stmtNum The statement to pass the assignments through.
+ * @param assignsBefore The assignments reaching the start of the statement.
+ * @param generate Whether assignments are added by the statement (or by the
+ *                 procedure called), or are only passed through it.
+ * @return The assignments reaching the end of the statement.
+ */
+Bitset AffectsBipSummaries::transferAssigns(StatementNumber stmtNum, const Bitset& assignsBefore,
+                                            Boolean generate) const
+{
+    Bitset assignsAfter = assignsBefore;
+    StatementType type = cfgBip.getStatementType(stmtNum);
+    if (type == AssignmentStatement || type == ReadStatement) {
+        assignsAfter.subtract(assignsModifying[modifiedVariables[stmtNum]]);
+        if (generate && type == AssignmentStatement) {
+            assignsAfter.set(stmtNum);
+        }
+    } else if (type == CallStatement) {
+        size_t calledIndex = cfgBip.getCalledProcedure(stmtNum);
+        assignsAfter &= assignsPreservedByCall[calledIndex];
+        if (generate) {
+            assignsAfter |= assignsGeneratedByCall[calledIndex];
+        }
+    }
+    return assignsAfter;
+}
+
+/**
+ * Finds the assignment statements reaching each statement of a
+ * procedure, by iterating over its flat CFG until no more are found.
+ *
+ * @param procedureIndex The procedure to search.
+ * @param entryAssigns The assignments reaching the start of the procedure.
+ * @param generate Whether assignments in the procedure are added.
+ * @param assignsBefore The assignments reaching the start of each statement
+ *                      of the procedure, from its first statement onwards.
+ * @return The assignments reaching the end of the procedure.
+ */
+Bitset AffectsBipSummaries::propagateAssigns(size_t procedureIndex, const Bitset& entryAssigns, Boolean generate,
+                                             Vector<Bitset>& assignsBefore) const
+{
+    const FlatCfg& cfg = cfgBip.getProcedureCfg(procedureIndex);
+    StatementNumber firstStatement = cfg.getFirstStatement();
+    assignsBefore.assign(cfg.countStatements(), Bitset(numberOfStatements));
+    assignsBefore[0] = entryAssigns;
+
+    // visit every statement once, in order, before revisiting any
+    Vector<StatementNumber> statementsToVisit;
+    for (StatementNumber stmtNum = cfg.getLastStatement(); stmtNum >= firstStatement; stmtNum--) {
+        statementsToVisit.push_back(stmtNum);
+    }
+    while (!statementsToVisit.empty()) {
+        StatementNumber stmtNum = statementsToVisit.back();
+        statementsToVisit.pop_back();
+        Bitset assignsAfter = transferAssigns(stmtNum, assignsBefore[stmtNum - firstStatement], generate);
+        for (StatementNumber next : cfg.getNext(stmtNum)) {
+            Bitset& assignsBeforeNext = assignsBefore[next - firstStatement];
+            Bitset combined = assignsBeforeNext;
+            combined |= assignsAfter;
+            if (!(combined == assignsBeforeNext)) {
+                assignsBeforeNext = std::move(combined);
+                statementsToVisit.push_back(next);
+            }
+        }
+    }
+
+    Bitset exitAssigns(numberOfStatements);
+    for (StatementNumber exit : cfg.getExitStatements()) {
+        exitAssigns |= transferAssigns(exit, assignsBefore[exit - firstStatement], generate);
+    }
+    return exitAssigns;
+}
+
+/**
+ * Summarises every procedure for AffectsBip, then finds the
+ * assignment statements that reach each statement.
+ */
+Void AffectsBipSummaries::summariseAssigns()
+{
+    size_t numberOfProcedures = cfgBip.countProcedures();
+    assignsGeneratedByCall.assign(numberOfProcedures, Bitset(numberOfStatements));
+    assignsPreservedByCall.assign(numberOfProcedures, Bitset(numberOfStatements));
+    reachingAssigns.assign(numberOfStatements, Bitset(numberOfStatements));
+    const Vector<size_t>& callersFirst = cfgBip.getProceduresCallersFirst();
+    Vector<Bitset> assignsBefore;
+
+    // assignments from within each procedure, and from the procedures it calls
+    for (auto iterator = callersFirst.rbegin(); iterator != callersFirst.rend(); iterator++) {
+        size_t procedureIndex = *iterator;
+        assignsPreservedByCall[procedureIndex] = propagateAssigns(procedureIndex, allAssigns, false, assignsBefore);
+        assignsGeneratedByCall[procedureIndex]
+            = propagateAssigns(procedureIndex, Bitset(numberOfStatements), true, assignsBefore);
+        StatementNumber firstStatement = cfgBip.getEntryStatement(procedureIndex);
+        for (size_t offset = 0; offset < assignsBefore.size(); offset++) {
+            reachingAssigns[firstStatement + offset] = std::move(assignsBefore[offset]);
+        }
+    }
+
+    // assignments from before each call of the procedure
+    for (size_t procedureIndex : callersFirst) {
+        Bitset entryAssigns(numberOfStatements);
+        for (StatementNumber callSite : cfgBip.getCallSites(procedureIndex)) {
+            entryAssigns |= reachingAssigns[callSite];
+        }
+        if (!entryAssigns.any()) {
+            continue;
+        }
+        propagateAssigns(procedureIndex, entryAssigns, false, assignsBefore);
+        StatementNumber firstStatement = cfgBip.getEntryStatement(procedureIndex);
+        for (size_t offset = 0; offset < assignsBefore.size(); offset++) {
+            reachingAssigns[firstStatement + offset] |= assignsBefore[offset];
+        }
+    }
+}
+
+Vector<Pair<StatementNumber, StatementNumber>> AffectsBipSummaries::findAllAffectsBip() const
+{
+    Vector<Pair<StatementNumber, StatementNumber>> affectsBip;
+    for (size_t user = allAssigns.findNext(0); user < numberOfStatements; user = allAssigns.findNext(user + 1)) {
+        const Bitset& reaching = reachingAssigns[user];
+        for (size_t modifier = reaching.findNext(0); modifier < numberOfStatements;
+             modifier = reaching.findNext(modifier + 1)) {
+            if (usedVariables[user].test(modifiedVariables[modifier])) {
+                affectsBip.emplace_back(modifier, user);
+            }
+        }
+    }
+    return affectsBip;
+}
+
+/**
+ * Finds the variables that carry a value derived from the first
+ * assignment at the end of a statement, given those at the start
+ * of it. An assignment using any of these variables is affected,
+ * and its variable then carries the value on. Otherwise, an
+ * assignment or read statement stops its variable from carrying
+ * the value.
+ *
+ * @param stmtNum The statement to pass the variables through.
+ * @param variablesBefore The variables at the start of the statement.
+ * @param affectedAssigns The assignments affected, which the statement
+ *                        and the procedure it calls are added to.
+ * @return The variables at the end of the statement.
+ */
+Bitset AffectsBipSummaries::transferChain(StatementNumber stmtNum, const Bitset& variablesBefore,
+                                          Bitset& affectedAssigns)
+{
+    Bitset variablesAfter = variablesBefore;
+    StatementType type = cfgBip.getStatementType(stmtNum);
+    if (type == AssignmentStatement && variablesBefore.intersects(usedVariables[stmtNum])) {
+        affectedAssigns.set(stmtNum);
+        variablesAfter.set(modifiedVariables[stmtNum]);
+    } else if (type == AssignmentStatement || type == ReadStatement) {
+        variablesAfter.reset(modifiedVariables[stmtNum]);
+    } else if (type == CallStatement) {
+        size_t calledIndex = cfgBip.getCalledProcedure(stmtNum);
+        variablesAfter = Bitset(variablesBefore.size());
+        for (size_t variable = variablesBefore.findNext(0); variable < variablesBefore.size();
+             variable = variablesBefore.findNext(variable + 1)) {
+            const ChainSummary& summary = getChainSummary(calledIndex, variable);
+            variablesAfter |= summary.first;
+            affectedAssigns |= summary.second;
+        }
+    }
+    return variablesAfter;
+}
+
+/**
+ * Finds the variables carrying a value derived from the first
+ * assignment at each statement of a procedure, by iterating
+ * over its flat CFG until no more are found.
+ *
+ * @param procedureIndex The procedure to search.
+ * @param startVariables The statements to start from, with the
+ *                       variables at the start of each.
+ * @param affectedAssigns The assignments affected.
+ * @return The variables at the end of the procedure.
+ */
+Bitset AffectsBipSummaries::propagateChain(size_t procedureIndex,
+                                           const Vector<Pair<StatementNumber, Bitset>>& startVariables,
+                                           Bitset& affectedAssigns)
+{
+    const FlatCfg& cfg = cfgBip.getProcedureCfg(procedureIndex);
+    StatementNumber firstStatement = cfg.getFirstStatement();
+    size_t numberOfVariables = assignsModifying.size();
+    Vector<Bitset> variablesBefore(cfg.countStatements(), Bitset(numberOfVariables));
+    Vector<StatementNumber> statementsToVisit;
+    for (const Pair<StatementNumber, Bitset>& start : startVariables) {
+        variablesBefore[start.first - firstStatement] |= start.second;
+        statementsToVisit.push_back(start.first);
+    }
+
+    while (!statementsToVisit.empty()) {
+        StatementNumber stmtNum = statementsToVisit.back();
+        statementsToVisit.pop_back();
+        Bitset variablesAfter = transferChain(stmtNum, variablesBefore[stmtNum - firstStatement], affectedAssigns);
+        for (StatementNumber next : cfg.getNext(stmtNum)) {
+            Bitset& variablesBeforeNext = variablesBefore[next - firstStatement];
+            Bitset combined = variablesBeforeNext;
+            combined |= variablesAfter;
+            if (!(combined == variablesBeforeNext)) {
+                variablesBeforeNext = std::move(combined);
+                statementsToVisit.push_back(next);
+            }
+        }
+    }
+
+    Bitset exitVariables(numberOfVariables);
+    for (StatementNumber exit : cfg.getExitStatements()) {
+        exitVariables |= transferChain(exit, variablesBefore[exit - firstStatement], affectedAssigns);
+    }
+    return exitVariables;
+}
+
+/**
+ * Gets the summary of a procedure for AffectsBip*, when a variable
+ * carries a value derived from the first assignment into it,
+ * summarising the procedure for that variable if not done before.
+ */
+const AffectsBipSummaries::ChainSummary& AffectsBipSummaries::getChainSummary(size_t procedureIndex,
+                                                                               size_t variable)
+{
+    auto cached = chainSummaries[procedureIndex].find(variable);
+    if (cached != chainSummaries[procedureIndex].end()) {
+        return cached->second;
+    }
+    Bitset entryVariables(assignsModifying.size());
+    entryVariables.set(variable);
+    Bitset affectedAssigns(numberOfStatements);
+    Bitset exitVariables = propagateChain(
+        procedureIndex, {{cfgBip.getEntryStatement(procedureIndex), entryVariables}}, affectedAssigns);
+    // the references to the other summaries stay valid, as they are in a node based map
+    return chainSummaries[procedureIndex]
+        .emplace(variable, ChainSummary(std::move(exitVariables), std::move(affectedAssigns)))
+        .first->second;
+}
+
+Bitset AffectsBipSummaries::findAffectsBipStar(StatementNumber assignStmtNum)
+{
+    Bitset affectedAssigns(numberOfStatements);
+    if (!cfgBip.containsStatement(assignStmtNum) || !allAssigns.test(assignStmtNum)) {
+        return affectedAssigns;
+    }
+
+    // search from the assignment, then return to the calls of each
+    // procedure reached at its end, in the order of the call graph
+    size_t numberOfProcedures = cfgBip.countProcedures();
+    Vector<Vector<Pair<StatementNumber, Bitset>>> startVariables(numberOfProcedures);
+    Vector<Bitset> exitVariables(numberOfProcedures, Bitset(assignsModifying.size()));
+    size_t procedureIndex = cfgBip.getProcedureOf(assignStmtNum);
+    Bitset assignedVariable(assignsModifying.size());
+    assignedVariable.set(modifiedVariables[assignStmtNum]);
+    for (StatementNumber next : cfgBip.getProcedureCfg(procedureIndex).getNext(assignStmtNum)) {
+        startVariables[procedureIndex].emplace_back(next, assignedVariable);
+    }
+    if (cfgBip.isExitStatement(assignStmtNum)) {
+        exitVariables[procedureIndex] = assignedVariable;
+    }
+
+    const Vector<size_t>& callersFirst = cfgBip.getProceduresCallersFirst();
+    for (auto iterator = callersFirst.rbegin(); iterator != callersFirst.rend(); iterator++) {
+        size_t currentIndex = *iterator;
+        if (!startVariables[currentIndex].empty()) {
+            exitVariables[currentIndex] |= propagateChain(currentIndex, startVariables[currentIndex], affectedAssigns);
+        }
+        const Bitset& returnedVariables = exitVariables[currentIndex];
+        if (!returnedVariables.any()) {
+            continue;
+        }
+        for (StatementNumber callSite : cfgBip.getCallSites(currentIndex)) {
+            size_t callerIndex = cfgBip.getProcedureOf(callSite);
+            StatementRange returnSites = cfgBip.getReturnSites(callSite);
+            if (returnSites.empty()) {
+                exitVariables[callerIndex] |= returnedVariables;
+            }
+            for (StatementNumber returnSite : returnSites) {
+                startVariables[callerIndex].emplace_back(returnSite, returnedVariables);
+            }
+        }
+    }
+    return affectedAssigns;
+}
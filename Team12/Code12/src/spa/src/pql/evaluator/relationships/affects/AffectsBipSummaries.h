@@ -0,0 +1,104 @@
+/**
+ * Summaries of the procedures of a program for the
+ * AffectsBip and AffectsBip* relationships, which are
+ * composed at call statements instead of searching
+ * through the procedure called for every call of it.
+ */
+
+#ifndef SPA_PQL_AFFECTS_BIP_SUMMARIES_H
+#define SPA_PQL_AFFECTS_BIP_SUMMARIES_H
+
+#include <unordered_map>
+
+#include "AffectsBipFacade.h"
+#include "Bitset.h"
+
+/**
+ * AffectsBip is found from the assignments that reach each
+ * statement, as in the analysis of reaching definitions. Each
+ * procedure is summarised by the assignments in it (or in the
+ * procedures it calls) that reach the end of it, and by the
+ * assignments that reach the end of it when they reach the start
+ * of it, as their variables are not modified on every path through
+ * the procedure. A call statement then passes the assignments
+ * before it through the summary of the procedure called.
+ *
+ * The procedures are summarised in the order of the call graph,
+ * with the procedures called first. As the call that led to a
+ * procedure is not known, the assignments reaching the start of
+ * a procedure from all of its calls are then found, with the
+ * procedures calling it first. Assignments from the calls only
+ * return to the call they came from, through the summary.
+ *
+ * AffectsBip* is chained along a single path, so an assignment
+ * affected in a procedure only returns to the call that led to
+ * it. It is found from the variables that can carry a value
+ * derived from the first assignment, with each procedure
+ * summarised for each variable carried into it.
+ */
+class AffectsBipSummaries {
+public:
+    /**
+     * Summarises the procedures in a CFG BIP.
+     *
+     * @param cfgBip The CFG BIP of the program, which must
+     *               outlive the summaries.
+     * @param facade The facade to find the variables modified and
+     *               used by each statement in the CFG BIP from.
+     */
+    AffectsBipSummaries(const BipSupergraph& cfgBip, AffectsBipFacade& facade);
+
+    /**
+     * Finds every AffectsBip relationship in the program.
+     *
+     * @return Each assignment statement paired with
+     *         an assignment statement it affects.
+     */
+    Vector<Pair<StatementNumber, StatementNumber>> findAllAffectsBip() const;
+
+    /**
+     * Finds the assignment statements affected by an assignment
+     * statement through AffectsBip*, chained along a single path.
+     *
+     * @param assignStmtNum An assignment statement in the CFG BIP.
+     * @return The statements affected, indexed by statement number.
+     */
+    Bitset findAffectsBipStar(StatementNumber assignStmtNum);
+
+private:
+    // Summary of a procedure for a variable carried into it, as the variables
+    // carried out of the procedure and the assignments affected in it
+    typedef Pair<Bitset, Bitset> ChainSummary;
+
+    const BipSupergraph& cfgBip;
+    size_t numberOfStatements;
+
+    // variable modified by each assignment or read statement, and
+    // the variables used by each assignment statement
+    Vector<size_t> modifiedVariables;
+    Vector<Bitset> usedVariables;
+    // assignment statements modifying each variable
+    Vector<Bitset> assignsModifying;
+    Bitset allAssigns;
+
+    // summaries of each procedure for AffectsBip
+    Vector<Bitset> assignsGeneratedByCall;
+    Vector<Bitset> assignsPreservedByCall;
+    // assignment statements that reach each statement
+    Vector<Bitset> reachingAssigns;
+
+    // summaries of each procedure for AffectsBip*, by the variable carried into it
+    Vector<std::unordered_map<size_t, ChainSummary>> chainSummaries;
+
+    Bitset transferAssigns(StatementNumber stmtNum, const Bitset& assignsBefore, Boolean generate) const;
+    Bitset propagateAssigns(size_t procedureIndex, const Bitset& entryAssigns, Boolean generate,
+                            Vector<Bitset>& assignsBefore) const;
+    Void summariseAssigns();
+
+    Bitset transferChain(StatementNumber stmtNum, const Bitset& variablesBefore, Bitset& affectedAssigns);
+    Bitset propagateChain(size_t procedureIndex, const Vector<Pair<StatementNumber, Bitset>>& startVariables,
+                          Bitset& affectedAssigns);
+    const ChainSummary& getChainSummary(size_t procedureIndex, size_t variable);
+};
+
+#endif // SPA_PQL_AFFECTS_BIP_SUMMARIES_H
@@ -311,7 +311,7 @@ Void AffectsEvaluator::evaluateBothKnown(Integer leftRefVal, Integer rightRefVal
     assert(modifiedList.size() == 1); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
     String variableModified = modifiedList[0];
     // traverse CFG to find whether Affects(left, right), modified depth-first search
-    Vector<Integer> nextStatements = facade->getNext(leftRefVal);
+    VectorView<Integer> nextStatements = facade->getNext(leftRefVal);
     bool foundRight = false;
     while (!nextStatements.empty()) {
         Integer currentStatement;
@@ -379,7 +379,7 @@ Void AffectsEvaluator::evaluateBothAnyStar(const Reference& leftRef, const Refer
         return;
     }
 
-    Vector<StatementNumber> allAssignStatements = facade->getAssigns();
+    VectorView<StatementNumber> allAssignStatements = facade->getAssigns();
 
     if (leftRef.isWildCard() && rightRef.isWildCard()) {
         // return true if there are any normal modifies
@@ -462,19 +462,24 @@ Void AffectsEvaluator::evaluateBothKnownStar(Integer leftRefVal, Integer rightRe
     resultsTable.storeResultsZero(modifierStarAnyStmtResults.isCached(rightRefVal));
 }
 
+Void AffectsEvaluator::findAllAffects(AffectsTuple& resultsLists)
+{
+    // we just need certain procedures for computation of Affects
+    Vector<String> procedures = facade->getRelevantProcedures();
+    for (const String& proc : procedures) {
+        std::unordered_map<String, std::unordered_set<Integer>> modifiedVariablesMap;
+        const CfgNode* end = affectsSearch(facade->getCfg(proc), modifiedVariablesMap, resultsLists);
+        while (end != nullptr) {
+            end = affectsSearch(end, modifiedVariablesMap, resultsLists);
+        }
+    }
+}
+
 Void AffectsEvaluator::cacheAll()
 {
     if (!cacheFullyPopulated) {
-        // we just need certain procedures for computation of Affects
-        Vector<String> procedures = facade->getRelevantProcedures();
         AffectsTuple resultsLists;
-        for (const String& proc : procedures) {
-            std::unordered_map<String, std::unordered_set<Integer>> modifiedVariablesMap;
-            const CfgNode* end = affectsSearch(facade->getCfg(proc), modifiedVariablesMap, resultsLists);
-            while (end != nullptr) {
-                end = affectsSearch(end, modifiedVariablesMap, resultsLists);
-            }
-        }
+        findAllAffects(resultsLists);
         // store in cache
         allModifierAssigns = resultsLists.getModifyingStatements();
         allUserAssigns = resultsLists.getUsingStatements();
@@ -495,7 +500,7 @@ Void AffectsEvaluator::cacheAll()
 
 Void AffectsEvaluator::cacheModifierAssigns(Integer leftRefVal)
 {
-    Vector<Integer> nextStatements = facade->getNext(leftRefVal);
+    VectorView<Integer> nextStatements = facade->getNext(leftRefVal);
     // A priority queue that returns smaller statements first
     UniquePriorityQueue<Integer, std::less<Integer>> statementsQueue;
     for (Integer next : nextStatements) {
@@ -541,7 +546,7 @@ Void AffectsEvaluator::cacheModifierAssigns(Integer leftRefVal)
 
 Void AffectsEvaluator::cacheUserAssigns(Integer rightRefVal, Vector<String> usedFromPkb)
 {
-    Vector<Integer> prevStatements = facade->getPrevious(rightRefVal);
+    VectorView<Integer> prevStatements = facade->getPrevious(rightRefVal);
     std::shared_ptr<std::unordered_set<String>> originalUsedVariables
         = std::make_shared<std::unordered_set<String>>(usedFromPkb.begin(), usedFromPkb.end());
     // A priority queue that returns larger statements first
@@ -763,13 +768,12 @@ CacheSet AffectsEvaluator::evaluateUserStar(StatementNumber stmtNum)
  */
 void AffectsEvaluator::cleanup(CacheSet& partiallyCacheSet, CacheTable& cacheTable)
 {
-    std::unordered_set<StatementNumber> keys = cacheTable.keys();
     Vector<StatementNumber> wasPartiallyEvaluatedList = partiallyCacheSet.toVector();
     for (StatementNumber wasPartiallyEvaluated : wasPartiallyEvaluatedList) {
         CacheSet fullyEvaluatedCacheSet = cacheTable.get(wasPartiallyEvaluated);
         Vector<StatementNumber> fullEvaluatedCacheVector = fullyEvaluatedCacheSet.toVector();
         for (StatementNumber cachedStmt : fullEvaluatedCacheVector) {
-            if (keys.find(cachedStmt) == keys.end()) {
+            if (!cacheTable.isCached(cachedStmt)) {
                 continue;
             }
 
@@ -779,6 +783,9 @@ void AffectsEvaluator::cleanup(CacheSet& partiallyCacheSet, CacheTable& cacheTab
             }
         }
     }
+
+    // the statements are now fully evaluated, so later calls do not need to combine them again
+    partiallyCacheSet = CacheSet();
 }
 
 // This method is for unit testing only!
@@ -126,6 +126,16 @@ protected:
      */
     Void cacheAll();
 
+    /**
+     * Finds every Affects relationship in the SIMPLE source
+     * program, by running the Affects search through the
+     * Control Flow Graph of each relevant procedure.
+     *
+     * @param resultsLists The results lists to add the
+     *                     relationships found to.
+     */
+    virtual Void findAllAffects(AffectsTuple& resultsLists);
+
     /**
      * Caches all the statements that the
      * given statement affects.
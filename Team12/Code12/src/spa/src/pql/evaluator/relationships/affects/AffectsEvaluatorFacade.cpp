@@ -17,24 +17,36 @@ Vector<String> AffectsEvaluatorFacade::getModified(Integer stmtNum)
     return getModifiesVariablesFromStatement(stmtNum);
 }
 
-Vector<Integer> AffectsEvaluatorFacade::getNext(Integer stmtNum)
+VectorView<Integer> AffectsEvaluatorFacade::getNext(Integer stmtNum)
 {
-    return getAllNextStatements(stmtNum, AnyStatement);
+    const FlatCfg* flatCfg = getFlatCFGOfStatement(stmtNum);
+    if (flatCfg == nullptr) {
+        return viewAllNextStatements(stmtNum, AnyStatement);
+    }
+    StatementRange nextStatements = flatCfg->getNext(stmtNum);
+    return VectorView<Integer>(nextStatements.begin(), nextStatements.end());
 }
 
-Vector<Integer> AffectsEvaluatorFacade::getPrevious(Integer stmtNum)
+VectorView<Integer> AffectsEvaluatorFacade::getPrevious(Integer stmtNum)
 {
-    return getAllPreviousStatements(stmtNum, AnyStatement);
+    // traverse the reverse CFG, as cheaply as the CFG is traversed forwards
+    const FlatCfg* flatCfg = getFlatCFGOfStatement(stmtNum);
+    if (flatCfg == nullptr) {
+        return viewAllPreviousStatements(stmtNum, AnyStatement);
+    }
+    StatementRange previousStatements = flatCfg->getPrevious(stmtNum);
+    return VectorView<Integer>(previousStatements.begin(), previousStatements.end());
 }
 
 StatementType AffectsEvaluatorFacade::getType(Integer stmtNum)
 {
-    return getStatementType(stmtNum);
+    const FlatCfg* flatCfg = getFlatCFGOfStatement(stmtNum);
+    return flatCfg == nullptr ? getStatementType(stmtNum) : flatCfg->getStatementType(stmtNum);
 }
 
-Vector<Integer> AffectsEvaluatorFacade::getAssigns()
+VectorView<Integer> AffectsEvaluatorFacade::getAssigns()
 {
-    return getAllStatements(AssignmentStatement);
+    return viewAllStatements(AssignmentStatement);
 }
 
 Vector<String> AffectsEvaluatorFacade::getRelevantProcedures()
@@ -12,6 +12,7 @@
 
 #include "Types.h"
 #include "cfg/CfgTypes.h"
+#include "pkb/PkbTypes.h"
 
 class AffectsEvaluatorFacade {
 public:
@@ -40,7 +41,7 @@ public:
      * Flow Graph of the program, as described by the "Next"
      * program design abstraction relationship.
      */
-    virtual Vector<Integer> getNext(Integer stmtNum);
+    virtual VectorView<Integer> getNext(Integer stmtNum);
 
     /**
      * Returns a list of statement numbers that are directly
@@ -48,7 +49,7 @@ public:
      * Flow Graph of the program, as described by the "Next"
      * program design abstraction relationship.
      */
-    virtual Vector<Integer> getPrevious(Integer stmtNum);
+    virtual VectorView<Integer> getPrevious(Integer stmtNum);
 
     /**
      * Returns the statement type of a statement in
@@ -60,7 +61,7 @@ public:
      * Returns a list of statement numbers that refer
      * to every assignment statement in the program.
      */
-    virtual Vector<Integer> getAssigns();
+    virtual VectorView<Integer> getAssigns();
 
     /**
      * Returns a list of procedures that modify some variable
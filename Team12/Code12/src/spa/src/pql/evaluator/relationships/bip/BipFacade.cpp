@@ -6,17 +6,7 @@
 
 #include "pkb/PKB.h"
 
-CfgNode* BipFacade::getCfg(const String& procedureName)
+const BipSupergraph* BipFacade::getCfgBip()
 {
-    return getCFGBip(procedureName);
-}
-
-Vector<String> BipFacade::getProcedure(Integer stmtNum)
-{
-    return getContainingProcedure(stmtNum);
-}
-
-Vector<String> BipFacade::getCallersStar(const String& procedureName)
-{
-    return getAllCallersStar(procedureName);
+    return getCFGBip();
 }
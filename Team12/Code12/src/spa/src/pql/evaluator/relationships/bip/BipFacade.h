@@ -7,7 +7,7 @@
 #define SPA_PQL_BIP_FACADE_H
 
 #include "Types.h"
-#include "cfg/CfgTypes.h"
+#include "cfg/BipSupergraph.h"
 
 class BipFacade {
 public:
@@ -19,26 +19,12 @@ public:
     BipFacade& operator=(BipFacade&&) = default;
 
     /**
-     * Returns the root node of the Control Flow Graph
-     * with branching into procedures (CFG BIP) of the
-     * procedure with the name provided. If the
-     * procedure does not have a CFG BIP, this
-     * will return nullptr.
+     * Returns the Control Flow Graph with branching into
+     * procedures (CFG BIP) of the program, which links the
+     * CFGs of all procedures. If the program does not
+     * have a CFG BIP, this will return nullptr.
      */
-    virtual CfgNode* getCfg(const String& procedureName);
-
-    /**
-     * Returns a list of procedures that contain the statement
-     * number provided. This list should only contain 0 or 1
-     * procedures, as no two procedures can have the same statement.
-     */
-    virtual Vector<String> getProcedure(Integer stmtNum);
-
-    /**
-     * Returns a list of procedures that calls or indirectly
-     * calls the procedureName given.
-     */
-    virtual Vector<String> getCallersStar(const String& procedureName);
+    virtual const BipSupergraph* getCfgBip();
 };
 
 #endif // SPA_PQL_BIP_FACADE_H
@@ -6,89 +6,35 @@
 #include "NextBipEvaluator.h"
 
 #include "pql/evaluator/relationships/bip/BipFacade.h"
-#include "pql/evaluator/relationships/bip/BipUtils.h"
 
-Boolean findAllNextBipFromCfgNode(CfgNode* currentCfgNode, StatementNumber startingStmtNum,
-                                  Boolean isFirstRecursiveCall, std::unordered_set<size_t>& visited, CacheSet& results)
+const Bitset& NextBipEvaluator::processLeftKnownStar(Integer leftRefVal)
 {
-    size_t currentNodeNumber = currentCfgNode->nodeNumber;
-    if (visited.find(currentNodeNumber) != visited.end()) {
-        // Still need to check if starting number visited itself
-        Boolean hasVisitedStartingNode = false;
-        Vector<StatementNode*> stmtList = *(currentCfgNode->statementNodes);
-        for (StatementNode* stmtNode : stmtList) {
-            StatementNumber stmtNum = stmtNode->getStatementNumber();
-            hasVisitedStartingNode = hasVisitedStartingNode || (stmtNum == startingStmtNum);
-        }
-        return hasVisitedStartingNode;
-    } else {
-        visited.insert(currentNodeNumber);
-    }
-
-    Boolean hasVisitedStartingNode = false;
-    Vector<StatementNode*> stmtList = *(currentCfgNode->statementNodes);
-    for (StatementNode* stmtNode : stmtList) {
-        StatementNumber stmtNum = stmtNode->getStatementNumber();
-        hasVisitedStartingNode = hasVisitedStartingNode || (stmtNum == startingStmtNum);
-        results.insert(stmtNum);
-    }
-
-    if (isFirstRecursiveCall) {
-        hasVisitedStartingNode = false;
+    auto cached = cacheNextBipStarTable.find(leftRefVal);
+    if (cached != cacheNextBipStarTable.end()) {
+        return cached->second;
     }
 
-    Vector<CfgNode*> childrenList = *(currentCfgNode->childrenNodes);
-    for (CfgNode* childCfgNode : childrenList) {
-        hasVisitedStartingNode = findAllNextBipFromCfgNode(childCfgNode, startingStmtNum, false, visited, results)
-                                 || hasVisitedStartingNode;
-    }
-
-    return hasVisitedStartingNode;
+    // the summaries of the procedures in the CFG BIP give all
+    // statements reachable in an unknown context of calls
+    const BipSupergraph* cfgBip = bipFacade->getCfgBip();
+    Bitset results = cfgBip == nullptr ? Bitset() : cfgBip->findReachableFrom(leftRefVal);
+    return cacheNextBipStarTable.emplace(leftRefVal, std::move(results)).first->second;
 }
 
-CacheSet NextBipEvaluator::processLeftKnownStar(Integer leftRefVal)
+Boolean NextBipEvaluator::isNextBipStar(Integer leftRefVal, Integer rightRefVal)
 {
-    if (cacheNextBipStarTable.isCached(leftRefVal)) {
-        return cacheNextBipStarTable.get(leftRefVal);
-    }
-
-    Vector<StatementPositionInCfg> allCgfNodes = findAllCorrespondingPositions(leftRefVal, *bipFacade);
-    CacheSet results;
-
-    if (allCgfNodes.empty()) {
-        CacheSet emptyCacheSet;
-        cacheNextBipStarTable.insert(leftRefVal, emptyCacheSet);
-        return emptyCacheSet;
-    }
-
-    Boolean hasNextBipToItself = false; // if the node has a NextBip* relationship with itself
-    for (StatementPositionInCfg startingPosition : allCgfNodes) {
-        std::unordered_set<size_t> visited;
-        CfgNode* startingCfgNode = startingPosition.getNodePosition();
-        hasNextBipToItself
-            = findAllNextBipFromCfgNode(startingCfgNode, leftRefVal, true, visited, results) || hasNextBipToItself;
-    }
-
-    // Since we added both Next* and Previous* statements in the same statement list,
-    // those Previous* statements in the same statement list should not be added if
-    // the starting Node is in not a while loop. Hence, if it does not have a NextBip*
-    // relationship with itself, we need to remove those Previous* statements that we
-    // added previously.
-    Vector<StatementNode*> stmtList = *(allCgfNodes.at(0).getNodePosition()->statementNodes);
-    for (StatementNode* stmtNode : stmtList) {
-        StatementNumber stmtNum = stmtNode->getStatementNumber();
-        if (!hasNextBipToItself && stmtNum <= leftRefVal) {
-            results.remove(stmtNum);
-        }
-    }
+    const Bitset& results = processLeftKnownStar(leftRefVal);
+    return rightRefVal >= 0 && static_cast<size_t>(rightRefVal) < results.size() && results.test(rightRefVal);
+}
 
-    cacheNextBipStarTable.insert(leftRefVal, results);
-    return results;
+CacheSet NextBipEvaluator::findNextBipStar(Integer leftRefVal)
+{
+    return CacheSet(processLeftKnownStar(leftRefVal).toVector());
 }
 
 Void NextBipEvaluator::evaluateLeftKnownStar(Integer leftRefVal, const Reference& rightRef)
 {
-    CacheSet results = processLeftKnownStar(leftRefVal);
+    CacheSet results = findNextBipStar(leftRefVal);
     if (results.empty()) {
         resultsTable.storeResultsZero(false);
     }
@@ -103,12 +49,11 @@ Void NextBipEvaluator::evaluateRightKnownStar(const Reference& leftRef, Integer
 {
     StatementType prevRefStmtType
         = leftRef.isWildCard() ? AnyStatement : mapToStatementType(leftRef.getDesignEntity().getType());
-    Vector<StatementNumber> allLeftStatements = facade->getStatements(prevRefStmtType);
+    VectorView<StatementNumber> allLeftStatements = facade->getStatements(prevRefStmtType);
 
     CacheSet results;
     for (StatementNumber stmtNum : allLeftStatements) {
-        CacheSet allNextBipStarOfLeftRef = processLeftKnownStar(stmtNum);
-        if (allNextBipStarOfLeftRef.isCached(rightRefVal)) {
+        if (isNextBipStar(stmtNum, rightRefVal)) {
             results.insert(stmtNum);
         }
     }
@@ -126,7 +71,7 @@ Void NextBipEvaluator::evaluateBothAnyStar(const Reference& leftRef, const Refer
 
     if (leftRef.isWildCard() && rightRef.isWildCard()) {
         // check if NextBipTable has at least one NextBip Relationship
-        Vector<StatementNumber> allStatements = facade->getStatements(AnyStatement);
+        VectorView<StatementNumber> allStatements = facade->getStatements(AnyStatement);
         for (StatementNumber stmtNum : allStatements) {
             if (!facade->getNext(stmtNum, AnyStatement).empty()) {
                 resultsTable.storeResultsZero(true);
@@ -139,12 +84,12 @@ Void NextBipEvaluator::evaluateBothAnyStar(const Reference& leftRef, const Refer
     }
 
     if (leftRef.isWildCard()) {
-        Vector<StatementNumber> nextBipTypeStatements = facade->getStatements(nextRefStmtType);
+        VectorView<StatementNumber> nextBipTypeStatements = facade->getStatements(nextRefStmtType);
         Vector<StatementNumber> results;
 
         for (StatementNumber stmtNum : nextBipTypeStatements) {
             // if it has any normal Previous relationship, add to results
-            Vector<StatementNumber> allPrevStatements = facade->getPrevious(stmtNum, AnyStatement);
+            VectorView<StatementNumber> allPrevStatements = facade->getPrevious(stmtNum, AnyStatement);
             if (!allPrevStatements.empty()) {
                 results.push_back(stmtNum);
             }
@@ -156,12 +101,12 @@ Void NextBipEvaluator::evaluateBothAnyStar(const Reference& leftRef, const Refer
     }
 
     if (rightRef.isWildCard()) {
-        Vector<StatementNumber> prevTypeStatements = facade->getStatements(prevRefStmtType);
+        VectorView<StatementNumber> prevTypeStatements = facade->getStatements(prevRefStmtType);
         Vector<StatementNumber> results;
 
         for (StatementNumber stmtNum : prevTypeStatements) {
             // if it has any normal Next relationship, add to results
-            Vector<StatementNumber> allNextStatements = facade->getNext(stmtNum, AnyStatement);
+            VectorView<StatementNumber> allNextStatements = facade->getNext(stmtNum, AnyStatement);
             if (!allNextStatements.empty()) {
                 results.push_back(stmtNum);
             }
@@ -174,12 +119,10 @@ Void NextBipEvaluator::evaluateBothAnyStar(const Reference& leftRef, const Refer
 
     // Both are same Synonyms
     if (leftRef == rightRef) {
-        Vector<StatementNumber> prevTypeStatements = facade->getStatements(prevRefStmtType);
+        VectorView<StatementNumber> prevTypeStatements = facade->getStatements(prevRefStmtType);
         Vector<StatementNumber> results;
         for (StatementNumber stmtNum : prevTypeStatements) {
-
-            CacheSet nextStarAnyStmtResults = processLeftKnownStar(stmtNum);
-            if (nextStarAnyStmtResults.isCached(stmtNum)) {
+            if (isNextBipStar(stmtNum, stmtNum)) {
                 results.push_back(stmtNum);
             }
         }
@@ -190,10 +133,10 @@ Void NextBipEvaluator::evaluateBothAnyStar(const Reference& leftRef, const Refer
     }
 
     // Both are different Synonyms
-    Vector<StatementNumber> prevTypeStatements = facade->getStatements(prevRefStmtType);
+    VectorView<StatementNumber> prevTypeStatements = facade->getStatements(prevRefStmtType);
     Vector<Pair<Integer, String>> pairedResults;
     for (StatementNumber stmtNum : prevTypeStatements) {
-        CacheSet nextStarAnyStmtResults = processLeftKnownStar(stmtNum);
+        CacheSet nextStarAnyStmtResults = findNextBipStar(stmtNum);
         ClauseResult filteredResults = nextStarAnyStmtResults.filterStatementType(nextRefStmtType).toClauseResult();
         // Store results
         for (const String& result : filteredResults) {
@@ -206,8 +149,7 @@ Void NextBipEvaluator::evaluateBothAnyStar(const Reference& leftRef, const Refer
 
 Void NextBipEvaluator::evaluateBothKnownStar(Integer leftRefVal, Integer rightRefVal)
 {
-    CacheSet results = processLeftKnownStar(leftRefVal);
-    resultsTable.storeResultsZero(results.isCached(rightRefVal));
+    resultsTable.storeResultsZero(isNextBipStar(leftRefVal, rightRefVal));
 }
 
 NextBipEvaluator::NextBipEvaluator(ResultsTable& resultsTable, NextBipFacade* facade):
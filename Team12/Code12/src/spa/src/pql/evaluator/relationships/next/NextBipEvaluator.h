@@ -5,13 +5,16 @@
 #ifndef SPA_PQL_NEXT_BIP_EVALUATOR_H
 #define SPA_PQL_NEXT_BIP_EVALUATOR_H
 
+#include <unordered_map>
+
+#include "Bitset.h"
 #include "NextBipFacade.h"
 #include "NextEvaluator.h"
 
 class NextBipEvaluator: public NextEvaluator {
 private:
     NextBipFacade* bipFacade;
-    CacheTable cacheNextBipStarTable;
+    std::unordered_map<Integer, Bitset> cacheNextBipStarTable;
 
     // Methods for NextBip*
     Void evaluateLeftKnownStar(Integer leftRefVal, const Reference& rightRef) override;
@@ -20,7 +23,9 @@ private:
     Void evaluateBothKnownStar(Integer leftRefVal, Integer rightRefVal) override;
 
     // Helper methods
-    CacheSet processLeftKnownStar(Integer leftRefVal);
+    const Bitset& processLeftKnownStar(Integer leftRefVal);
+    Boolean isNextBipStar(Integer leftRefVal, Integer rightRefVal);
+    CacheSet findNextBipStar(Integer leftRefVal);
 
 public:
     NextBipEvaluator(NextBipEvaluator&&) = default;
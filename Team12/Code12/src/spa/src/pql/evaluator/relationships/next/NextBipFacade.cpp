@@ -7,29 +7,29 @@
 
 #include "pkb/PKB.h"
 
-Vector<Integer> NextBipFacade::getNext(Integer prev, StatementType nextType)
+VectorView<Integer> NextBipFacade::getNext(Integer prev, StatementType nextType)
 {
-    return getAllNextBipStatements(prev, nextType);
+    return viewAllNextBipStatements(prev, nextType);
 }
 
-Vector<Integer> NextBipFacade::getPrevious(Integer next, StatementType prevType)
+VectorView<Integer> NextBipFacade::getPrevious(Integer next, StatementType prevType)
 {
-    return getAllPreviousBipStatements(next, prevType);
+    return viewAllPreviousBipStatements(next, prevType);
 }
 
-Vector<Integer> NextBipFacade::getNextMatching(StatementType prevType, StatementType nextType)
+VectorView<Integer> NextBipFacade::getNextMatching(StatementType prevType, StatementType nextType)
 {
-    return getAllNextBipStatementsTyped(prevType, nextType);
+    return viewAllNextBipStatementsTyped(prevType, nextType);
 }
 
-Vector<Integer> NextBipFacade::getPreviousMatching(StatementType prevType, StatementType nextType)
+VectorView<Integer> NextBipFacade::getPreviousMatching(StatementType prevType, StatementType nextType)
 {
-    return getAllPreviousBipStatementsTyped(prevType, nextType);
+    return viewAllPreviousBipStatementsTyped(prevType, nextType);
 }
 
-Vector<std::pair<Integer, Integer>> NextBipFacade::getNextPairs(StatementType prevType, StatementType nextType)
+VectorView<Pair<Integer, Integer>> NextBipFacade::getNextPairs(StatementType prevType, StatementType nextType)
 {
-    return getAllNextBipTuples(prevType, nextType);
+    return viewAllNextBipTuples(prevType, nextType);
 }
 
 Boolean NextBipFacade::isNext(Integer prev, Integer next)
@@ -51,3 +51,8 @@ ProcedureName NextBipFacade::getProcedureOfStmt(StatementNumber stmtNum)
 
     return optional.at(0);
 }
+
+const FlatCfg* NextBipFacade::getFlatCfgOfStatement(StatementNumber /* unused */)
+{
+    return nullptr;
+}
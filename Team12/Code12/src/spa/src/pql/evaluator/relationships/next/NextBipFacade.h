@@ -28,7 +28,7 @@ public:
      * @param prev A statement number, to query for matching relationships.
      * @param nextType Statement type restriction on the returned statements.
      */
-    Vector<Integer> getNext(Integer prev, StatementType nextType) override;
+    VectorView<Integer> getNext(Integer prev, StatementType nextType) override;
 
     /**
      * Returns a list of statement numbers that are directly
@@ -39,7 +39,7 @@ public:
      * @param next A statement number, to query for matching relationships.
      * @param prevType Statement type restriction on the returned statements.
      */
-    Vector<Integer> getPrevious(Integer next, StatementType prevType) override;
+    VectorView<Integer> getPrevious(Integer next, StatementType prevType) override;
 
     /**
      * Given two statement types, finds all NextBip relationships that
@@ -51,7 +51,7 @@ public:
      *                 query the Program Knowledge Base with.
      * @param nextType Statement type restriction on the returned statements.
      */
-    Vector<Integer> getNextMatching(StatementType prevType, StatementType nextType) override;
+    VectorView<Integer> getNextMatching(StatementType prevType, StatementType nextType) override;
 
     /**
      * Given two statement types, finds all NextBip relationships that
@@ -63,7 +63,7 @@ public:
      * @param nextType Statement type restriction on the second element, to
      *                 query the Program Knowledge Base with.
      */
-    Vector<Integer> getPreviousMatching(StatementType prevType, StatementType nextType) override;
+    VectorView<Integer> getPreviousMatching(StatementType prevType, StatementType nextType) override;
 
     /**
      * Given two statement types, finds all NextBip relationships that
@@ -73,7 +73,7 @@ public:
      * @param prevType Statement type restriction on the first element of returned pairs.
      * @param nextType Statement type restriction on the second element of returned pairs.
      */
-    Vector<std::pair<Integer, Integer>> getNextPairs(StatementType prevType, StatementType nextType) override;
+    VectorView<Pair<Integer, Integer>> getNextPairs(StatementType prevType, StatementType nextType) override;
 
     /**
      * Returns true, if NextBip(prev, next) holds.
@@ -95,6 +95,12 @@ public:
      * Returns the containing Procedure of the given statement.
      */
     ProcedureName getProcedureOfStmt(StatementNumber stmtNum) override;
+
+    /**
+     * Returns a nullptr, as NextBip relationships cross
+     * procedures and are not in the flat CFG of a procedure.
+     */
+    const FlatCfg* getFlatCfgOfStatement(StatementNumber stmtNum) override;
 };
 
 #endif // SPA_PQL_NEXT_BIP_FACADE_H
@@ -77,7 +77,7 @@ Void NextEvaluator::evaluateBothAnyStar(const Reference& leftRef, const Referenc
 
     if (leftRef.isWildCard() && rightRef.isWildCard()) {
         // check if NextTable has at least one Next Relationship
-        Vector<StatementNumber> allStatements = facade->getStatements(AnyStatement);
+        VectorView<StatementNumber> allStatements = facade->getStatements(AnyStatement);
         for (StatementNumber stmtNum : allStatements) {
             if (!facade->getNext(stmtNum, AnyStatement).empty()) {
                 resultsTable.storeResultsZero(true);
@@ -90,12 +90,12 @@ Void NextEvaluator::evaluateBothAnyStar(const Reference& leftRef, const Referenc
     }
 
     if (leftRef.isWildCard()) {
-        Vector<StatementNumber> nextTypeStatements = facade->getStatements(nextRefStmtType);
+        VectorView<StatementNumber> nextTypeStatements = facade->getStatements(nextRefStmtType);
         Vector<StatementNumber> results;
 
         for (StatementNumber stmtNum : nextTypeStatements) {
             // if it has any normal Previous relationship, add to results
-            Vector<StatementNumber> allPrevStatements = facade->getPrevious(stmtNum, AnyStatement);
+            VectorView<StatementNumber> allPrevStatements = facade->getPrevious(stmtNum, AnyStatement);
             if (!allPrevStatements.empty()) {
                 results.push_back(stmtNum);
             }
@@ -107,12 +107,12 @@ Void NextEvaluator::evaluateBothAnyStar(const Reference& leftRef, const Referenc
     }
 
     if (rightRef.isWildCard()) {
-        Vector<StatementNumber> prevTypeStatements = facade->getStatements(prevRefStmtType);
+        VectorView<StatementNumber> prevTypeStatements = facade->getStatements(prevRefStmtType);
         Vector<StatementNumber> results;
 
         for (StatementNumber stmtNum : prevTypeStatements) {
             // if it has any normal Next relationship, add to results
-            Vector<StatementNumber> allNextStatements = facade->getNext(stmtNum, AnyStatement);
+            VectorView<StatementNumber> allNextStatements = facade->getNext(stmtNum, AnyStatement);
             if (!allNextStatements.empty()) {
                 results.push_back(stmtNum);
             }
@@ -125,7 +125,7 @@ Void NextEvaluator::evaluateBothAnyStar(const Reference& leftRef, const Referenc
 
     // Both are same Synonyms
     if (leftRef == rightRef) {
-        Vector<StatementNumber> prevTypeStatements = facade->getStatements(prevRefStmtType);
+        VectorView<StatementNumber> prevTypeStatements = facade->getStatements(prevRefStmtType);
         Vector<StatementNumber> results;
         for (StatementNumber stmtNum : prevTypeStatements) {
             CacheSet nextStarAnyStmtResults = getCacheNextStatement(stmtNum);
@@ -140,7 +140,7 @@ Void NextEvaluator::evaluateBothAnyStar(const Reference& leftRef, const Referenc
     }
 
     // Both are different Synonyms
-    Vector<StatementNumber> prevTypeStatements = facade->getStatements(prevRefStmtType);
+    VectorView<StatementNumber> prevTypeStatements = facade->getStatements(prevRefStmtType);
     Vector<Pair<Integer, String>> pairedResults;
     for (StatementNumber stmtNum : prevTypeStatements) {
         CacheSet nextStarAnyStmtResults = getCacheNextStatement(stmtNum);
@@ -207,7 +207,16 @@ CacheSet NextEvaluator::getCacheNextStatement(StatementNumber stmtNum)
         return cacheNextStarTable.get(stmtNum);
     }
 
-    Vector<StatementNumber> nextStatementList = facade->getNext(stmtNum, AnyStatement);
+    const FlatCfg* flatCfg = facade->getFlatCfgOfStatement(stmtNum);
+    if (flatCfg != nullptr) {
+        // Search the successors of the statements in the flat CFG directly
+        CacheSet reachableCacheSet(flatCfg->findReachableFrom(stmtNum));
+        cacheNextStarTable.insert(stmtNum, reachableCacheSet);
+        exploredNextStarStatements.insert(stmtNum);
+        return reachableCacheSet;
+    }
+
+    VectorView<StatementNumber> nextStatementList = facade->getNext(stmtNum, AnyStatement);
     CacheSet currentCacheSet(nextStatementList);
 
     if (facade->getType(stmtNum) == WhileStatement) {
@@ -226,7 +235,7 @@ CacheSet NextEvaluator::getCacheNextStatement(StatementNumber stmtNum)
         // evaluate any other Next relationship first
         if (nextStatementList.size() == 2) {
             StatementNumber nextNonWhileStatementNumber
-                = nextStatementList.at(0) == nextStatementNumber ? nextStatementList.at(1) : nextStatementList.at(0);
+                = nextStatementList[0] == nextStatementNumber ? nextStatementList[1] : nextStatementList[0];
             CacheSet nextCacheSet = getCacheNextStatement(nextNonWhileStatementNumber);
             currentCacheSet.combine(nextCacheSet);
         }
@@ -274,7 +283,16 @@ CacheSet NextEvaluator::getCachePrevStatement(StatementNumber stmtNum)
         return cachePrevStarTable.get(stmtNum);
     }
 
-    Vector<StatementNumber> prevStatementList = facade->getPrevious(stmtNum, AnyStatement);
+    const FlatCfg* flatCfg = facade->getFlatCfgOfStatement(stmtNum);
+    if (flatCfg != nullptr) {
+        // Search the predecessors of the statements in the flat CFG directly
+        CacheSet reachableCacheSet(flatCfg->findReachableTo(stmtNum));
+        cachePrevStarTable.insert(stmtNum, reachableCacheSet);
+        exploredPrevStarStatements.insert(stmtNum);
+        return reachableCacheSet;
+    }
+
+    VectorView<StatementNumber> prevStatementList = facade->getPrevious(stmtNum, AnyStatement);
     CacheSet currentCacheSet(prevStatementList);
     StatementNumber prevStatementNumber = stmtNum - 1;
 
@@ -9,34 +9,34 @@
 
 #include "pkb/PKB.h"
 
-Vector<Integer> NextEvaluatorFacade::getNext(Integer prev, StatementType nextType)
+VectorView<Integer> NextEvaluatorFacade::getNext(Integer prev, StatementType nextType)
 {
-    return getAllNextStatements(prev, nextType);
+    return viewAllNextStatements(prev, nextType);
 }
 
-Vector<Integer> NextEvaluatorFacade::getPrevious(Integer next, StatementType prevType)
+VectorView<Integer> NextEvaluatorFacade::getPrevious(Integer next, StatementType prevType)
 {
-    return getAllPreviousStatements(next, prevType);
+    return viewAllPreviousStatements(next, prevType);
 }
 
-Vector<Integer> NextEvaluatorFacade::getNextMatching(StatementType prevType, StatementType nextType)
+VectorView<Integer> NextEvaluatorFacade::getNextMatching(StatementType prevType, StatementType nextType)
 {
-    return getAllNextStatementsTyped(prevType, nextType);
+    return viewAllNextStatementsTyped(prevType, nextType);
 }
 
-Vector<Integer> NextEvaluatorFacade::getPreviousMatching(StatementType prevType, StatementType nextType)
+VectorView<Integer> NextEvaluatorFacade::getPreviousMatching(StatementType prevType, StatementType nextType)
 {
-    return getAllPreviousStatementsTyped(prevType, nextType);
+    return viewAllPreviousStatementsTyped(prevType, nextType);
 }
 
-Vector<std::pair<Integer, Integer>> NextEvaluatorFacade::getNextPairs(StatementType prevType, StatementType nextType)
+VectorView<Pair<Integer, Integer>> NextEvaluatorFacade::getNextPairs(StatementType prevType, StatementType nextType)
 {
-    return getAllNextTuples(prevType, nextType);
+    return viewAllNextTuples(prevType, nextType);
 }
 
-Vector<Integer> NextEvaluatorFacade::getStatements(StatementType type)
+VectorView<Integer> NextEvaluatorFacade::getStatements(StatementType type)
 {
-    return getAllStatements(type);
+    return viewAllStatements(type);
 }
 
 StatementType NextEvaluatorFacade::getType(Integer stmtNum)
@@ -46,7 +46,7 @@ StatementType NextEvaluatorFacade::getType(Integer stmtNum)
 
 Integer NextEvaluatorFacade::getLastStatementNumberInWhileLoop(Integer currentStmtNum, Integer whileStmtNum)
 {
-    Vector<Integer> prevStatementList = this->getPrevious(whileStmtNum, AnyStatement);
+    VectorView<Integer> prevStatementList = this->getPrevious(whileStmtNum, AnyStatement);
     Integer maxNextStmtNum = *std::max_element(prevStatementList.begin(), prevStatementList.end());
 
     if (this->getType(maxNextStmtNum) == WhileStatement) {
@@ -75,3 +75,8 @@ ProcedureName NextEvaluatorFacade::getProcedureOfStmt(StatementNumber stmtNum)
 
     return optional.at(0);
 }
+
+const FlatCfg* NextEvaluatorFacade::getFlatCfgOfStatement(StatementNumber stmtNum)
+{
+    return getFlatCFGOfStatement(stmtNum);
+}
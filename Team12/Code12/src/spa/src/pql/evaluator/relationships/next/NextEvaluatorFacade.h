@@ -11,6 +11,7 @@
 #define SPA_PQL_NEXT_EVALUATOR_FACADE_H
 
 #include <cfg/CfgTypes.h>
+#include <cfg/FlatCfg.h>
 #include <pkb/PkbTypes.h>
 
 #include "Types.h"
@@ -33,7 +34,7 @@ public:
      * @param prev A statement number, to query for matching relationships.
      * @param nextType Statement type restriction on the returned statements.
      */
-    virtual Vector<Integer> getNext(Integer prev, StatementType nextType);
+    virtual VectorView<Integer> getNext(Integer prev, StatementType nextType);
 
     /**
      * Returns a list of statement numbers that are directly
@@ -43,7 +44,7 @@ public:
      * @param next A statement number, to query for matching relationships.
      * @param prevType Statement type restriction on the returned statements.
      */
-    virtual Vector<Integer> getPrevious(Integer next, StatementType prevType);
+    virtual VectorView<Integer> getPrevious(Integer next, StatementType prevType);
 
     /**
      * Given two statement types, finds all Next relationships that
@@ -55,7 +56,7 @@ public:
      *                 query the Program Knowledge Base with.
      * @param nextType Statement type restriction on the returned statements.
      */
-    virtual Vector<Integer> getNextMatching(StatementType prevType, StatementType nextType);
+    virtual VectorView<Integer> getNextMatching(StatementType prevType, StatementType nextType);
 
     /**
      * Given two statement types, finds all Next relationships that
@@ -67,7 +68,7 @@ public:
      * @param nextType Statement type restriction on the second element, to
      *                 query the Program Knowledge Base with.
      */
-    virtual Vector<Integer> getPreviousMatching(StatementType prevType, StatementType nextType);
+    virtual VectorView<Integer> getPreviousMatching(StatementType prevType, StatementType nextType);
 
     /**
      * Given two statement types, finds all Next relationships that
@@ -77,7 +78,7 @@ public:
      * @param prevType Statement type restriction on the first element of returned pairs.
      * @param nextType Statement type restriction on the second element of returned pairs.
      */
-    virtual Vector<std::pair<Integer, Integer>> getNextPairs(StatementType prevType, StatementType nextType);
+    virtual VectorView<Pair<Integer, Integer>> getNextPairs(StatementType prevType, StatementType nextType);
 
     /**
      * Returns a list of statement numbers that match
@@ -85,7 +86,7 @@ public:
      *
      * @param type Statement type restriction on the returned numbers.
      */
-    virtual Vector<Integer> getStatements(StatementType type);
+    virtual VectorView<Integer> getStatements(StatementType type);
 
     /**
      * Returns the statement type of a statement in
@@ -119,6 +120,14 @@ public:
      * Returns the containing Procedure of the given statement.
      */
     virtual ProcedureName getProcedureOfStmt(StatementNumber stmtNum);
+
+    /**
+     * Returns the flat CFG of the procedure containing the given
+     * statement, to traverse the Next relationships directly. If
+     * there is none, returns a nullptr, and Next relationships are
+     * retrieved one statement at a time instead.
+     */
+    virtual const FlatCfg* getFlatCfgOfStatement(StatementNumber stmtNum);
 };
 
 #endif // SPA_PQL_NEXT_EVALUATOR_FACADE_H
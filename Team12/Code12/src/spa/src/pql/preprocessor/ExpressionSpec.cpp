@@ -26,41 +26,15 @@ ExpressionSpec::ExpressionSpec(QueryErrorType queryErrorType, ErrorMessage error
     Errorable{queryErrorType, std::move(errorMessage)}, expression(), expressionSpecType{InvalidExpressionType}
 {}
 
-ExpressionSpec ExpressionSpec::createExpressionSpec(const String& exprSpecString)
+ExpressionSpec ExpressionSpec::createExpressionSpec(const String& expressionString, ExpressionSpecType exprSpecType)
 {
-    if (exprSpecString == "_") {
-        ExpressionSpec expressionSpec{WildcardExpressionType};
-        return expressionSpec;
-    }
-
-    if (util::isEnclosedWith(exprSpecString, '_', '_')) {
-        String possibleLiteral = util::removeCharFromBothEnds(exprSpecString);
-        if (!util::isEnclosedWith(possibleLiteral, '\"', '\"')) {
-            return ExpressionSpec(QuerySyntaxError, "Extendable ExpressionSpec is not enclosed with double quotes");
-        }
-
-        Expression* expression = createExpression(util::removeCharFromBothEnds(possibleLiteral));
-        if (!expression) {
-            return ExpressionSpec(QuerySyntaxError,
-                                  "Invalid Expression"); // TODO: Implement error type for invalid Expression
-        }
-
-        ExpressionSpec expressionSpec{expression, ExtendableLiteralExpressionType};
-        return expressionSpec;
-    }
-
-    if (!util::isEnclosedWith(exprSpecString, '\"', '\"')) {
-        return ExpressionSpec(QuerySyntaxError, "ExpressionSpec is not enclosed with double quotes");
-    }
-
-    String expressionString = util::removeCharFromBothEnds(exprSpecString);
     Expression* expression = createExpression(expressionString);
     if (!expression) {
         return ExpressionSpec(QuerySyntaxError,
                               "Invalid Expression"); // TODO: Implement error type for invalid Expression
     }
 
-    ExpressionSpec expressionSpec{expression, LiteralExpressionType};
+    ExpressionSpec expressionSpec{expression, exprSpecType};
     return expressionSpec;
 }
 
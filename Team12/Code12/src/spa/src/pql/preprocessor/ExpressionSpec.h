@@ -43,19 +43,19 @@ public:
     Expression* getExpression() const;
 
     /**
-     * Creates an ExpressionSpec of based on the given
-     * exprSpecString. It will determine the ExpressionSpecType
-     * and call the parser from frontend to parse the expression
-     * string into an Expression.
+     * Creates an ExpressionSpec of the given ExpressionSpecType,
+     * calling the parser from frontend to parse the expression
+     * string (without its quotes) into an Expression.
      *
-     * If the exprSpecString is an invalid form of
-     * ExpressionSpec, an invalid ExpressionSpec will be
-     * returned.
+     * If the expression string is not a valid expression,
+     * an invalid ExpressionSpec will be returned.
      *
-     * @param exprSpecString    The string to be parsed into an ExpressionSpec.
-     * @return                  The ExpressionSpec constructed using exprSpectString.
+     * @param expressionString  The string to be parsed into an Expression.
+     * @param exprSpecType      LiteralExpressionType or
+     *                          ExtendableLiteralExpressionType.
+     * @return                  The ExpressionSpec constructed using expressionString.
      */
-    static ExpressionSpec createExpressionSpec(const String& exprSpecString);
+    static ExpressionSpec createExpressionSpec(const String& expressionString, ExpressionSpecType exprSpecType);
 
     Boolean operator==(const ExpressionSpec& expressionSpec);
 };
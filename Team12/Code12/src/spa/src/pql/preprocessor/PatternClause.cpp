@@ -5,6 +5,8 @@
 
 #include "PatternClause.h"
 
+#include <utility>
+
 /************************/
 /** Static Members      */
 /************************/
@@ -29,43 +31,33 @@ PatternClause::PatternClause(Synonym s, PatternStatementType statementType, Refe
 /** Static Methods      */
 /************************/
 
-Clause* PatternClause::createPatternClause(const String& clauseConstraint, DeclarationTable& declarationTable)
+Clause* PatternClause::createPatternClause(const Synonym& patternSynonym, const Reference& entRef,
+                                           Vector<ExpressionSpec> expressionSpecs, DeclarationTable& declarationTable)
 {
-    StringPair pair = util::splitByFirstDelimiter(clauseConstraint, '(');
-
-    Synonym patternSynonym = pair.first;
     DesignEntityType synonymDesignEntityType = declarationTable.getDesignEntityOfSynonym(patternSynonym).getType();
     Boolean isValidDesignEntityType
         = designEntityTypeValidationSet.find(synonymDesignEntityType) != designEntityTypeValidationSet.end();
     if (!isValidDesignEntityType) {
         return new Clause(PatternClauseType, QuerySyntaxError,
-                          DesignEntity::INVALID_DESIGN_ENTITY + "used in PatternClause " + clauseConstraint);
+                          DesignEntity::INVALID_DESIGN_ENTITY + "used in PatternClause " + patternSynonym);
     }
 
-    String constraintVariablesString
-        = pair.second.substr(0, pair.second.size() - 1); // remove the last char which is a close parentheses
-    StringVector constraintVariables = splitByDelimiter(constraintVariablesString, ",");
-
     if (synonymDesignEntityType == AssignType) {
-        return processAssignPatternClause(patternSynonym, constraintVariables, declarationTable);
+        return processAssignPatternClause(patternSynonym, entRef, expressionSpecs);
     } else {
         // Process IfType or WhileType
-        return processIfWhilePatternClause(patternSynonym, synonymDesignEntityType, constraintVariables,
-                                           declarationTable);
+        return processIfWhilePatternClause(patternSynonym, synonymDesignEntityType, entRef, expressionSpecs);
     }
 }
 
-Clause* PatternClause::processAssignPatternClause(Synonym patternSynonym, StringVector constraints,
-                                                  DeclarationTable& declarationTable)
+Clause* PatternClause::processAssignPatternClause(Synonym patternSynonym, const Reference& entRef,
+                                                  Vector<ExpressionSpec>& expressionSpecs)
 {
-    if (constraints.size() != 2) {
+    if (expressionSpecs.size() != 1) {
         return new Clause(PatternClauseType, QuerySyntaxError, "Incorrect number of arguments for PatternClause");
     }
 
-    String firstConstraintString = constraints.at(0);
-    String secondConstraintString = constraints.at(1);
-
-    Reference firstReference = Reference::createReference(firstConstraintString, declarationTable);
+    Reference firstReference = entRef;
     if (firstReference.isInvalid()) {
         return new Clause(PatternClauseType, firstReference.getErrorType(), firstReference.getErrorMessage());
     }
@@ -76,10 +68,10 @@ Clause* PatternClause::processAssignPatternClause(Synonym patternSynonym, String
                           "Invalid variable in Assign PatternClause: " + firstReference.getValue());
     }
 
-    ExpressionSpec rightExpressionSpec = ExpressionSpec::createExpressionSpec(secondConstraintString);
+    ExpressionSpec& rightExpressionSpec = expressionSpecs.at(0);
     if (rightExpressionSpec.isInvalid()) {
         return new Clause(PatternClauseType, rightExpressionSpec.getErrorType(),
-                          "Invalid ExpressionSpec used in assign PatternClause: " + secondConstraintString);
+                          "Invalid ExpressionSpec used in assign PatternClause");
     }
 
     return new PatternClause(std::move(patternSynonym), AssignPatternType, firstReference,
@@ -87,24 +79,25 @@ Clause* PatternClause::processAssignPatternClause(Synonym patternSynonym, String
 }
 
 Clause* PatternClause::processIfWhilePatternClause(Synonym patternSynonym, DesignEntityType synonymDesignEntityType,
-                                                   StringVector constraints, DeclarationTable& declarationTable)
+                                                   const Reference& entRef,
+                                                   const Vector<ExpressionSpec>& expressionSpecs)
 {
     assert(synonymDesignEntityType == IfType // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
            || synonymDesignEntityType == WhileType);
 
-    if ((constraints.size() != 3 && synonymDesignEntityType == IfType)
-        || (constraints.size() != 2 && synonymDesignEntityType == WhileType)) {
+    if ((expressionSpecs.size() != 2 && synonymDesignEntityType == IfType)
+        || (expressionSpecs.size() != 1 && synonymDesignEntityType == WhileType)) {
         return new Clause(PatternClauseType, QuerySyntaxError, "Incorrect number of arguments for PatternClause");
     }
 
-    String firstConstraintString = constraints.at(0);
-    String secondConstraintString = constraints.at(1);
-    String thirdConstraintString;
-    if (synonymDesignEntityType == IfType) {
-        thirdConstraintString = constraints.at(2);
+    for (const ExpressionSpec& expressionSpec : expressionSpecs) {
+        if (expressionSpec.expressionSpecType != WildcardExpressionType) {
+            return new Clause(PatternClauseType, QuerySyntaxError,
+                              "Second or third argument of if/while PatternClause is not a wildcard");
+        }
     }
 
-    Reference firstReference = Reference::createReference(firstConstraintString, declarationTable);
+    Reference firstReference = entRef;
     if (firstReference.isInvalid()) {
         return new Clause(PatternClauseType, firstReference.getErrorType(), firstReference.getErrorMessage());
     }
@@ -115,11 +108,6 @@ Clause* PatternClause::processIfWhilePatternClause(Synonym patternSynonym, Desig
                           "Invalid variable in If/While PatternClause: " + firstReference.getValue());
     }
 
-    if (secondConstraintString != "_" || (synonymDesignEntityType == IfType && thirdConstraintString != "_")) {
-        return new Clause(PatternClauseType, QuerySyntaxError,
-                          "Second or third argument of if/while PatternClause is not a wildcard");
-    }
-
     PatternStatementType patternType = synonymDesignEntityType == IfType ? IfPatternType : WhilePatternType;
 
     return new PatternClause(std::move(patternSynonym), patternType, firstReference);
@@ -153,6 +141,11 @@ Reference PatternClause::getEntRef() const
     return entityReference;
 }
 
+Void PatternClause::setEntRef(Reference newRef)
+{
+    entityReference = std::move(newRef);
+}
+
 const ExpressionSpec& PatternClause::getExprSpec() const
 {
     return expressionSpec;
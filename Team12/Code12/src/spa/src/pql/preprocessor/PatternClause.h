@@ -39,13 +39,12 @@ private:
      * will be returned.
      *
      * @param patternSynonym    Synonym of the clause.
-     * @param constraints       Constraints of the Assign PatternClause.
-     * @param declarationTable  DeclarationTable to check the validity
-     *                          of the Synonym.
+     * @param entRef            Reference to the variable of the clause.
+     * @param expressionSpecs   The other arguments of the clause.
      * @return                  Clause* of the Assign PatternClause.
      */
-    static Clause* processAssignPatternClause(Synonym patternSynonym, StringVector constraints,
-                                              DeclarationTable& declarationTable);
+    static Clause* processAssignPatternClause(Synonym patternSynonym, const Reference& entRef,
+                                              Vector<ExpressionSpec>& expressionSpecs);
 
     /**
      * Returns a Clause* pointing the newly instantiate
@@ -56,13 +55,14 @@ private:
      * an erroneous Clause* will be returned.
      *
      * @param patternSynonym    Synonym of the clause.
-     * @param constraints       Constraints of the If/While PatternClause.
-     * @param declarationTable  DeclarationTable to check the validity
-     *                          of the Synonym.
-     * @return                  Clause* of the Assign PatternClause.
+     * @param entRef            Reference to the variable of the clause.
+     * @param expressionSpecs   The other arguments of the clause, which
+     *                          must all be wildcards.
+     * @return                  Clause* of the If/While PatternClause.
      */
     static Clause* processIfWhilePatternClause(Synonym patternSynonym, DesignEntityType synonymDesignEntityType,
-                                               StringVector constraints, DeclarationTable& declarationTable);
+                                               const Reference& entRef,
+                                               const Vector<ExpressionSpec>& expressionSpecs);
 
     /**
      * Checks the validity of the variable in PatternClauses.
@@ -83,16 +83,22 @@ private:
 
 public:
     /**
-     * Processes the clause constraint string for a
-     * PatternClause, by abstracting it into its relevant
-     * PatternTypeStatement, Reference and ExpressionSpec.
+     * Creates a PatternClause of the given Synonym, with
+     * its variable Reference and its other arguments. An
+     * assign PatternClause has one ExpressionSpec, while
+     * the other arguments of an if (two) or while (one)
+     * PatternClause are wildcards.
      *
-     * @param clauseConstraint  String of the clause constraint with all
-     *                          whitespaces removed.
+     * @param patternSynonym    Synonym of the clause.
+     * @param entRef            Reference to the variable of the clause.
+     * @param expressionSpecs   The other arguments of the clause.
+     * @param declarationTable  DeclarationTable to check the validity
+     *                          of the Synonym.
      * @return                  Clause* of the PatternClause that was
-     *                          constructed.
+     *                          constructed, or an erroneous Clause*.
      */
-    static Clause* createPatternClause(const String& clauseConstraint, DeclarationTable& declarationTable);
+    static Clause* createPatternClause(const Synonym& patternSynonym, const Reference& entRef,
+                                       Vector<ExpressionSpec> expressionSpecs, DeclarationTable& declarationTable);
 
     /**
      * Instantiate a PatternClause with the given Synonym,
@@ -125,6 +131,9 @@ public:
     // Retrieves the variable Reference of the PatternClause.
     Reference getEntRef() const;
 
+    // Sets the variable Reference of the PatternClause.
+    Void setEntRef(Reference newRef);
+
     // Retrieves the ExpressionSpec of the PatternCluase.
     const ExpressionSpec& getExprSpec() const;
 
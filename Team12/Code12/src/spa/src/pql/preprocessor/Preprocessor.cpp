@@ -1,584 +1,523 @@
 /**
- * Implementation of key preprocessor methods that
- * run through a query string and identifies errors,
- * and builds the correct AbstractQuery.
+ * Implementation of the Query Preprocessor, a recursive
+ * descent parser that reads a query string in a single
+ * pass, identifies errors, and builds the AbstractQuery.
  */
 
 #include "Preprocessor.h"
 
-#include "AqTypesUtils.h"
+#include <memory>
+
+#include "QueryLexer.h"
+
+/**
+ * Parses a PQL query with the grammar below, where names in
+ * quotes are keywords, and other names are tokens of the lexer.
+ *
+ * query        : declaration* "Select" result clause*
+ * declaration  : designEntity NAME ("," NAME)* ";"
+ * result       : "BOOLEAN" | element | "<" element ("," element)* ">"
+ * element      : NAME | NAME "." attribute
+ * clause       : "such" "that" relationship ("and" relationship)*
+ *              | "pattern" pattern ("and" pattern)*
+ *              | "with" comparison ("and" comparison)*
+ * relationship : NAME "*"? "(" reference "," reference ")"
+ * pattern      : NAME "(" reference ("," expressionSpec)* ")"
+ * comparison   : reference "=" reference
+ * reference    : "_" | INTEGER | '"' NAME '"' | element
+ *              | "?" | '"' "?" '"'      (only with placeholders)
+ *
+ * Every parse method returns false as soon as a syntax error is
+ * found, so that the rest of the query is not parsed. Semantic
+ * errors are only reported once the whole query is known to be
+ * syntactically valid.
+ */
+class QueryParser {
+public:
+    QueryParser(const String& query, Boolean allowsPlaceholders);
+
+    AbstractQuery parseQuery();
+
+private:
+    QueryLexer lexer;
+    DeclarationTable declarationTable;
+    ClauseVector clauses;
+    ErrorMessage syntaxErrorMessage;
+    ErrorMessage semanticsErrorMessage;
+    Boolean hasSemanticsError;
+    const Boolean allowsPlaceholders;
+    Integer placeholderCount;
+
+    Boolean parseDeclaration();
+    Boolean parseDesignEntity(DesignEntity& designEntity);
+    Boolean parseResult(ResultSynonymVector& resultSynonyms);
+    Boolean parseElement(Synonym& synonym, String& attributeName);
+    Boolean parseAttributeName(String& attributeName);
+    Boolean parseClauses();
+    Boolean parseRelationship();
+    Boolean parsePattern();
+    Boolean parseComparison();
+    Boolean parseReference(Reference& reference);
+    Boolean parseExpressionSpec(ExpressionSpec& expressionSpec);
+    Boolean parseQuotedExpression(ExpressionSpecType exprSpecType, ExpressionSpec& expressionSpec);
+
+    // Creates the value of the next placeholder in the query.
+    ReferenceValue createPlaceholderValue();
+    ResultSynonym createResultSynonym(const Synonym& synonym, const String& attributeName);
+    Boolean addClause(Clause* clause);
+
+    // Moves past the current token if it is the given name or symbol.
+    Boolean acceptName(const char* name);
+    Boolean acceptSymbol(char symbol);
+    // Moves past the current token if it is the given name or symbol,
+    // and there is no whitespace between it and the previous token.
+    Boolean acceptAdjacentName(const char* name);
+    Boolean acceptAdjacentSymbol(char symbol);
+    // Moves past the current token if it is the given symbol,
+    // otherwise reports a syntax error.
+    Boolean expectSymbol(char symbol);
+
+    // Reports a syntax error, and returns false.
+    Boolean reportSyntaxError(ErrorMessage message);
+    // Reports a syntax error at the current token, and returns false.
+    Boolean reportUnexpectedToken(const String& expected);
+    // Reports a semantic error, if there is none yet.
+    Void reportSemanticsError(ErrorMessage message);
+};
 
 AbstractQuery Preprocessor::processQuery(const String& query)
 {
-    // TODO: Improve splitting of Declarations and Select Clauses - iterate every char from the front until ; Select
-    StringPair splitQuery = splitDeclarationAndSelectClause(query);
+    QueryParser parser(query, false);
+    return parser.parseQuery();
+}
+
+AbstractQuery Preprocessor::processQueryWithPlaceholders(const String& query)
+{
+    QueryParser parser(query, true);
+    return parser.parseQuery();
+}
 
-    String declarationString = trimWhitespace(splitQuery.first);
-    String synonymAndClausesString = trimWhitespace(splitQuery.second);
+QueryParser::QueryParser(const String& query, Boolean allowsPlaceholders):
+    lexer(query), declarationTable(), clauses(), syntaxErrorMessage(), semanticsErrorMessage(),
+    hasSemanticsError(false), allowsPlaceholders(allowsPlaceholders), placeholderCount(0)
+{}
 
-    DeclarationTable declarationTable;
-    if (!declarationString.empty()) {
-        // Process declarations into declaration table
-        declarationTable = processDeclarations(declarationString);
-        if (declarationTable.isSyntacticallyInvalid()) {
-            return AbstractQuery(QuerySyntaxError, declarationTable.getErrorMessage());
+AbstractQuery QueryParser::parseQuery()
+{
+    while (!lexer.isName("Select")) {
+        if (lexer.isAtEnd()) {
+            return AbstractQuery(QuerySyntaxError, "No Select Clause");
+        }
+        if (!parseDeclaration()) {
+            return AbstractQuery(QuerySyntaxError, syntaxErrorMessage);
         }
     }
+    lexer.advance();
 
-    // Extract select keyword
-    StringVector selectAndClausesVector = splitByFirstConsecutiveWhitespace(synonymAndClausesString);
-
-    // No select clause
-    if (selectAndClausesVector.size() < 2) {
-        return AbstractQuery(QuerySyntaxError, "No Select Clause");
+    ResultSynonymVector resultSynonyms;
+    if (!parseResult(resultSynonyms) || !parseClauses()) {
+        return AbstractQuery(QuerySyntaxError, syntaxErrorMessage);
     }
 
-    String possibleSelectKeyword = selectAndClausesVector.at(0);
-    if (possibleSelectKeyword != "Select") {
-        return AbstractQuery(QuerySyntaxError, "No Select keyword");
+    // Return false if the query is semantically invalid and Select BOOLEAN
+    if (hasSemanticsError) {
+        return AbstractQuery(QuerySemanticsError, semanticsErrorMessage, resultSynonyms.isSelectBoolean());
     }
 
-    String synonymAndClauses = selectAndClausesVector.at(1);
-    if (synonymAndClauses.empty()) {
-        return AbstractQuery(QuerySyntaxError, "No Select synonym");
-    }
-    StringVector synonymAndClausesVector = splitResultAndClauses(synonymAndClauses);
+    return AbstractQuery(resultSynonyms, declarationTable, clauses);
+}
 
-    // No synonym
-    if (selectAndClausesVector.empty()) {
-        return AbstractQuery(QuerySyntaxError, "No Result Synonym");
+Boolean QueryParser::parseDeclaration()
+{
+    DesignEntity designEntity;
+    if (!parseDesignEntity(designEntity)) {
+        return false;
     }
 
-    String selectResultString = synonymAndClausesVector.at(0);
+    do {
+        if (lexer.getType() != NameQueryToken) {
+            return reportUnexpectedToken("a Synonym");
+        }
 
-    ResultSynonymVector resultSynonymVector = processSelectResultString(selectResultString, declarationTable);
+        Synonym synonym = lexer.getText();
+        if (declarationTable.hasSynonym(synonym)) {
+            reportSemanticsError("Synonym " + synonym + " has already been declared");
+        } else {
+            declarationTable.addDeclaration(synonym, designEntity);
+        }
+        lexer.advance();
+    } while (acceptSymbol(','));
 
-    if (resultSynonymVector.isInvalid()) {
-        return AbstractQuery(resultSynonymVector.getErrorType(), resultSynonymVector.getErrorMessage());
-    }
+    return expectSymbol(';');
+}
 
-    // Return false if Declarations is semantically invalid and Select BOOLEAN
-    if (declarationTable.isSemanticallyInvalid()) {
-        return AbstractQuery(QuerySemanticsError, declarationTable.getErrorMessage(),
-                             resultSynonymVector.isSelectBoolean());
-    }
+Boolean QueryParser::parseDesignEntity(DesignEntity& designEntity)
+{
+    if (acceptName("prog")) {
+        // prog_line is a single keyword, so it cannot contain whitespace
+        if (!acceptAdjacentSymbol('_') || !acceptAdjacentName("line")) {
+            return reportSyntaxError(DesignEntity::INVALID_DESIGN_ENTITY + "prog");
+        }
 
-    // Only select a synonym, with no other clauses
-    if (synonymAndClausesVector.size() == 1) {
-        AbstractQuery abstractQuery(resultSynonymVector, declarationTable);
-        return abstractQuery;
+        designEntity = DesignEntity(Prog_LineType);
+        return true;
     }
 
-    // Process clauses into ClauseList
-    String clausesString = synonymAndClausesVector.at(1);
-    ClauseVector clausesVector = processClauses(clausesString, declarationTable);
-    if (clausesVector.isSyntacticallyInvalid()) {
-        return AbstractQuery(QuerySyntaxError, clausesVector.getErrorMessage());
-    } else if (clausesVector.isSemanticallyInvalid()) {
-        // Return false if Declarations is semantically invalid and Select BOOLEAN
-        return AbstractQuery(QuerySemanticsError, clausesVector.getErrorMessage(),
-                             resultSynonymVector.isSelectBoolean());
+    if (lexer.getType() == NameQueryToken) {
+        designEntity = DesignEntity(lexer.getText());
+    }
+    if (designEntity.getType() == NonExistentType) {
+        return reportSyntaxError(DesignEntity::INVALID_DESIGN_ENTITY + lexer.getText());
     }
 
-    AbstractQuery abstractQuery(resultSynonymVector, declarationTable, clausesVector);
-    return abstractQuery;
+    lexer.advance();
+    return true;
 }
 
-ResultSynonymVector processSelectResultString(String selectResultString, DeclarationTable& declarationTable)
+Boolean QueryParser::parseResult(ResultSynonymVector& resultSynonyms)
 {
-    // BOOLEAN result
-    if (selectResultString == "BOOLEAN") {
-        if (!declarationTable.hasSynonym(selectResultString)) {
-            // Empty Vector means result is of type BOOLEAN
-            return ResultSynonymVector();
-        }
+    Synonym synonym;
+    String attributeName;
 
-        return ResultSynonymVector{ResultSynonym{selectResultString}};
-    }
+    // Tuple result
+    if (acceptSymbol('<')) {
+        do {
+            if (!parseElement(synonym, attributeName)) {
+                return false;
+            }
 
-    // Single Synonym result
-    if (selectResultString.at(0) != '<') {
-        ResultSynonym processedResultSynonym = processResultSynonym(selectResultString, declarationTable);
-        if (processedResultSynonym.isInvalid()) {
-            return ResultSynonymVector(processedResultSynonym.getErrorType(), processedResultSynonym.getErrorMessage());
-        }
+            resultSynonyms.add(createResultSynonym(synonym, attributeName));
+        } while (acceptSymbol(','));
 
-        return ResultSynonymVector{processedResultSynonym};
+        return expectSymbol('>');
     }
 
-    // Tuple result
-    String removeTupleString = selectResultString.substr(1);
-    StringVector resultSynonymStrings = splitByDelimiter(removeTupleString, ",");
-    if (resultSynonymStrings.empty()
-        || (resultSynonymStrings.size() == 1 && isAllWhitespaces(resultSynonymStrings.at(0)))) {
-        return ResultSynonymVector(QuerySyntaxError, "Result Synonym tuple does not have any Synonym");
+    if (!parseElement(synonym, attributeName)) {
+        return false;
     }
 
-    ResultSynonymVector resultSynonyms;
-    for (auto& resultSynonymString : resultSynonymStrings) {
-        String trimmedResultSynonymString = trimWhitespace(resultSynonymString);
-        ResultSynonym processedResultSynonym = processResultSynonym(trimmedResultSynonymString, declarationTable);
-        if (processedResultSynonym.isInvalid()) {
-            return ResultSynonymVector(processedResultSynonym.getErrorType(), processedResultSynonym.getErrorMessage());
-        }
-
-        resultSynonyms.add(processedResultSynonym);
+    // BOOLEAN result, unless BOOLEAN is a Synonym
+    if (synonym == "BOOLEAN" && attributeName.empty() && !declarationTable.hasSynonym(synonym)) {
+        // Empty Vector means result is of type BOOLEAN
+        return true;
     }
 
-    return resultSynonyms;
+    // Single Synonym result
+    resultSynonyms.add(createResultSynonym(synonym, attributeName));
+    return true;
 }
 
-ResultSynonym processResultSynonym(const String& resultSynonymString, DeclarationTable& declarationTable)
+Boolean QueryParser::parseElement(Synonym& synonym, String& attributeName)
 {
-    StringVector splitByFullStop = splitByDelimiter(resultSynonymString, ".");
-    if (splitByFullStop.size() > 2) {
-        return ResultSynonym(QuerySyntaxError, "More than one full stop in Synonym " + resultSynonymString);
+    if (lexer.getType() != NameQueryToken) {
+        return reportUnexpectedToken("a Synonym");
     }
 
-    // Synonym without attributes
-    if (splitByFullStop.size() == 1) {
-        if (!util::isPossibleIdentifier(resultSynonymString)) {
-            return ResultSynonym(QuerySyntaxError, ResultSynonym::INVALID_SYNONYM_MESSAGE + resultSynonymString);
-        } else if (!declarationTable.hasSynonym(resultSynonymString)) {
-            return ResultSynonym(QuerySemanticsError, "Synonym " + resultSynonymString + " is not declared");
-        }
+    synonym = lexer.getText();
+    lexer.advance();
 
-        return ResultSynonym(resultSynonymString);
-    }
+    attributeName.clear();
+    return !acceptSymbol('.') || parseAttributeName(attributeName);
+}
 
-    Synonym synonym = splitByFullStop[0];
-    String attribute = splitByFullStop[1];
+Boolean QueryParser::parseAttributeName(String& attributeName)
+{
+    if (acceptName("stmt")) {
+        if (!acceptAdjacentSymbol('#')) {
+            return reportSyntaxError("Invalid Attribute: stmt");
+        }
 
-    if (!util::isPossibleIdentifier(synonym)) {
-        return ResultSynonym(QuerySyntaxError, ResultSynonym::INVALID_SYNONYM_MESSAGE + resultSynonymString);
-    } else if (!declarationTable.hasSynonym(synonym)) {
-        return ResultSynonym(QuerySemanticsError, "Synonym " + synonym + " is not declared");
+        attributeName = "stmt#";
+        return true;
     }
 
-    DesignEntity designEntityOfSynonym = declarationTable.getDesignEntityOfSynonym(synonym);
-    ResultSynonym resultSynonym(synonym, attribute, designEntityOfSynonym);
+    attributeName = lexer.getText();
+    if (lexer.getType() != NameQueryToken || Attribute(attributeName).getType() == InvalidAttributeType) {
+        return reportSyntaxError("Invalid Attribute: " + attributeName);
+    }
 
-    return resultSynonym;
+    lexer.advance();
+    return true;
 }
 
-StringVector splitResultAndClauses(String& s)
+Boolean QueryParser::parseClauses()
 {
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
-    assert(s.length() > 0);
-
-    char firstChar = s.at(0);
-
-    // Normal single synonym or BOOLEAN or syn.Attribute
-    if (firstChar != '<') {
-        StringVector resultAndClauses = splitByFirstNonAlphanum(s);
-        // check for attribute
-        if (resultAndClauses.size() == 2 && !resultAndClauses[1].empty() && resultAndClauses[1][0] == '.') {
-            String attributeAndClauses = resultAndClauses[1];
-            attributeAndClauses.erase(attributeAndClauses.begin());
-            StringVector splitAttributeFromClauses
-                = splitByFirstConsecutiveWhitespace(trimWhitespace(attributeAndClauses));
-            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
-            assert(splitAttributeFromClauses.size() == 2);
-            return StringVector(
-                {resultAndClauses[0] + "." + splitAttributeFromClauses[0], splitAttributeFromClauses[1]});
+    while (!lexer.isAtEnd()) {
+        Boolean (QueryParser::*parseClause)();
+        if (acceptName("such")) {
+            if (!acceptName("that")) {
+                return reportSyntaxError("Keyword such is not followed by keyword that");
+            }
+
+            parseClause = &QueryParser::parseRelationship;
+        } else if (acceptName("pattern")) {
+            parseClause = &QueryParser::parsePattern;
+        } else if (acceptName("with")) {
+            parseClause = &QueryParser::parseComparison;
         } else {
-            return resultAndClauses;
+            return reportSyntaxError("Invalid Clause Type: " + lexer.getText());
         }
-    }
 
-    StringVector tupleResultAndClauses = splitByDelimiter(s, ">");
-    if (tupleResultAndClauses.size() > 2) {
-        return StringVector();
+        do {
+            if (!(this->*parseClause)()) {
+                return false;
+            }
+        } while (acceptName("and"));
     }
 
-    return tupleResultAndClauses;
+    return true;
 }
 
-ClauseVector processClauses(const String& clausesString, DeclarationTable& declarationTable)
+Boolean QueryParser::parseRelationship()
 {
-    ClauseVector clauseVector;
-    String currentClauseConstraint;
-    Boolean hasCurrentClause = false;
-    Boolean isPreviousTokenSuch = false; // is the previous token "such"
-    ClauseType currentClauseType = NonExistentClauseType;
-    Integer numOfOpenedParentheses = 0;
-    Boolean hasOpenParentheses = false;
-    Boolean isInProcessOfCreatingClause = false;
-    Boolean hasEncounteredEqualsOperator = false;
-    Boolean hasClosedQuotes = false;
-    Boolean isPreviousTokenFullStop = false;
-
-    /**
-     * Syntactically incorrect if number of tokens after
-     * clause identifier (e.g. such that, pattern), that
-     * does not have open parentheses is at least 2.
-     *
-     * E.g.
-     *      Select s such that Follows a (s, _)
-     *
-     * The Select string will be split as such:
-     * "Select", "s", "such", "that", "Follows", "a",
-     * "(", ...
-     *
-     * There are at least two tokens, after the "that"
-     * token, that does not contain an open parentheses,
-     * which is not possible for any form of valid clause,
-     * except for SuchThatClauses that contains Follows*
-     * and Parent* relationship as clause constraints.
-     */
-    int numOfTokensWithoutOpenParentheses = 0;
-
-    StringVector splitStringList = splitProgram(clausesString);
-    size_t length = splitStringList.size();
-    for (size_t i = 0; i < length; i++) {
-        auto& token = splitStringList.at(i);
-        if (token == "and" && !hasCurrentClause && currentClauseType != NonExistentClauseType) {
-            hasCurrentClause = true;
-            isInProcessOfCreatingClause = true;
-            continue;
-        }
+    if (lexer.getType() != NameQueryToken) {
+        return reportUnexpectedToken("a Relationship");
+    }
 
-        if (!hasCurrentClause) {
-            if (token != "such" && token != "pattern" && token != "with") {
-                return ClauseVector(QuerySyntaxError, "Invalid Clause Type: " + token);
-            }
+    String relRef = lexer.getText();
+    lexer.advance();
+    if (acceptSymbol('*')) {
+        relRef.push_back('*');
+    }
 
-            if (token == "such") {
-                isPreviousTokenSuch = true;
-            } else if (token == "pattern") {
-                currentClauseType = PatternClauseType;
-            } else if (token == "with") {
-                currentClauseType = WithClauseType;
-            }
+    RelationshipType relRefType = Relationship::getRelRefType(relRef);
+    if (relRefType == InvalidRelationshipType) {
+        return reportSyntaxError("Invalid Relationship type " + relRef);
+    }
 
-            isInProcessOfCreatingClause = true;
-            hasCurrentClause = true;
-            continue;
-        }
+    Reference leftRef;
+    Reference rightRef;
+    if (!expectSymbol('(') || !parseReference(leftRef) || !expectSymbol(',') || !parseReference(rightRef)
+        || !expectSymbol(')')) {
+        return false;
+    }
 
-        if (isPreviousTokenSuch) {
-            if (token != "that") {
-                return ClauseVector(QuerySyntaxError, "Keyword such is not followed by keyword that");
-            }
+    return addClause(SuchThatClause::createSuchThatClause(relRefType, leftRef, rightRef));
+}
 
-            isPreviousTokenSuch = false;
-            currentClauseType = SuchThatClauseType;
-            continue;
-        }
+Boolean QueryParser::parsePattern()
+{
+    if (lexer.getType() != NameQueryToken) {
+        return reportUnexpectedToken("a Synonym");
+    }
 
-        currentClauseConstraint.append(token);
-
-        if (currentClauseType == WithClauseType) {
-            if (hasEncounteredEqualsOperator) {
-                if (token == "\"" && !hasClosedQuotes) {
-                    continue;
-                }
-
-                if (token == ".") {
-                    isPreviousTokenFullStop = true;
-                    continue;
-                }
-
-                if (isPreviousTokenFullStop) {
-                    isPreviousTokenFullStop = false;
-
-                    // Expecting a '#' as the next token
-                    if (token == "stmt") {
-                        continue;
-                    }
-                } else if (i + 1 < length && !hasClosedQuotes) {
-                    if (splitStringList.at(i + 1) == ".") {
-                        continue;
-                    }
-
-                    if (splitStringList.at(i + 1) == "\"") {
-                        hasClosedQuotes = true;
-                        continue;
-                    }
-                }
-
-                Clause* clause = WithClause::createWithClause(currentClauseConstraint, declarationTable);
-                if (clause->isSyntacticallyInvalid()) {
-                    return ClauseVector(clause->getErrorType(), clause->getErrorMessage());
-                }
-
-                clauseVector.add(clause);
-
-                hasEncounteredEqualsOperator = false;
-                currentClauseConstraint.clear();
-                hasCurrentClause = false;
-                isInProcessOfCreatingClause = false;
-                hasClosedQuotes = false;
-                continue;
-            }
+    Synonym patternSynonym = lexer.getText();
+    lexer.advance();
 
-            if (token == "=") {
-                hasEncounteredEqualsOperator = true;
-            }
+    Reference entRef;
+    if (!expectSymbol('(') || !parseReference(entRef)) {
+        return false;
+    }
 
-            continue;
+    Vector<ExpressionSpec> expressionSpecs;
+    while (acceptSymbol(',')) {
+        ExpressionSpec expressionSpec;
+        if (!parseExpressionSpec(expressionSpec)) {
+            return false;
         }
 
-        std::pair<Boolean, Integer> result = countNumOfOpenParentheses(token, numOfOpenedParentheses);
-        if (!result.first) {
-            return ClauseVector(QuerySyntaxError, "Incorrect number of parentheses");
-        }
+        expressionSpecs.push_back(std::move(expressionSpec));
+    }
 
-        numOfOpenedParentheses = result.second;
+    if (!expectSymbol(')')) {
+        return false;
+    }
 
-        if (!hasOpenParentheses) {
-            hasOpenParentheses = containsOpenParentheses(token);
-        }
+    return addClause(
+        PatternClause::createPatternClause(patternSynonym, entRef, std::move(expressionSpecs), declarationTable));
+}
 
-        if (numOfOpenedParentheses < 0) {
-            return ClauseVector(QuerySyntaxError, "Close parentheses appears before open parentheses");
-        } else if (numOfOpenedParentheses == 0) {
-            if (!hasOpenParentheses) {
-                if (token != "*") {
-                    numOfTokensWithoutOpenParentheses++;
-                }
-
-                if (numOfTokensWithoutOpenParentheses >= 2) {
-                    return ClauseVector(QuerySyntaxError,
-                                        "Too many tokens after parsing Relationship: " + currentClauseConstraint);
-                }
-            } else {
-                Clause* clause;
-
-                if (currentClauseType == SuchThatClauseType) {
-                    clause = SuchThatClause::createSuchThatClause(currentClauseConstraint, declarationTable);
-                } else { // PatternClause
-                    clause = PatternClause::createPatternClause(currentClauseConstraint, declarationTable);
-                }
-
-                if (clause->isSyntacticallyInvalid()) {
-                    return ClauseVector(clause->getErrorType(), clause->getErrorMessage());
-                }
-
-                clauseVector.add(clause);
-
-                currentClauseConstraint.clear();
-                numOfOpenedParentheses = 0;
-                numOfTokensWithoutOpenParentheses = 0;
-                hasCurrentClause = false;
-                hasOpenParentheses = false;
-                isInProcessOfCreatingClause = false;
-            }
-        }
-        // if numOfOpenedParentheses is positive, continue looping
+Boolean QueryParser::parseComparison()
+{
+    Reference leftRef;
+    Reference rightRef;
+    if (!parseReference(leftRef) || !expectSymbol('=') || !parseReference(rightRef)) {
+        return false;
     }
 
-    if (!currentClauseConstraint.empty() || isInProcessOfCreatingClause) {
-        return ClauseVector(QuerySyntaxError, "Extra incomplete tokens at end of query");
+    return addClause(WithClause::createWithClause(leftRef, rightRef));
+}
+
+Boolean QueryParser::parseReference(Reference& reference)
+{
+    if (acceptSymbol('_')) {
+        reference = Reference(WildcardRefType, "_");
+        return true;
     }
 
-    int numberOfClauses = clauseVector.count();
-    // check for semantic error
-    for (int i = 0; i < numberOfClauses; i++) {
-        Clause* currentClause = clauseVector.get(i);
-        if (currentClause->isSemanticallyInvalid()) {
-            return ClauseVector(currentClause->getErrorType(), currentClause->getErrorMessage());
-        }
+    if (lexer.getType() == IntegerQueryToken) {
+        // An Integer as a reference will always be of StmtType
+        reference = Reference(IntegerRefType, lexer.getText());
+        lexer.advance();
+        return true;
     }
-    return clauseVector;
-}
 
-DeclarationTable processDeclarations(const String& declarationsString)
-{
-    DeclarationTable newDeclarations;
-
-    StringVector tokenizedStringList = splitProgram(declarationsString);
-    DesignEntity currentDesignEntity;
-    Boolean hasCurrentDesignEntity = false;
-    Boolean isPreviousTokenASynonym = false;
-    Boolean isPotentialProgLineDesignEntity = false;
-    Boolean isHighPotentialProgLineDesignEntity = false;
-
-    for (std::string& token : tokenizedStringList) {
-        if (!hasCurrentDesignEntity) {
-            if (token == "prog") {
-                isPotentialProgLineDesignEntity = true;
-                continue;
-            }
+    if (allowsPlaceholders && acceptSymbol(Preprocessor::PlaceholderPrefix)) {
+        reference = Reference(IntegerRefType, createPlaceholderValue());
+        return true;
+    }
 
-            if (token == "_") {
-                if (!isPotentialProgLineDesignEntity) {
-                    return DeclarationTable(QuerySyntaxError, DesignEntity::INVALID_DESIGN_ENTITY + "prog");
-                }
+    if (lexer.isSymbol('"')) {
+        String literal;
+        if (!lexer.readQuoted(literal)) {
+            return reportSyntaxError("Literal is not enclosed with double quotes");
+        }
 
-                isPotentialProgLineDesignEntity = false;
-                isHighPotentialProgLineDesignEntity = true;
-                continue;
-            }
+        if (allowsPlaceholders && literal.size() == 1 && literal[0] == Preprocessor::PlaceholderPrefix) {
+            reference = Reference(LiteralRefType, createPlaceholderValue());
+            return true;
+        }
 
-            if (token == "line") {
-                if (!isHighPotentialProgLineDesignEntity) {
-                    return DeclarationTable(QuerySyntaxError, DesignEntity::INVALID_DESIGN_ENTITY + "prog_");
-                }
+        if (!util::isPossibleIdentifier(literal)) {
+            return reportSyntaxError("Literal is not a valid Identifier: \"" + literal + "\"");
+        }
 
-                currentDesignEntity = DesignEntity(Prog_LineType);
-                isHighPotentialProgLineDesignEntity = false;
-                hasCurrentDesignEntity = true;
-                continue;
-            }
+        reference = Reference(LiteralRefType, literal);
+        return true;
+    }
 
-            currentDesignEntity = DesignEntity(token);
-            if (currentDesignEntity.getType() == NonExistentType) {
-                return DeclarationTable(QuerySyntaxError, DesignEntity::INVALID_DESIGN_ENTITY + token);
-            }
+    Synonym synonym;
+    String attributeName;
+    if (!parseElement(synonym, attributeName)) {
+        return false;
+    }
 
-            hasCurrentDesignEntity = true;
-        } else {
-            if (token == ";") {
-                if (!isPreviousTokenASynonym) {
-                    return DeclarationTable(QuerySyntaxError, DeclarationTable::INVALID_DECLARATION_SYNTAX);
-                }
-
-                hasCurrentDesignEntity = false;
-                isPreviousTokenASynonym = false;
-                continue;
-            } else if (token == ",") {
-                if (!isPreviousTokenASynonym) {
-                    return DeclarationTable(QuerySyntaxError, DeclarationTable::INVALID_DECLARATION_SYNTAX);
-                }
-
-                isPreviousTokenASynonym = false;
-                continue;
-            } else if (isPreviousTokenASynonym) {
-                // Syntax error e.g. while w w1;
-                return DeclarationTable(QuerySyntaxError, DeclarationTable::INVALID_DECLARATION_SYNTAX);
-            } else {
-                if (!util::isPossibleIdentifier(token)) {
-                    return DeclarationTable(QuerySyntaxError, ResultSynonym::INVALID_SYNONYM_MESSAGE + token);
-                } else if (newDeclarations.hasSynonym(token)) {
-                    return DeclarationTable(QuerySemanticsError, "Synonym " + token + " has already been declared");
-                }
-
-                newDeclarations.addDeclaration(token, currentDesignEntity);
-                isPreviousTokenASynonym = true;
-            }
+    reference = attributeName.empty()
+                    ? Reference::createSynonymReference(synonym, declarationTable)
+                    : Reference::createAttributeReference(synonym, attributeName, declarationTable);
+    return true;
+}
+
+Boolean QueryParser::parseExpressionSpec(ExpressionSpec& expressionSpec)
+{
+    if (acceptSymbol('_')) {
+        if (!lexer.isSymbol('"')) {
+            expressionSpec = ExpressionSpec(WildcardExpressionType);
+            return true;
         }
+
+        return parseQuotedExpression(ExtendableLiteralExpressionType, expressionSpec) && expectSymbol('_');
     }
-    return newDeclarations;
-}
 
-// Utils
+    if (!lexer.isSymbol('"')) {
+        return reportUnexpectedToken("an ExpressionSpec");
+    }
+
+    return parseQuotedExpression(LiteralExpressionType, expressionSpec);
+}
 
-StringPair splitDeclarationAndSelectClause(const String& query)
+Boolean QueryParser::parseQuotedExpression(ExpressionSpecType exprSpecType, ExpressionSpec& expressionSpec)
 {
-    StringPair stringVector;
-    std::size_t indexOfLastDelimiter = query.find_last_of(';', query.size() - 1);
-    if (indexOfLastDelimiter == String::npos) {
-        // No declarations
-        return std::make_pair("", query);
+    String expressionString;
+    if (!lexer.readQuoted(expressionString)) {
+        return reportSyntaxError("ExpressionSpec is not enclosed with double quotes");
     }
 
-    String leftToken = query.substr(0, indexOfLastDelimiter + 1);
-
-    String rightToken = query.substr(indexOfLastDelimiter + 1, query.size() - indexOfLastDelimiter - 1);
+    expressionSpec = ExpressionSpec::createExpressionSpec(expressionString, exprSpecType);
+    if (expressionSpec.isInvalid()) {
+        return reportSyntaxError(expressionSpec.getErrorMessage() + ": \"" + expressionString + "\"");
+    }
 
-    return std::make_pair(leftToken, rightToken);
+    return true;
 }
 
-StringVector splitByFirstNonAlphanum(const String& str)
+ReferenceValue QueryParser::createPlaceholderValue()
 {
-    const char* currentChar = str.c_str();
-    assert(isalnum(*currentChar)); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
-    String currentToken;
-    StringVector split;
+    placeholderCount++;
+    return Preprocessor::PlaceholderPrefix + std::to_string(placeholderCount);
+}
 
-    // Find first non-alphanumeric segment
-    while (*currentChar != '\0' && isalnum(*currentChar)) {
-        currentToken.push_back(*currentChar);
-        currentChar++;
+ResultSynonym QueryParser::createResultSynonym(const Synonym& synonym, const String& attributeName)
+{
+    if (!declarationTable.hasSynonym(synonym)) {
+        reportSemanticsError("Synonym " + synonym + " is not declared");
+        return ResultSynonym(synonym);
     }
 
-    split.push_back(currentToken);
-    currentToken.clear();
-
-    // Skip past all whitespaces
-    while (isWhitespace(currentChar)) {
-        currentChar++;
+    if (attributeName.empty()) {
+        return ResultSynonym(synonym);
     }
 
-    while (*currentChar != '\0') {
-        currentToken.push_back(*currentChar);
-        currentChar++;
+    DesignEntity designEntityOfSynonym = declarationTable.getDesignEntityOfSynonym(synonym);
+    ResultSynonym resultSynonym(synonym, attributeName, designEntityOfSynonym);
+    if (resultSynonym.isInvalid()) {
+        reportSemanticsError(resultSynonym.getErrorMessage());
     }
 
-    split.push_back(currentToken);
-    return split;
+    return resultSynonym;
 }
 
-StringVector splitByFirstConsecutiveWhitespace(const String& str)
+/**
+ * Adds a Clause to the query, unless it is syntactically
+ * invalid. Semantic errors of the Clause are reported once
+ * the rest of the query has been parsed.
+ */
+Boolean QueryParser::addClause(Clause* clause)
 {
-    const char* currentChar = str.c_str();
-    String currentToken;
-    StringVector splitByFirstWhitespaceVector;
-
-    // Find first whitespace
-    while (!isWhitespace(currentChar) && *currentChar != '\0') {
-        currentToken.push_back(*currentChar);
-        currentChar++;
+    std::unique_ptr<Clause> newClause(clause);
+    if (newClause->isSyntacticallyInvalid()) {
+        return reportSyntaxError(newClause->getErrorMessage());
     }
 
-    splitByFirstWhitespaceVector.push_back(currentToken);
-    currentToken.clear();
-
-    // Skip past all whitespaces
-    while (isWhitespace(currentChar)) {
-        currentChar++;
+    if (newClause->isSemanticallyInvalid()) {
+        reportSemanticsError(newClause->getErrorMessage());
     }
 
-    while (*currentChar != '\0') {
-        currentToken.push_back(*currentChar);
-        currentChar++;
+    clauses.add(newClause.release());
+    return true;
+}
+
+Boolean QueryParser::acceptName(const char* name)
+{
+    if (!lexer.isName(name)) {
+        return false;
     }
 
-    splitByFirstWhitespaceVector.push_back(currentToken);
-    return splitByFirstWhitespaceVector;
+    lexer.advance();
+    return true;
 }
 
-Boolean containsOpenParentheses(const String& str)
+Boolean QueryParser::acceptSymbol(char symbol)
 {
-    const char* currentChar = str.c_str();
-    while (*currentChar != '\0') {
-        if (*currentChar == '(') {
-            return true;
-        }
-        currentChar++;
+    if (!lexer.isSymbol(symbol)) {
+        return false;
     }
 
-    return false;
+    lexer.advance();
+    return true;
 }
 
-std::pair<Boolean, Integer> countNumOfOpenParentheses(const String& token, Integer previousNumOfOpenParentheses)
+Boolean QueryParser::acceptAdjacentName(const char* name)
 {
-    const char* currentChar = token.c_str();
-    Integer numOfOpenParentheses = previousNumOfOpenParentheses;
-    Boolean closedBefore = false;
-
-    while (*currentChar != '\0') {
-        if (*currentChar == '(') {
-            if (closedBefore) {
-                return std::make_pair(false, 0);
-            }
+    return lexer.isAdjacentToPrevious() && acceptName(name);
+}
 
-            numOfOpenParentheses++;
-        } else if (*currentChar == ')') {
-            if (numOfOpenParentheses == 0) {
-                return std::make_pair(false, 0);
-            }
+Boolean QueryParser::acceptAdjacentSymbol(char symbol)
+{
+    return lexer.isAdjacentToPrevious() && acceptSymbol(symbol);
+}
 
-            numOfOpenParentheses--;
+Boolean QueryParser::expectSymbol(char symbol)
+{
+    return acceptSymbol(symbol) || reportUnexpectedToken(String(1, symbol));
+}
 
-            if (numOfOpenParentheses == 0) {
-                closedBefore = true;
-            }
-        }
+Boolean QueryParser::reportSyntaxError(ErrorMessage message)
+{
+    syntaxErrorMessage = std::move(message);
+    return false;
+}
 
-        currentChar++;
-    }
+Boolean QueryParser::reportUnexpectedToken(const String& expected)
+{
+    return reportSyntaxError("Expected " + expected + " but found "
+                             + (lexer.isAtEnd() ? String("end of query") : lexer.getText()));
+}
 
-    return std::make_pair(true, numOfOpenParentheses);
-}
\ No newline at end of file
+Void QueryParser::reportSemanticsError(ErrorMessage message)
+{
+    if (!hasSemanticsError) {
+        semanticsErrorMessage = std::move(message);
+        hasSemanticsError = true;
+    }
+}
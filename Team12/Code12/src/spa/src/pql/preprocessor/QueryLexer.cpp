@@ -0,0 +1,97 @@
+/**
+ * Implementation of the lexer for Program Query Language queries.
+ */
+
+#include "QueryLexer.h"
+
+#include "Util.h"
+#include "lexer/Lexer.h"
+
+QueryLexer::QueryLexer(const String& query): query(query), current(), previousEnd(0)
+{
+    readToken(0);
+}
+
+QueryTokenType QueryLexer::getType() const
+{
+    return current.type;
+}
+
+Boolean QueryLexer::isName(const char* name) const
+{
+    return current.type == NameQueryToken && query.compare(current.start, current.length, name) == 0;
+}
+
+Boolean QueryLexer::isSymbol(char symbol) const
+{
+    return current.type == SymbolQueryToken && query[current.start] == symbol;
+}
+
+Boolean QueryLexer::isAtEnd() const
+{
+    return current.type == EndQueryToken;
+}
+
+Boolean QueryLexer::isAdjacentToPrevious() const
+{
+    return current.start == previousEnd;
+}
+
+String QueryLexer::getText() const
+{
+    return query.substr(current.start, current.length);
+}
+
+Void QueryLexer::advance()
+{
+    readToken(current.start + current.length);
+}
+
+Boolean QueryLexer::readQuoted(String& contents)
+{
+    size_t contentsStart = current.start + 1;
+    size_t closingQuote = query.find('"', contentsStart);
+    if (closingQuote == String::npos) {
+        readToken(query.size());
+        return false;
+    }
+    contents.clear();
+    for (size_t position = contentsStart; position < closingQuote; position++) {
+        if (!isWhitespace(&query[position])) {
+            contents.push_back(query[position]);
+        }
+    }
+    readToken(closingQuote + 1);
+    return true;
+}
+
+Void QueryLexer::readToken(size_t position)
+{
+    previousEnd = position;
+    size_t length = query.size();
+    while (position < length && isWhitespace(&query[position])) {
+        position++;
+    }
+    current.start = position;
+    if (position == length) {
+        current.type = EndQueryToken;
+        current.length = 0;
+        return;
+    }
+
+    size_t end = position + 1;
+    if (util::isAsciiLetter(query[position])) {
+        current.type = NameQueryToken;
+        while (end < length && (util::isAsciiLetter(query[end]) || util::isAsciiDigit(query[end]))) {
+            end++;
+        }
+    } else if (util::isAsciiDigit(query[position])) {
+        current.type = IntegerQueryToken;
+        while (end < length && util::isAsciiDigit(query[end])) {
+            end++;
+        }
+    } else {
+        current.type = SymbolQueryToken;
+    }
+    current.length = end - position;
+}
@@ -0,0 +1,89 @@
+/**
+ * Lexer for Program Query Language queries, which reads
+ * the tokens of a query one at a time, as they are
+ * needed by the Preprocessor.
+ */
+
+#ifndef SPA_PQL_PREPROCESSOR_QUERY_LEXER_H
+#define SPA_PQL_PREPROCESSOR_QUERY_LEXER_H
+
+#include "Types.h"
+
+// All the types of tokens in a PQL query.
+enum QueryTokenType : char {
+    NameQueryToken,    // a letter, followed by letters or digits
+    IntegerQueryToken, // one or more digits
+    SymbolQueryToken,  // any other character, such as ( or ;
+    EndQueryToken      // the end of the query
+};
+
+/**
+ * A token in a PQL query. The token refers to its
+ * characters in the query, instead of holding a copy.
+ */
+struct QueryToken {
+    QueryTokenType type;
+    size_t start;
+    size_t length;
+};
+
+/**
+ * Splits a PQL query into tokens in a single pass over the
+ * query, skipping the whitespace between them. The lexer is
+ * always at a token, which the parser checks before moving
+ * on to the next token.
+ *
+ * The query must outlive the QueryLexer.
+ */
+class QueryLexer {
+public:
+    // Creates a QueryLexer at the first token of the query.
+    explicit QueryLexer(const String& query);
+
+    // Gets the type of the current token.
+    QueryTokenType getType() const;
+
+    // Checks if the current token is the given name.
+    Boolean isName(const char* name) const;
+
+    // Checks if the current token is the given symbol.
+    Boolean isSymbol(char symbol) const;
+
+    // Checks if every token in the query has been read.
+    Boolean isAtEnd() const;
+
+    // Checks if the current token directly follows the
+    // previous token, without whitespace between them.
+    Boolean isAdjacentToPrevious() const;
+
+    // Gets a copy of the characters of the current token.
+    String getText() const;
+
+    // Moves to the next token in the query.
+    Void advance();
+
+    /**
+     * Reads the characters between the quote at the current
+     * token and the next quote in the query, and moves to the
+     * token after the closing quote. The current token must be
+     * a quote. Whitespace between the quotes is left out, even
+     * between two names, so "x y" is read as xy.
+     *
+     * @param contents String to store the quoted characters in.
+     * @return True, if the quote is closed. False, if there is
+     *         no closing quote, in which case the lexer is moved
+     *         to the end of the query.
+     */
+    Boolean readQuoted(String& contents);
+
+private:
+    const String& query;
+    QueryToken current;
+    // the position just after the previous token
+    size_t previousEnd;
+
+    // Reads the first token at or after position.
+    Void readToken(size_t position);
+};
+
+#endif // SPA_PQL_PREPROCESSOR_QUERY_LEXER_H
@@ -37,61 +37,29 @@ Reference::Reference(ReferenceValue refValue, DesignEntity designEnt, Attribute
 /** Static Methods      */
 /************************/
 
-Reference Reference::createReference(String ref, DeclarationTable& declarationTable)
+Reference Reference::createSynonymReference(const Synonym& synonym, const DeclarationTable& declarationTable)
 {
-    if (ref == "_") {
-        Reference reference(WildcardRefType, ref);
-        return reference;
-    }
-
-    if (util::isPossibleConstant(ref)) {
-        // An Integer as a reference will always be of StmtType
-        Reference reference(IntegerRefType, ref);
-        return reference;
-    }
-
-    if (util::isLiteral(ref)) {
-        if (!util::isLiteralIdent(ref)) {
-            return Reference(QuerySyntaxError, "Literal is not a valid Identifier: " + ref);
-        }
-        // unquote the string literal
-        Reference reference(LiteralRefType, util::removeCharFromBothEnds(ref));
-        return reference;
-    }
-
-    size_t fullStopPosition = ref.find('.');
-
-    // Synonym with no Attribute
-    if (fullStopPosition == String::npos) {
-        DesignEntity designEnt = declarationTable.getDesignEntityOfSynonym(ref);
-        if (designEnt.getType() == NonExistentType) {
-            return Reference(QuerySemanticsError, "Reference Synonym was not declared: " + ref);
-        }
-
-        Reference reference(SynonymRefType, ref, designEnt);
-        return reference;
+    DesignEntity designEnt = declarationTable.getDesignEntityOfSynonym(synonym);
+    if (designEnt.getType() == NonExistentType) {
+        return Reference(QuerySemanticsError, "Reference Synonym was not declared: " + synonym);
     }
 
-    // Synonym Attribute
-    StringVector splitRefString = splitByDelimiter(ref, ".");
-    if (splitRefString.size() != 2) {
-        return Reference(QuerySyntaxError, "Invalid Attribute Reference syntax: " + ref);
-    }
+    Reference reference(SynonymRefType, synonym, designEnt);
+    return reference;
+}
 
-    Synonym synonym = splitRefString.at(0);
-    String attributeString = splitRefString.at(1);
+Reference Reference::createAttributeReference(const Synonym& synonym, const String& attributeName,
+                                              const DeclarationTable& declarationTable)
+{
     DesignEntity designEnt = declarationTable.getDesignEntityOfSynonym(synonym);
     if (designEnt.getType() == NonExistentType) {
-        return Reference(QuerySemanticsError, "Reference Synonym was not declared: " + ref);
-    }
-
-    Attribute attribute(attributeString);
-    if (attribute.getType() == InvalidAttributeType) {
-        return Reference(QuerySyntaxError, "Invalid Attribute: " + attributeString);
+        return Reference(QuerySemanticsError, "Reference Synonym was not declared: " + synonym + "." + attributeName);
     }
 
+    Attribute attribute(attributeName);
     if (!Attribute::validateDesignEntityAttributeSemantics(designEnt.getType(), attribute.getType())) {
-        return Reference(QuerySemanticsError, "Attribute type does not match Design Entity: " + ref);
+        return Reference(QuerySemanticsError,
+                         "Attribute type does not match Design Entity: " + synonym + "." + attributeName);
     }
 
     Reference reference(synonym, designEnt, attribute);
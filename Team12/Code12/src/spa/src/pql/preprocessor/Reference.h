@@ -35,18 +35,32 @@ protected:
 
 public:
     /**
-     * Creates a Reference using the given ref String. It will
-     * determine the ReferenceType based on the ref given.
-     * If the ref is a synonym, the design entity of the synonym
-     * will be stored in the Reference object.
+     * Creates a Reference to a synonym. If the synonym has
+     * not been declared, a semantically invalid Reference
+     * will be returned.
      *
-     * If the ref is an invalid form of a Reference, an invalid
-     * Reference will be returned.
+     * @param synonym           Synonym that is referred to.
+     * @param declarationTable  DeclarationTable to find the
+     *                          DesignEntity of the synonym.
+     * @return                  A Reference of SynonymRefType.
+     */
+    static Reference createSynonymReference(const Synonym& synonym, const DeclarationTable& declarationTable);
+
+    /**
+     * Creates a Reference to an attribute of a synonym, such
+     * as s.stmt#. If the synonym has not been declared, or
+     * its DesignEntity does not have the attribute, a
+     * semantically invalid Reference will be returned.
      *
-     * @param ref   String of the reference to be constructed.
-     * @return      A Reference based on ref.
+     * @param synonym           Synonym that the attribute belongs to.
+     * @param attributeName     Name of the attribute, which must be
+     *                          one of the names of Attributes.
+     * @param declarationTable  DeclarationTable to find the
+     *                          DesignEntity of the synonym.
+     * @return                  A Reference of AttributeRefType.
      */
-    static Reference createReference(String ref, DeclarationTable& declarationTable);
+    static Reference createAttributeReference(const Synonym& synonym, const String& attributeName,
+                                              const DeclarationTable& declarationTable);
 
     Reference();
 
@@ -8,8 +8,8 @@
 #include <utility>
 
 template <typename T>
-Boolean isValidInTable(std::unordered_map<RelationshipType, std::unordered_set<T>> table, RelationshipType relRefType,
-                       T type);
+Boolean isValidInTable(const std::unordered_map<RelationshipType, std::unordered_set<T>>& table,
+                       RelationshipType relRefType, T type);
 
 std::unordered_map<String, RelationshipType> Relationship::relationshipTypeMap{{"Follows", FollowsType},
                                                                                {"Follows*", FollowsStarType},
@@ -274,10 +274,10 @@ Void Relationship::setRightRef(Reference newRef)
 }
 
 template <typename T>
-Boolean isValidInTable(std::unordered_map<RelationshipType, std::unordered_set<T>> table, RelationshipType relRefType,
-                       T type)
+Boolean isValidInTable(const std::unordered_map<RelationshipType, std::unordered_set<T>>& table,
+                       RelationshipType relRefType, T type)
 {
-    auto validationSet = table.find(relRefType)->second;
+    const std::unordered_set<T>& validationSet = table.find(relRefType)->second;
     Boolean isValid = validationSet.find(type) != validationSet.end();
 
     return isValid;
@@ -15,33 +15,15 @@ SuchThatClause::SuchThatClause(Relationship& r): Clause(SuchThatClauseType), rel
 /** Static Methods      */
 /************************/
 
-Clause* SuchThatClause::createSuchThatClause(const String& clauseConstraint, DeclarationTable& declarationTable)
+Clause* SuchThatClause::createSuchThatClause(RelationshipType relRefType, Reference leftRef, Reference rightRef)
 {
-    StringPair pair = util::splitByFirstDelimiter(clauseConstraint, '(');
-
-    String relRef = pair.first;
-
-    RelationshipType relRefType = Relationship::getRelRefType(relRef);
-    if (relRefType == InvalidRelationshipType) {
-        return new Clause(SuchThatClauseType, QuerySyntaxError, "Invalid Relationship type " + relRef);
-    }
-
-    String references
-        = pair.second.substr(0, pair.second.size() - 1); // remove the last char which is a close parentheses
-    StringPair refPair = util::splitByFirstDelimiter(references, ',');
-    String leftRefString = refPair.first;
-    String rightRefString = refPair.second;
-
-    Reference leftReference = Reference::createReference(leftRefString, declarationTable);
-    Reference rightReference = Reference::createReference(rightRefString, declarationTable);
-
-    if (leftReference.isInvalid()) {
-        return new Clause(SuchThatClauseType, leftReference.getErrorType(), leftReference.getErrorMessage());
-    } else if (rightReference.isInvalid()) {
-        return new Clause(SuchThatClauseType, rightReference.getErrorType(), rightReference.getErrorMessage());
+    if (leftRef.isInvalid()) {
+        return new Clause(SuchThatClauseType, leftRef.getErrorType(), leftRef.getErrorMessage());
+    } else if (rightRef.isInvalid()) {
+        return new Clause(SuchThatClauseType, rightRef.getErrorType(), rightRef.getErrorMessage());
     }
 
-    Relationship relationship = Relationship::createRelationship(relRefType, leftReference, rightReference);
+    Relationship relationship = Relationship::createRelationship(relRefType, leftRef, rightRef);
     if (relationship.isInvalid()) {
         return new Clause(SuchThatClauseType, relationship.getErrorType(), relationship.getErrorMessage());
     }
@@ -14,16 +14,17 @@ private:
 
 public:
     /**
-     * Processes the clause constraint string for a
-     * SuchThatClause, by abstracting it into its relevant
-     * Relationship and References.
+     * Creates a SuchThatClause of a Relationship between
+     * the given References, validating the References and
+     * the semantics of the Relationship.
      *
-     * @param clauseConstraint  String of the clause constraint with all
-     *                          whitespaces removed.
-     * @return                  Clause* of the SuchThatClause
-     *                          that was constructed.
+     * @param relRefType    Type of the Relationship.
+     * @param leftRef       Left Reference of the Relationship.
+     * @param rightRef      Right Reference of the Relationship.
+     * @return              Clause* of the SuchThatClause that was
+     *                      constructed, or an erroneous Clause*.
      */
-    static Clause* createSuchThatClause(const String& clauseConstraint, DeclarationTable& declarationTable);
+    static Clause* createSuchThatClause(RelationshipType relRefType, Reference leftRef, Reference rightRef);
 
     // Instantiates a SuchThatClause with the given Relationship.
     explicit SuchThatClause(Relationship& r);
@@ -19,16 +19,8 @@ WithClause::WithClause(Reference& leftRef, Reference& rightRef):
 /** Static Methods      */
 /************************/
 
-Clause* WithClause::createWithClause(const String& clauseConstraint, DeclarationTable& declarationTable)
+Clause* WithClause::createWithClause(Reference leftRef, Reference rightRef)
 {
-    StringVector splitStringVector = splitByDelimiter(clauseConstraint, "=");
-    if (splitStringVector.size() != 2) {
-        return new Clause(WithClauseType, QuerySyntaxError, "Invalid syntax in WithClause " + clauseConstraint);
-    }
-
-    Reference leftRef = Reference::createReference(splitStringVector.at(0), declarationTable);
-    Reference rightRef = Reference::createReference(splitStringVector.at(1), declarationTable);
-
     if (leftRef.isInvalid()) {
         return new Clause(SuchThatClauseType, leftRef.getErrorType(), leftRef.getErrorMessage());
     } else if (rightRef.isInvalid()) {
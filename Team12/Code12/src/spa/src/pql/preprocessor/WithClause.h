@@ -15,16 +15,16 @@ private:
 
 public:
     /**
-     * Processes the clause constraint string for a
-     * WithClause, by abstracting it into its relevant
-     * References.
+     * Creates a WithClause that compares the given
+     * References, validating the References and that
+     * their values are of the same type.
      *
-     * @param clauseConstraint  String of the clause constraint with all
-     *                          whitespaces removed.
-     * @return                  Clause* of the WithClause that was
-     *                          constructed.
+     * @param leftRef   Left Reference of the comparison.
+     * @param rightRef  Right Reference of the comparison.
+     * @return          Clause* of the WithClause that was
+     *                  constructed, or an erroneous Clause*.
      */
-    static Clause* createWithClause(const String& clauseConstraint, DeclarationTable& declarationTable);
+    static Clause* createWithClause(Reference leftRef, Reference rightRef);
 
     // Instantiates a WithClause with the given left and right References.
     WithClause(Reference& leftRef, Reference& rightRef);
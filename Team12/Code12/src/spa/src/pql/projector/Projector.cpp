@@ -6,6 +6,33 @@
 
 #include "Types.h"
 
+/*
+ * Moves the raw query results into a sink, one result at a
+ * time, and posts any error in the query to the UI. The
+ * results have all been produced by the evaluator already.
+ *
+ * Recall that the RawResultFromClauses, already merge adjacent
+ * similar results from clauses (with respect to a given synonym)
+ * (please read up the documentation for the RawResultFromClauses
+ * class, for more details). Hence, we don't have to do anything
+ * here to the results, other than pass them on.
+ *
+ * @param rawQueryResult The raw query result as returned by the
+ * evaluator, which is left without any results.
+ * @param sink The consumer of the results.
+ * @param ui The UI to post errors to.
+ */
+Void Projector::projectResults(RawQueryResult& rawQueryResult, ResultSink& sink, Ui& ui)
+{
+    if (rawQueryResult.hasError) {
+        ui.postUiError(rawQueryResult.errorMessage);
+    }
+    for (String& result : rawQueryResult.takeResults()) {
+        sink.addResult(std::move(result));
+    }
+    sink.finish();
+}
+
 /*
  * Formats the raw query results into a format suitable and conforming to
  * the autotester.
@@ -18,60 +45,14 @@
  */
 FormattedQueryResult Projector::formatAutotester(RawQueryResult rawQueryResult, Ui& ui)
 {
-    String formattedResults;
-    if (rawQueryResult.hasError) {
-        ui.postUiError(rawQueryResult.errorMessage);
-    }
-    if (rawQueryResult.isEmpty()) {
-        return FormattedQueryResult::emptyFormattedQueryResult();
-    }
-
-    Integer len = rawQueryResult.count();
-
-    for (int i = 0; i < len - 1; ++i) {
-        String result = rawQueryResult.get(i);
-
-        /*
-         * Recall that the RawResultFromClauses, already
-         * merge adjacent similar results from clauses
-         * (with respect to a given synonym) (please
-         * read up the documentation for the RawResultFromClauses
-         * class, for more details).
-         *
-         * Hence, we don't have to do anything here to
-         * RawResultFromClauses.
-         */
-        formattedResults.append(result).append(CommaStr);
-    }
-    formattedResults.append(rawQueryResult.get(len - 1) /* remove trailing comma */);
-    return FormattedQueryResult(formattedResults);
+    FormattedResultSink sink(AutotesterFormat);
+    projectResults(rawQueryResult, sink, ui);
+    return sink.getFormattedQueryResult();
 }
 
 FormattedQueryResult Projector::formatUI(RawQueryResult rawQueryResult, Ui& ui)
 {
-    if (rawQueryResult.hasError) {
-        ui.postUiError(rawQueryResult.errorMessage);
-    }
-    if (rawQueryResult.isEmpty()) {
-        return FormattedQueryResult::emptyFormattedQueryResult();
-    }
-    Integer len = rawQueryResult.count();
-    String formattedResults;
-    rawQueryResult.sort();
-    for (int i = 0; i < len - 1; ++i) {
-        String result = rawQueryResult.get(i);
-        /*
-         * Recall that the RawResultFromClauses, already
-         * merge adjacent similar results from clauses
-         * (with respect to a given synonym) (please
-         * read up the documentation for the RawResultFromClauses
-         * class, for more details).
-         *
-         * Hence, we don't have to do anything here to
-         * RawResultFromClauses.
-         */
-        formattedResults.append(result).append(CommaStr);
-    }
-    formattedResults.append(rawQueryResult.get(len - 1) /* remove trailing comma */);
-    return FormattedQueryResult(formattedResults);
+    FormattedResultSink sink(UiFormat);
+    projectResults(rawQueryResult, sink, ui);
+    return sink.getFormattedQueryResult();
 }
@@ -8,16 +8,14 @@
 
 #include "FormattedQueryResult.h"
 #include "RawQueryResult.h"
+#include "ResultSink.h"
 #include "Ui.h"
 
 class Projector {
 public:
+    Void projectResults(RawQueryResult& rawQueryResult, ResultSink& sink, Ui& ui);
     FormattedQueryResult formatAutotester(RawQueryResult rawQueryResult, Ui& ui);
     FormattedQueryResult formatUI(RawQueryResult rawQueryResult, Ui& ui);
-
-private:
-    const String CommaStr = ", ";
-    const String PipeStr = "|";
 };
 
 #endif // SPA_PQL_PROJECTOR_H
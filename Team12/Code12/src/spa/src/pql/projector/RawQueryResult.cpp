@@ -122,6 +122,19 @@ size_t RawQueryResult::count()
     return results.size();
 }
 
+/*
+ * Moves the results out of this RawQueryResult,
+ * leaving it without any results.
+ *
+ * @return The results.
+ */
+Vector<String> RawQueryResult::takeResults()
+{
+    Vector<String> takenResults;
+    takenResults.swap(results);
+    return takenResults;
+}
+
 /*
  * Determines when 2 RawQueryResult objects are equal.
  * This method overloads equality operator and defines
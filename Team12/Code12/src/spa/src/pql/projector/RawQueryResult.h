@@ -35,6 +35,7 @@ public:
     String get(Integer index);
     size_t count();
     void sort();
+    Vector<String> takeResults();
 
 private:
     explicit RawQueryResult(String errorMessage, Boolean isSyntaxError);
@@ -0,0 +1,77 @@
+/**
+ * Implementation of the consumers of PQL query results.
+ */
+
+#include "ResultSink.h"
+
+#include "RawQueryResult.h"
+
+Void ResultSink::finish() {}
+
+FormattedResultSink::FormattedResultSink(QueryResultFormatType format): format(format) {}
+
+/*
+ * Adds a result to the formatted results. Results for the
+ * autotester are joined as they arrive, while results for
+ * the UI are kept until the end, to be sorted.
+ *
+ * @param result The next result of the query.
+ */
+Void FormattedResultSink::addResult(String result)
+{
+    if (format == UiFormat) {
+        unsortedResults.push_back(std::move(result));
+        return;
+    }
+    appendResult(result);
+}
+
+Void FormattedResultSink::finish()
+{
+    if (unsortedResults.empty()) {
+        return;
+    }
+    RawQueryResult sortedResults(std::move(unsortedResults));
+    unsortedResults.clear();
+    sortedResults.sort();
+    size_t len = sortedResults.count();
+    for (size_t i = 0; i < len; ++i) {
+        appendResult(sortedResults.get(i));
+    }
+}
+
+Void FormattedResultSink::appendResult(const String& result)
+{
+    if (resultCount > 0) {
+        formattedResults.append(CommaStr);
+    }
+    formattedResults.append(result);
+    resultCount++;
+}
+
+FormattedQueryResult FormattedResultSink::getFormattedQueryResult() const
+{
+    if (resultCount == 0) {
+        return FormattedQueryResult::emptyFormattedQueryResult();
+    }
+    return FormattedQueryResult(formattedResults);
+}
+
+ListResultSink::ListResultSink(std::list<String>& results): results(results) {}
+
+Void ListResultSink::addResult(String result)
+{
+    results.push_back(std::move(result));
+}
+
+StreamResultSink::StreamResultSink(std::ostream& stream): stream(stream) {}
+
+Void StreamResultSink::addResult(String result)
+{
+    stream << result << '\n';
+}
+
+Void StreamResultSink::finish()
+{
+    stream.flush();
+}
@@ -0,0 +1,88 @@
+/**
+ * Consumers of the projected results of a PQL query. Once the
+ * evaluator has produced all of the results, the projector
+ * moves every result (a single value, a tuple of values
+ * separated by spaces, or a BOOLEAN) into a ResultSink, so
+ * the caller decides how the results are stored or displayed,
+ * without formatting the results into one String only to
+ * split that String up again.
+ */
+
+#ifndef SPA_PQL_RESULT_SINK_H
+#define SPA_PQL_RESULT_SINK_H
+
+#include <list>
+#include <ostream>
+
+#include "FormattedQueryResult.h"
+#include "QueryResultFormatType.h"
+#include "Types.h"
+
+class ResultSink {
+public:
+    ResultSink() = default;
+    virtual ~ResultSink() = default;
+    ResultSink(const ResultSink&) = delete;
+    ResultSink& operator=(const ResultSink&) = delete;
+    ResultSink(ResultSink&&) = delete;
+    ResultSink& operator=(ResultSink&&) = delete;
+
+    // Receives the next result of the query.
+    virtual Void addResult(String result) = 0;
+    // Called once all results of the query have been added.
+    virtual Void finish();
+};
+
+/**
+ * Joins the results into a FormattedQueryResult, separated
+ * by commas. Results for the UI are sorted first.
+ */
+class FormattedResultSink: public ResultSink {
+public:
+    explicit FormattedResultSink(QueryResultFormatType format);
+
+    Void addResult(String result) override;
+    Void finish() override;
+    FormattedQueryResult getFormattedQueryResult() const;
+
+private:
+    const String CommaStr = ", ";
+    QueryResultFormatType format;
+    // results waiting to be sorted, for the UI format
+    Vector<String> unsortedResults;
+    String formattedResults;
+    size_t resultCount = 0;
+
+    Void appendResult(const String& result);
+};
+
+/**
+ * Appends the results to a list, such as the list of
+ * results given by the autotester.
+ */
+class ListResultSink: public ResultSink {
+public:
+    explicit ListResultSink(std::list<String>& results);
+
+    Void addResult(String result) override;
+
+private:
+    std::list<String>& results;
+};
+
+/**
+ * Writes the results to an output stream (e.g. stdout or
+ * a file), one result on each line.
+ */
+class StreamResultSink: public ResultSink {
+public:
+    explicit StreamResultSink(std::ostream& stream);
+
+    Void addResult(String result) override;
+    Void finish() override;
+
+private:
+    std::ostream& stream;
+};
+
+#endif // SPA_PQL_RESULT_SINK_H
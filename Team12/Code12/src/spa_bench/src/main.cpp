@@ -0,0 +1,261 @@
+/**
+ * Benchmark driver for the SPA. Runs a SIMPLE source file and
+ * its autotester-style query file through the frontend and PQL
+ * components, timing every phase and every query, and prints
+ * the measurements as a single JSON document on stdout.
+ *
+ * The JSON is consumed by scripts/benchmark-regression.py, which
+ * records it as a baseline and compares later runs against it.
+ */
+
+#include <Types.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <new>
+#include <sstream>
+
+#include "frontend/SourceFile.h"
+#include "frontend/designExtractor/DesignExtractor.h"
+#include "frontend/parser/Parser.h"
+#include "pkb/PKB.h"
+#include "pql/PqlManager.h"
+#include "pql/preprocessor/Preprocessor.h"
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+typedef std::chrono::steady_clock BenchClock;
+
+// number of heap allocations made by the process so far
+static std::atomic<unsigned long> allocationCount(0);
+
+/*
+ * Replaces the global allocation functions to count every
+ * allocation made, including those by the standard library.
+ * The array, nothrow and sized forms all call these.
+ */
+void* operator new(std::size_t size)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    void* memory = std::malloc(size == 0 ? 1 : size);
+    if (memory == nullptr) {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+class BenchUi: public Ui {
+public:
+    Integer errorCount = 0;
+    Void postUiError(InputError /* unused */) override
+    {
+        errorCount++;
+    }
+};
+
+struct BenchQuery {
+    String id;
+    String text;
+};
+
+/*
+ * Returns the time elapsed since start, in milliseconds.
+ */
+double millisecondsSince(BenchClock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(BenchClock::now() - start).count();
+}
+
+/*
+ * Returns the peak resident set size of this process in
+ * kilobytes, or 0 if the platform does not report it.
+ */
+long getPeakRssKilobytes()
+{
+#ifndef _WIN32
+    struct rusage usage {};
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#ifdef __APPLE__
+        // macOS reports ru_maxrss in bytes
+        return usage.ru_maxrss / 1024;
+#else
+        return usage.ru_maxrss;
+#endif
+    }
+#endif
+    return 0;
+}
+
+/*
+ * Escapes a String so that it can be embedded in a JSON string literal.
+ */
+String escapeJson(const String& str)
+{
+    std::ostringstream escaped;
+    for (char c : str) {
+        switch (c) {
+        case '"':
+            escaped << "\\\"";
+            break;
+        case '\\':
+            escaped << "\\\\";
+            break;
+        case '\n':
+            escaped << "\\n";
+            break;
+        case '\t':
+            escaped << "\\t";
+            break;
+        default:
+            escaped << c;
+        }
+    }
+    return escaped.str();
+}
+
+Boolean readFile(const String& path, String& contents)
+{
+    std::ifstream file(path);
+    if (!file) {
+        return false;
+    }
+    contents = String(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
+}
+
+/*
+ * Splits an autotester query file into queries. Each query
+ * spans five lines: the comment (with the query id before
+ * the first space), the declarations, the Select clause,
+ * the expected answer and the time limit.
+ */
+Vector<BenchQuery> readQueries(const String& contents)
+{
+    const size_t LinesPerQuery = 5;
+    Vector<String> lines;
+    std::istringstream stream(contents);
+    String line;
+    while (std::getline(stream, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        lines.push_back(line);
+    }
+    Vector<BenchQuery> queries;
+    for (size_t i = 0; i + 2 < lines.size(); i += LinesPerQuery) {
+        String id = lines[i].substr(0, lines[i].find(' '));
+        queries.push_back(BenchQuery{id, lines[i + 1] + " " + lines[i + 2]});
+    }
+    return queries;
+}
+
+template <typename T>
+Void printSamples(const Vector<T>& samples)
+{
+    std::cout << "[";
+    for (size_t i = 0; i < samples.size(); i++) {
+        std::cout << (i == 0 ? "" : ", ") << samples[i];
+    }
+    std::cout << "]";
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 3) {
+        std::cerr << "Usage: spa_bench <source file> <query file> [repetitions] [optimise (0|1)]" << std::endl;
+        return EXIT_FAILURE;
+    }
+    const String sourcePath = argv[1];
+    const String queryPath = argv[2];
+    const Integer repetitions = argc > 3 ? std::max(1, std::atoi(argv[3])) : 5;
+    const Boolean optimise = argc > 4 ? std::atoi(argv[4]) != 0 : true;
+
+    SourceFile program(sourcePath);
+    String queryFile;
+    if (!program.isOpen() || !readFile(queryPath, queryFile)) {
+        std::cerr << "spa_bench: unable to read " << sourcePath << " or " << queryPath << std::endl;
+        return EXIT_FAILURE;
+    }
+    Vector<BenchQuery> queries = readQueries(queryFile);
+
+    Vector<double> parseSamples;
+    Vector<double> extractSamples;
+    Vector<double> preprocessSamples;
+    Vector<Vector<double>> querySamples(queries.size());
+    Vector<Vector<unsigned long>> queryAllocations(queries.size());
+    BenchUi ui;
+
+    for (Integer run = 0; run < repetitions; run++) {
+        resetPKB();
+
+        BenchClock::time_point start = BenchClock::now();
+        ParserReturnType<ProgramNode*> parsedProgram = parseSimpleReturnNode(program.data(), program.size());
+        parseSamples.push_back(millisecondsSince(start));
+        if (parsedProgram.hasError()) {
+            std::cerr << "spa_bench: syntax error in " << sourcePath << ": " << parsedProgram.getErrorString()
+                      << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        start = BenchClock::now();
+        Boolean extracted = extractDesign(*parsedProgram.astNode);
+        extractSamples.push_back(millisecondsSince(start));
+        if (!extracted) {
+            std::cerr << "spa_bench: semantic error in " << sourcePath << std::endl;
+            return EXIT_FAILURE;
+        }
+        assignRootNode(parsedProgram.astNode);
+
+        // the query cache hides the Preprocessor from the query samples, so it is timed on its own
+        start = BenchClock::now();
+        for (const BenchQuery& query : queries) {
+            Preprocessor::processQuery(query.text);
+        }
+        preprocessSamples.push_back(millisecondsSince(start));
+
+        for (size_t i = 0; i < queries.size(); i++) {
+            // collect the results the same way as the autotester
+            std::list<String> results;
+            ListResultSink sink(results);
+            unsigned long allocationsBefore = allocationCount.load();
+            start = BenchClock::now();
+            PqlManager::executeQuery(queries[i].text, sink, ui, optimise);
+            querySamples[i].push_back(millisecondsSince(start));
+            queryAllocations[i].push_back(allocationCount.load() - allocationsBefore);
+        }
+    }
+
+    std::cout << "{\n  \"source\": \"" << escapeJson(sourcePath) << "\",\n  \"queries_file\": \""
+              << escapeJson(queryPath) << "\",\n  \"repetitions\": " << repetitions
+              << ",\n  \"optimise\": " << (optimise ? "true" : "false") << ",\n  \"peak_rss_kb\": "
+              << getPeakRssKilobytes() << ",\n  \"query_cache\": {\"hits\": " << PqlManager::getQueryCache().getHits()
+              << ", \"misses\": " << PqlManager::getQueryCache().getMisses()
+              << "},\n  \"phases\": {\n    \"parse\": ";
+    printSamples(parseSamples);
+    std::cout << ",\n    \"extract\": ";
+    printSamples(extractSamples);
+    std::cout << ",\n    \"preprocess\": ";
+    printSamples(preprocessSamples);
+    std::cout << "\n  },\n  \"queries\": [";
+    for (size_t i = 0; i < queries.size(); i++) {
+        std::cout << (i == 0 ? "\n" : ",\n") << "    {\"id\": \"" << escapeJson(queries[i].id) << "\", \"samples\": ";
+        printSamples(querySamples[i]);
+        std::cout << ", \"allocations\": ";
+        printSamples(queryAllocations[i]);
+        std::cout << "}";
+    }
+    std::cout << "\n  ]\n}" << std::endl;
+    return EXIT_SUCCESS;
+}
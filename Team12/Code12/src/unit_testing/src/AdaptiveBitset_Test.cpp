@@ -0,0 +1,59 @@
+/**
+ * Unit tests for the AdaptiveBitset of small non-negative integers.
+ */
+
+#include "AdaptiveBitset.h"
+#include "catch.hpp"
+
+TEST_CASE("Uncompressed AdaptiveBitset stores integers as bits")
+{
+    AdaptiveBitset bits(100, false);
+    REQUIRE_FALSE(bits.isCompressed());
+    REQUIRE_FALSE(bits.any());
+    bits.set(99);
+    bits.set(3);
+    REQUIRE(bits.test(3));
+    REQUIRE_FALSE(bits.test(4));
+    REQUIRE(bits.toVector() == Vector<Integer>{3, 99});
+}
+
+TEST_CASE("Compressed AdaptiveBitset lists integers until the list outgrows the bits")
+{
+    AdaptiveBitset bits(256, true);
+    REQUIRE(bits.isCompressed());
+    bits.set(200);
+    bits.set(7);
+    bits.set(200);
+    REQUIRE(bits.isCompressed());
+    REQUIRE(bits.count() == 2);
+    REQUIRE(bits.test(200));
+    REQUIRE(bits.toVector() == Vector<Integer>{7, 200});
+
+    // 4 integers listed take as much memory as 256 bits
+    bits.set(1);
+    bits.set(2);
+    REQUIRE_FALSE(bits.isCompressed());
+    REQUIRE(bits.toVector() == Vector<Integer>{1, 2, 7, 200});
+}
+
+TEST_CASE("AdaptiveBitset unions combine compressed and uncompressed sets")
+{
+    AdaptiveBitset first(5000, true);
+    first.set(10);
+    first.set(4000);
+    AdaptiveBitset second(5000, true);
+    second.set(10);
+    second.set(20);
+    first |= second;
+    REQUIRE(first.isCompressed());
+    REQUIRE(first.toVector() == Vector<Integer>{10, 20, 4000});
+
+    AdaptiveBitset dense(5000, false);
+    dense.set(30);
+    first |= dense;
+    REQUIRE_FALSE(first.isCompressed());
+    REQUIRE(first.toVector() == Vector<Integer>{10, 20, 30, 4000});
+
+    dense |= second;
+    REQUIRE(dense.toVector() == Vector<Integer>{10, 20, 30});
+}
@@ -0,0 +1,112 @@
+/**
+ * Unit tests for the arena allocator of AST and CFG nodes.
+ */
+
+#include "ast/AstArena.h"
+#include "ast/AstLibrary.h"
+#include "ast_utils/AstUtils.h"
+#include "catch.hpp"
+#include "frontend/designExtractor/DesignExtractor.h"
+#include "frontend/parser/Parser.h"
+#include "pkb/PKB.h"
+
+TEST_CASE("Nodes are allocated in the active arena")
+{
+    AstArena arena;
+    StatementNode* inArena;
+    {
+        AstArena::Scope arenaScope(&arena);
+        inArena = createReadNode(1, Variable("x"));
+    }
+    StatementNode* onHeap = createReadNode(1, Variable("x"));
+    REQUIRE(ArenaAllocated::getOwningArena(inArena) == &arena);
+    REQUIRE(ArenaAllocated::getOwningArena(onHeap) == nullptr);
+    REQUIRE(*inArena == *onHeap);
+    REQUIRE(arena.countBlocks() == 1);
+    REQUIRE(arena.getBytesAllocated() > 0);
+    // deleting nodes from either source is safe
+    delete inArena;
+    delete onHeap;
+}
+
+TEST_CASE("Arena scopes can be nested")
+{
+    AstArena outerArena;
+    AstArena innerArena;
+    AstArena::Scope outerScope(&outerArena);
+    {
+        AstArena::Scope innerScope(&innerArena);
+        REQUIRE(AstArena::getActiveArena() == &innerArena);
+        {
+            AstArena::Scope heapScope(nullptr);
+            REQUIRE(AstArena::getActiveArena() == nullptr);
+        }
+        REQUIRE(AstArena::getActiveArena() == &innerArena);
+    }
+    REQUIRE(AstArena::getActiveArena() == &outerArena);
+}
+
+TEST_CASE("Arena interns names of variables, calls and procedures")
+{
+    AstArena arena;
+    AstArena::Scope arenaScope(&arena);
+    Variable first("count");
+    Variable second(String("count"));
+    auto* call = createCallNode(2, "count");
+    REQUIRE(&first.varName == &second.varName);
+    REQUIRE(&call->procedureName == &first.varName);
+    REQUIRE(arena.countInternedNames() == 1);
+    delete call;
+}
+
+TEST_CASE("Nodes outside of an arena own their names")
+{
+    auto* first = new Variable("count");
+    Variable second("count");
+    REQUIRE(&first->varName != &second.varName);
+    // a copy keeps its name after the original is deleted
+    Variable copy(*first);
+    delete first;
+    REQUIRE(copy.varName == "count");
+    Variable moved(std::move(copy));
+    REQUIRE(moved.varName == "count");
+    REQUIRE(moved == second);
+}
+
+TEST_CASE("Arena grows by blocks for large allocations")
+{
+    AstArena arena;
+    void* small = arena.allocate(3);
+    void* large = arena.allocate(4 * 1024 * 1024);
+    void* afterLarge = arena.allocate(8);
+    REQUIRE(small != large);
+    REQUIRE(reinterpret_cast<uintptr_t>(afterLarge) % ArenaAllocated::Alignment == 0); // NOLINT
+    REQUIRE(arena.countBlocks() == 3);
+}
+
+TEST_CASE("Parsed programs own an arena holding their AST and CFG")
+{
+    resetPKB();
+    ParserReturnType<ProgramNode*> parsed = parseSimpleReturnNode(getProgram20String_multipleProceduresSpheresdf());
+    REQUIRE_FALSE(parsed.hasError());
+    ProgramNode* program = parsed.astNode;
+    AstArena* arena = program->getArena();
+    REQUIRE(arena != nullptr);
+    REQUIRE(ArenaAllocated::getOwningArena(program->procedureList.at(0).get()) == arena);
+    // the trees of a program fit in a few blocks
+    REQUIRE(arena->countBlocks() <= 2);
+    REQUIRE(*program == *getProgram20Tree_multipleProceduresSpheresdf());
+
+    REQUIRE(extractDesign(*program));
+    CfgNode* cfg = getCFG(program->procedureList.at(0)->procedureName);
+    // CFGs are built on several threads, in child arenas owned by the arena of the program
+    AstArena* cfgArena = ArenaAllocated::getOwningArena(cfg);
+    REQUIRE(cfgArena != nullptr);
+    REQUIRE(cfgArena->getParentArena() == arena);
+    // nodes created after extraction are no longer placed in the arena
+    REQUIRE(AstArena::getActiveArena() == nullptr);
+
+    // the program, its CFGs and arena are freed together
+    assignRootNode(program);
+    resetPKB();
+}
@@ -0,0 +1,61 @@
+/**
+ * Unit tests for the Bitset of small non-negative integers.
+ */
+
+#include "Bitset.h"
+#include "catch.hpp"
+
+TEST_CASE("Bitset sets and resets integers across words")
+{
+    Bitset bits(130);
+    REQUIRE(bits.size() == 130);
+    REQUIRE_FALSE(bits.any());
+    bits.set(0);
+    bits.set(63);
+    bits.set(64);
+    bits.set(129);
+    REQUIRE(bits.test(63));
+    REQUIRE(bits.test(64));
+    REQUIRE_FALSE(bits.test(65));
+    REQUIRE(bits.count() == 4);
+    bits.reset(63);
+    REQUIRE_FALSE(bits.test(63));
+    REQUIRE(bits.toVector() == Vector<Integer>{0, 64, 129});
+}
+
+TEST_CASE("Bitset finds the next integer in the set")
+{
+    Bitset bits(200);
+    bits.set(5);
+    bits.set(150);
+    REQUIRE(bits.findNext(0) == 5);
+    REQUIRE(bits.findNext(5) == 5);
+    REQUIRE(bits.findNext(6) == 150);
+    REQUIRE(bits.findNext(151) == 200);
+    REQUIRE(bits.findNext(500) == 200);
+    REQUIRE(Bitset().findNext(0) == 0);
+}
+
+TEST_CASE("Bitset combines sets of the same size")
+{
+    Bitset first(70);
+    first.set(1);
+    first.set(68);
+    Bitset second(70);
+    second.set(2);
+    second.set(68);
+    REQUIRE(first.intersects(second));
+
+    Bitset unionOfSets = first;
+    unionOfSets |= second;
+    REQUIRE(unionOfSets.toVector() == Vector<Integer>{1, 2, 68});
+
+    Bitset intersectionOfSets = first;
+    intersectionOfSets &= second;
+    REQUIRE(intersectionOfSets.toVector() == Vector<Integer>{68});
+
+    unionOfSets.subtract(second);
+    REQUIRE(unionOfSets.toVector() == Vector<Integer>{1});
+    REQUIRE_FALSE(unionOfSets.intersects(second));
+    REQUIRE_FALSE(unionOfSets == first);
+}
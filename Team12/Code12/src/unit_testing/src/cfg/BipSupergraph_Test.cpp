@@ -0,0 +1,77 @@
+/**
+ * Tests for the CFG BIP, which links the flat
+ * CFGs of the procedures into a supergraph.
+ */
+
+#include "../ast_utils/AstUtils.h"
+#include "../cfg_utils/CfgUtils.h"
+#include "catch.hpp"
+#include "cfg/BipSupergraph.h"
+
+Vector<StatementNumber> rangeToVector(const StatementRange& range)
+{
+    return Vector<StatementNumber>(range.begin(), range.end());
+}
+
+TEST_CASE("BipSupergraph links procedures with call and return sites - program19, multipleProcedures")
+{
+    const BipSupergraph* cfgBip = getProgramCfgBip(getProgram19Tree_multipleProcedures());
+
+    REQUIRE(cfgBip->countProcedures() == 4);
+    REQUIRE(cfgBip->getLastStatement() == 18);
+    REQUIRE(cfgBip->getProcedureName(cfgBip->getProcedureOf(13)) == "c");
+    REQUIRE(cfgBip->getStatementType(15) == CallStatement);
+    REQUIRE_FALSE(cfgBip->containsStatement(0));
+    REQUIRE_FALSE(cfgBip->containsStatement(19));
+
+    // call edges, to the first statement of the procedure called
+    REQUIRE(cfgBip->getProcedureCfg(cfgBip->getProcedureOf(7)).getCalledProcedure(7) == "d");
+    size_t procedureD = cfgBip->getCalledProcedure(7);
+    REQUIRE(cfgBip->getProcedureName(procedureD) == "d");
+    REQUIRE(cfgBip->getEntryStatement(procedureD) == 16);
+    REQUIRE(rangeToVector(cfgBip->getCallSites(procedureD)) == Vector<StatementNumber>{7, 15});
+    REQUIRE(cfgBip->getCallSites(cfgBip->getProcedureOf(1)).empty());
+
+    // return edges, to the statements after the call statement
+    REQUIRE(rangeToVector(cfgBip->getReturnSites(1)) == Vector<StatementNumber>{2});
+    REQUIRE(rangeToVector(cfgBip->getReturnSites(15)) == Vector<StatementNumber>{11});
+    REQUIRE(cfgBip->getReturnSites(7).empty());
+    REQUIRE(cfgBip->isExitStatement(17));
+    REQUIRE(cfgBip->isExitStatement(11));
+    REQUIRE_FALSE(cfgBip->isExitStatement(16));
+}
+
+TEST_CASE("BipSupergraph finds NextBip for calls, returns and calls ending a procedure - program19")
+{
+    const BipSupergraph* cfgBip = getProgramCfgBip(getProgram19Tree_multipleProcedures());
+
+    REQUIRE(cfgBip->getNextBip(1) == Vector<StatementNumber>{5});
+    REQUIRE(cfgBip->getNextBip(2) == Vector<StatementNumber>{8});
+    REQUIRE(cfgBip->getNextBip(7) == Vector<StatementNumber>{16});
+    REQUIRE(cfgBip->getNextBip(15) == Vector<StatementNumber>{16});
+    REQUIRE(cfgBip->getNextBip(14) == Vector<StatementNumber>{15});
+    REQUIRE(cfgBip->getNextBip(16) == Vector<StatementNumber>{17, 18});
+    // the call 7 ends procedure b, so d returns to the statement after the call of b
+    REQUIRE(cfgBip->getNextBip(17) == Vector<StatementNumber>{2, 11});
+    REQUIRE(cfgBip->getNextBip(18) == Vector<StatementNumber>{2, 11});
+    REQUIRE(cfgBip->getNextBip(11) == Vector<StatementNumber>{3, 12});
+    REQUIRE(cfgBip->getNextBip(4).empty());
+}
+
+TEST_CASE("BipSupergraph finds NextBip* from procedure summaries - program19")
+{
+    const BipSupergraph* cfgBip = getProgramCfgBip(getProgram19Tree_multipleProcedures());
+
+    REQUIRE(cfgBip->findReachableFrom(1).toVector()
+            == Vector<Integer>{2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18});
+    // b returns to the statement after its call, through the call of d ending b
+    REQUIRE(cfgBip->findReachableFrom(6).toVector()
+            == Vector<Integer>{2, 3, 4, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18});
+    // d returns to both of its calls, and to the loop around one of them
+    REQUIRE(cfgBip->findReachableFrom(17).toVector()
+            == Vector<Integer>{2, 3, 4, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18});
+    REQUIRE(cfgBip->findReachableFrom(13).toVector()
+            == Vector<Integer>{3, 4, 11, 12, 13, 14, 15, 16, 17, 18});
+    REQUIRE_FALSE(cfgBip->findReachableFrom(4).any());
+    REQUIRE_FALSE(cfgBip->findReachableFrom(19).any());
+}
@@ -216,3 +216,24 @@ TEST_CASE("CfgBuilder works for program with procedure ending with while stateme
     Boolean isEqual = cfgRootNode->equals(expectedCfg, expectedCfgInfo.second);
     REQUIRE(isEqual == true);
 }
+
+TEST_CASE("CfgBuilder links every node to its parent nodes - program2, factorials")
+{
+    const List<ProcedureNode>* procedureList = &(getProgram2Tree_factorials()->procedureList);
+    const StmtlstNode* const stmtLstNode = procedureList->at(0)->statementListNode;
+    CfgNode* cfgRootNode = buildCfg(stmtLstNode).first;
+
+    REQUIRE(cfgRootNode->parentNodes.empty());
+    size_t numberOfEdges = 0;
+    size_t numberOfReverseEdges = cfgRootNode->parentNodes.size();
+    for (CfgNode* node : cfgRootNode->findAllChildren()) {
+        numberOfEdges += node->childrenNodes->size();
+        numberOfReverseEdges += node->parentNodes.size();
+        for (CfgNode* parent : node->parentNodes) {
+            const Vector<CfgNode*>& siblings = *parent->childrenNodes;
+            REQUIRE(std::find(siblings.begin(), siblings.end(), node) != siblings.end());
+        }
+    }
+    numberOfEdges += cfgRootNode->childrenNodes->size();
+    REQUIRE(numberOfEdges == numberOfReverseEdges);
+}
@@ -0,0 +1,98 @@
+/**
+ * Tests for the flat Control Flow Graph, frozen
+ * from the CFG built by the CFG Builder.
+ */
+
+#include "../ast_utils/AstUtils.h"
+#include "catch.hpp"
+#include "cfg/CfgBuilder.h"
+#include "cfg/FlatCfg.h"
+
+Vector<StatementNumber> toVector(const StatementRange& range)
+{
+    return Vector<StatementNumber>(range.begin(), range.end());
+}
+
+TEST_CASE("FlatCfg stores successors and predecessors of if and else nested in while - program2, factorials")
+{
+    const List<ProcedureNode>* procedureList = &(getProgram2Tree_factorials()->procedureList);
+    Pair<CfgNode*, size_t> cfgInfo = buildCfg(procedureList->at(0)->statementListNode);
+    FlatCfg flatCfg(cfgInfo.first);
+
+    REQUIRE(flatCfg.getFirstStatement() == 1);
+    REQUIRE(flatCfg.getLastStatement() == 9);
+    REQUIRE(flatCfg.countStatements() == 9);
+    REQUIRE_FALSE(flatCfg.containsStatement(10));
+    REQUIRE(flatCfg.getStatementType(4) == WhileStatement);
+    REQUIRE(flatCfg.getStatementType(5) == IfStatement);
+
+    REQUIRE(toVector(flatCfg.getNext(3)) == Vector<StatementNumber>{4});
+    REQUIRE(toVector(flatCfg.getNext(4)) == Vector<StatementNumber>{5, 9});
+    REQUIRE(toVector(flatCfg.getNext(5)) == Vector<StatementNumber>{6, 7});
+    REQUIRE(toVector(flatCfg.getNext(6)) == Vector<StatementNumber>{8});
+    REQUIRE(toVector(flatCfg.getNext(8)) == Vector<StatementNumber>{4});
+    REQUIRE(flatCfg.getNext(9).empty());
+
+    REQUIRE(flatCfg.getPrevious(1).empty());
+    REQUIRE(toVector(flatCfg.getPrevious(4)) == Vector<StatementNumber>{3, 8});
+    REQUIRE(toVector(flatCfg.getPrevious(8)) == Vector<StatementNumber>{6, 7});
+    REQUIRE(toVector(flatCfg.getPrevious(9)) == Vector<StatementNumber>{4});
+}
+
+TEST_CASE("FlatCfg lays out statements by basic block - program2, factorials")
+{
+    const List<ProcedureNode>* procedureList = &(getProgram2Tree_factorials()->procedureList);
+    Pair<CfgNode*, size_t> cfgInfo = buildCfg(procedureList->at(0)->statementListNode);
+    FlatCfg flatCfg(cfgInfo.first);
+
+    // {1, 2, 3}, {4}, {5}, {6}, {7}, {8}, {9}
+    REQUIRE(flatCfg.countBlocks() == 7);
+    REQUIRE(toVector(flatCfg.getBlock(flatCfg.getBlockOf(2))) == Vector<StatementNumber>{1, 2, 3});
+    REQUIRE(toVector(flatCfg.getBlock(flatCfg.getBlockOf(4))) == Vector<StatementNumber>{4});
+    REQUIRE(flatCfg.getBlockOf(1) == flatCfg.getBlockOf(3));
+    REQUIRE(flatCfg.getBlockOf(6) != flatCfg.getBlockOf(7));
+}
+
+TEST_CASE("FlatCfg finds statements reachable through Next* - program2, factorials")
+{
+    const List<ProcedureNode>* procedureList = &(getProgram2Tree_factorials()->procedureList);
+    Pair<CfgNode*, size_t> cfgInfo = buildCfg(procedureList->at(0)->statementListNode);
+    FlatCfg flatCfg(cfgInfo.first);
+
+    Vector<StatementNumber> reachableFromIf = flatCfg.findReachableFrom(6);
+    std::sort(reachableFromIf.begin(), reachableFromIf.end());
+    REQUIRE(reachableFromIf == Vector<StatementNumber>{4, 5, 6, 7, 8, 9});
+
+    Vector<StatementNumber> reachableFromLast = flatCfg.findReachableFrom(9);
+    REQUIRE(reachableFromLast.empty());
+}
+
+TEST_CASE("FlatCfg finds statements reaching a statement through Next*, from the exit statements - program2")
+{
+    const List<ProcedureNode>* procedureList = &(getProgram2Tree_factorials()->procedureList);
+    Pair<CfgNode*, size_t> cfgInfo = buildCfg(procedureList->at(0)->statementListNode);
+    FlatCfg flatCfg(cfgInfo.first);
+
+    REQUIRE(toVector(flatCfg.getExitStatements()) == Vector<StatementNumber>{9});
+
+    Vector<StatementNumber> reachingExit = flatCfg.findReachableTo(9);
+    std::sort(reachingExit.begin(), reachingExit.end());
+    REQUIRE(reachingExit == Vector<StatementNumber>{1, 2, 3, 4, 5, 6, 7, 8});
+
+    Vector<StatementNumber> reachingWhile = flatCfg.findReachableTo(4);
+    std::sort(reachingWhile.begin(), reachingWhile.end());
+    REQUIRE(reachingWhile == Vector<StatementNumber>{1, 2, 3, 4, 5, 6, 7, 8});
+
+    REQUIRE(flatCfg.findReachableTo(1).empty());
+}
+
+TEST_CASE("FlatCfg finds every exit statement of a procedure ending with nested if statements - ifInIf")
+{
+    const List<ProcedureNode>* procedureList = &(getProgram27Tree_ifInIf()->procedureList);
+    Pair<CfgNode*, size_t> cfgInfo = buildCfg(procedureList->at(0)->statementListNode);
+    FlatCfg flatCfg(cfgInfo.first);
+
+    REQUIRE(toVector(flatCfg.getExitStatements()) == Vector<StatementNumber>{2, 4, 5});
+    REQUIRE(toVector(flatCfg.getPrevious(5)) == Vector<StatementNumber>{3});
+    REQUIRE(toVector(flatCfg.getPrevious(3)) == Vector<StatementNumber>{1});
+}
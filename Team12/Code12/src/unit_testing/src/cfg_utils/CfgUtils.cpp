@@ -2686,3 +2686,13 @@ std::pair<CfgNode*, size_t> getProgram27CfgBip_ifInIf()
 
     return std::make_pair(expectedCfg, currentNumberOfNodes);
 }
+
+const BipSupergraph* getProgramCfgBip(ProgramNode* programNode)
+{
+    Vector<Pair<Name, const FlatCfg*>> procedureCfgs;
+    for (const std::unique_ptr<ProcedureNode>& procedure : programNode->procedureList) {
+        CfgNode* cfgRootNode = buildCfg(procedure->statementListNode).first;
+        procedureCfgs.emplace_back(procedure->procedureName, new FlatCfg(cfgRootNode));
+    }
+    return new BipSupergraph(procedureCfgs);
+}
@@ -20,6 +20,7 @@
 #define UNIT_TESTING_CFG_UTILS_H
 
 #include "Types.h"
+#include "cfg/BipSupergraph.h"
 #include "cfg/CfgBuilder.h"
 
 // Program 1: Basic program with read, assign, print
@@ -98,4 +99,11 @@ std::pair<CfgNode*, size_t> getProgram27CfgBip_ifInIf();
 
 // Program 28: program combining programs 27, 26 and 25
 std::pair<CfgNode*, size_t> getProgram28CfgBip_combineIfInIfAndNested3AndNested2();
+
+/**
+ * Builds the CFG of each procedure of a program, and links
+ * their flat CFGs into the CFG BIP of the program. Like the
+ * CFGs above, the CFG BIP and flat CFGs are never freed.
+ */
+const BipSupergraph* getProgramCfgBip(ProgramNode* programNode);
 #endif // UNIT_TESTING_CFG_UTILS_H
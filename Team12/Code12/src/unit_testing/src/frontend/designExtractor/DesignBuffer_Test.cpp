@@ -0,0 +1,143 @@
+/**
+ * Unit tests for the buffer of relationships, and the scheduler
+ * of tasks, used by the Design Extractor in SPA Frontend.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+
+#include "../../ast_utils/AstUtils.h"
+#include "catch.hpp"
+#include "frontend/designExtractor/DesignBuffer.h"
+#include "frontend/designExtractor/DesignExtractor.h"
+#include "frontend/designExtractor/ExtractionScheduler.h"
+#include "frontend/parser/Parser.h"
+#include "pkb/PKB.h"
+
+TEST_CASE("Relationships are only stored in the PKB when the buffer is stored")
+{
+    resetPKB();
+    DesignBuffer buffer;
+    {
+        DesignBuffer::Scope bufferScope(&buffer);
+        REQUIRE(DesignBuffer::getActiveBuffer() == &buffer);
+        bufferFollowsRelationships(1, AssignmentStatement, 2, PrintStatement);
+        bufferUsesRelationships(2, PrintStatement, Vector<String>{"x"});
+        bufferUsesRelationships("main", Vector<String>{"x"});
+    }
+    REQUIRE(DesignBuffer::getActiveBuffer() == nullptr);
+    REQUIRE_FALSE(checkIfFollowsHolds(1, 2));
+    REQUIRE_FALSE(checkIfProcedureUses("main", "x"));
+
+    buffer.storeInPkb();
+    REQUIRE(checkIfFollowsHolds(1, 2));
+    REQUIRE(checkIfStatementUses(2, "x"));
+    REQUIRE(checkIfProcedureUses("main", "x"));
+
+    // without an active buffer, relationships are stored directly
+    bufferFollowsRelationships(2, PrintStatement, 3, ReadStatement);
+    REQUIRE(checkIfFollowsHolds(2, 3));
+    resetPKB();
+}
+
+TEST_CASE("Extraction scheduler runs every task exactly once")
+{
+    const size_t numberOfTasks = 100;
+    Vector<size_t> timesRun(numberOfTasks, 0);
+    std::atomic<size_t> totalRun(0);
+    std::atomic<size_t> threadsOutOfRange(0);
+    size_t numberOfThreads = countExtractionThreads(numberOfTasks);
+    REQUIRE(numberOfThreads >= 1);
+    REQUIRE(countExtractionThreads(0) == 1);
+    runExtractionTasks(numberOfTasks, numberOfThreads, [&](size_t taskIndex, size_t threadIndex) {
+        // Catch cannot be used by several threads, so check after the tasks
+        if (threadIndex >= numberOfThreads) {
+            threadsOutOfRange++;
+        }
+        // each task writes only to its own element
+        timesRun.at(taskIndex)++;
+        totalRun++;
+    });
+    REQUIRE(totalRun == numberOfTasks);
+    REQUIRE(threadsOutOfRange == 0);
+    REQUIRE(timesRun == Vector<size_t>(numberOfTasks, 1));
+}
+
+TEST_CASE("Extraction scheduler rethrows an exception thrown by a task")
+{
+    auto failingTask = [](size_t taskIndex, size_t) {
+        if (taskIndex == 3) {
+            throw std::runtime_error("task failed");
+        }
+    };
+    REQUIRE_THROWS_AS(runExtractionTasks(10, 4, failingTask), std::runtime_error);
+    REQUIRE_THROWS_AS(runExtractionTasks(10, 1, failingTask), std::runtime_error);
+}
+
+/**
+ * Gets the relationships stored in the PKB, as sorted
+ * strings, so that they can be compared between runs.
+ */
+Vector<String> getSortedRelationships()
+{
+    Vector<String> relationships;
+    for (const auto& tuple : getAllFollowsTupleStar(AnyStatement, AnyStatement)) {
+        relationships.push_back("Follows* " + std::to_string(tuple.first) + " " + std::to_string(tuple.second));
+    }
+    for (const auto& tuple : getAllParentTupleStar(AnyStatement, AnyStatement)) {
+        relationships.push_back("Parent* " + std::to_string(tuple.first) + " " + std::to_string(tuple.second));
+    }
+    for (const auto& tuple : getAllNextTuples(AnyStatement, AnyStatement)) {
+        relationships.push_back("Next " + std::to_string(tuple.first) + " " + std::to_string(tuple.second));
+    }
+    for (const auto& tuple : getAllUsesStatementTuple(AnyStatement)) {
+        relationships.push_back("Uses " + std::to_string(tuple.first) + " " + tuple.second);
+    }
+    for (const auto& tuple : getAllUsesProcedureTuple()) {
+        relationships.push_back("Uses " + tuple.first + " " + tuple.second);
+    }
+    for (const auto& tuple : getAllModifiesStatementTuple(AnyStatement)) {
+        relationships.push_back("Modifies " + std::to_string(tuple.first) + " " + tuple.second);
+    }
+    for (const auto& tuple : getAllModifiesProcedureTuple()) {
+        relationships.push_back("Modifies " + tuple.first + " " + tuple.second);
+    }
+    for (const auto& tuple : getAllCallsTupleStar()) {
+        relationships.push_back("Calls* " + tuple.first + " " + tuple.second);
+    }
+    std::sort(relationships.begin(), relationships.end());
+    return relationships;
+}
+
+/**
+ * Parses a program and extracts its design on at most
+ * the given number of threads, then gets the
+ * relationships stored in the PKB.
+ */
+Vector<String> extractRelationships(const String& program, size_t maximumThreads)
+{
+    resetPKB();
+    ParserReturnType<ProgramNode*> parsedProgram = parseSimpleReturnNode(program);
+    REQUIRE_FALSE(parsedProgram.hasError());
+    ProgramNode* rootNode = parsedProgram.astNode;
+    REQUIRE(extractDesign(*rootNode, maximumThreads));
+    assignRootNode(rootNode);
+    Vector<String> relationships = getSortedRelationships();
+    resetPKB();
+    return relationships;
+}
+
+TEST_CASE("Extracting on several threads stores the same relationships as on one thread")
+{
+    Vector<String> programs = {getProgram7String_computeCentroid(), getProgram16String_keywordsAsIdentifier(),
+                               getProgram17String_sameVariableAndProcedureName(),
+                               getProgram20String_multipleProceduresSpheresdf()};
+    for (const String& program : programs) {
+        Vector<String> singleThreaded = extractRelationships(program, 1);
+        REQUIRE_FALSE(singleThreaded.empty());
+        // more threads than procedures, even on a single core
+        REQUIRE(extractRelationships(program, 2) == singleThreaded);
+        REQUIRE(extractRelationships(program, 4) == singleThreaded);
+    }
+}
@@ -0,0 +1,99 @@
+/**
+ * Unit tests for the single-pass traversal of
+ * procedures used by the Design Extractor.
+ */
+
+#include "catch.hpp"
+#include "frontend/designExtractor/DesignTraversal.h"
+#include "frontend/designExtractor/VariablesCollector.h"
+#include "frontend/parser/Parser.h"
+#include "pkb/PKB.h"
+
+/**
+ * Records everything that it visits, in order.
+ */
+class RecordingSink: public DesignSink {
+public:
+    Vector<String> visits;
+
+    Void visitStatementList(const StmtlstNode& stmtLstNode, const StatementNode* container) override
+    {
+        String list = container == nullptr ? "body" : std::to_string(container->getStatementNumber());
+        for (const std::unique_ptr<StatementNode>& statement : stmtLstNode.statementList) {
+            list += " " + std::to_string(statement->getStatementNumber());
+        }
+        visits.push_back("list " + list);
+    }
+
+    Void visitUsedVariable(const StatementNode& statement, const Name& variable) override
+    {
+        visits.push_back("uses " + std::to_string(statement.getStatementNumber()) + " " + variable);
+    }
+
+    Void visitModifiedVariable(const StatementNode& statement, const Name& variable) override
+    {
+        visits.push_back("modifies " + std::to_string(statement.getStatementNumber()) + " " + variable);
+    }
+
+    Void visitCall(const CallStatementNode& call) override
+    {
+        visits.push_back("calls " + std::to_string(call.getStatementNumber()) + " " + call.procedureName);
+    }
+
+    Void visitProcedureEnd(const ProcedureNode& procedureNode) override
+    {
+        visits.push_back("end " + procedureNode.procedureName);
+    }
+};
+
+const char* const traversalProgram = "procedure main { read x; while (x > y) { x = x - 1; if (!(x == 2)) then { "
+                                     "call helper; } else { print y; } } } procedure helper { z = 1; }";
+
+TEST_CASE("Traversal visits every part of a procedure once, with containers before their statements")
+{
+    resetPKB();
+    ParserReturnType<ProgramNode*> parsed = parseSimpleReturnNode(traversalProgram);
+    REQUIRE_FALSE(parsed.hasError());
+    RecordingSink first;
+    RecordingSink second;
+    traverseProcedure(*parsed.astNode->procedureList.at(0), {&first, &second});
+
+    Vector<String> expected{"list body 1 2", "modifies 1 x", "uses 2 x",   "uses 2 y",  "list 2 3 4",
+                            "modifies 3 x",  "uses 3 x",     "uses 4 x",   "list 4 5",  "calls 5 helper",
+                            "list 4 6",      "uses 6 y",     "end main"};
+    REQUIRE(first.visits == expected);
+    REQUIRE(second.visits == expected);
+    resetPKB();
+}
+
+TEST_CASE("Variables collector finds the variables of containers and calls")
+{
+    resetPKB();
+    ParserReturnType<ProgramNode*> parsed = parseSimpleReturnNode(traversalProgram);
+    REQUIRE_FALSE(parsed.hasError());
+    ModifiedVariablesCollector collector;
+    traverseProcedure(*parsed.astNode->procedureList.at(0), {&collector});
+
+    VariableIds variableIds;
+    collector.resolve(variableIds, std::unordered_map<Name, size_t>{{"main", 0}, {"helper", 1}});
+    REQUIRE(variableIds.size() == 1);
+    size_t z = variableIds.intern("z");
+    AdaptiveBitset variablesOfHelper = variableIds.createSet();
+    variablesOfHelper.set(z);
+    Vector<AdaptiveBitset> procedureVariables{AdaptiveBitset(), variablesOfHelper};
+    Vector<Pair<const StatementNode*, AdaptiveBitset>> statementVariables;
+    AdaptiveBitset variablesOfMain = collector.findVariables(procedureVariables, variableIds, statementVariables);
+    REQUIRE(variableIds.getNames(variablesOfMain) == Vector<String>{"x", "z"});
+
+    // nested statements come before their containers
+    Vector<StatementNumber> order;
+    for (const Pair<const StatementNode*, AdaptiveBitset>& statement : statementVariables) {
+        order.push_back(statement.first->getStatementNumber());
+    }
+    REQUIRE(order == Vector<StatementNumber>{1, 3, 5, 6, 4, 2});
+    REQUIRE(variableIds.getNames(statementVariables.at(2).second) == Vector<String>{"z"});
+    REQUIRE_FALSE(statementVariables.at(3).second.any());
+    REQUIRE(variableIds.getNames(statementVariables.at(4).second) == Vector<String>{"z"});
+    REQUIRE(variableIds.getNames(statementVariables.at(5).second) == Vector<String>{"x", "z"});
+    resetPKB();
+}
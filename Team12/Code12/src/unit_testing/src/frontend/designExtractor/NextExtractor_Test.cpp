@@ -387,3 +387,22 @@ TEST_CASE("Next extractor works for program with if in if statement - ifInIf")
     bool isEqual = checkIfNextRelationshipsAreEqual(actualNextRelationships, expectedNextRelationships);
     REQUIRE(isEqual == true);
 }
+
+TEST_CASE("Next extractor finds the same Next relationships from the flat CFG as from the CFG")
+{
+    Vector<ProgramNode*> programs = {getProgram2Tree_factorials(),
+                                     getProgram5Tree_sumDigit(),
+                                     getProgram18Tree_endWithWhile(),
+                                     getProgram21Tree_endWithIf(),
+                                     getProgram23Tree_nestedWhileIfs(),
+                                     getProgram26Tree_nestedInterleavingIfsInWhile(),
+                                     getProgram27Tree_ifInIf()};
+    for (ProgramNode* program : programs) {
+        const StmtlstNode* const stmtListNode = program->procedureList.at(0)->statementListNode;
+        std::pair<CfgNode*, size_t> cfgInfo = buildCfg(stmtListNode);
+        FlatCfg flatCfg(cfgInfo.first);
+
+        bool isEqual = checkIfNextRelationshipsAreEqual(extractNext(flatCfg), extractNext(cfgInfo));
+        REQUIRE(isEqual == true);
+    }
+}
@@ -3,6 +3,8 @@
 #include "../../ast_utils/AstUtils.h"
 #include "catch.hpp"
 #include "frontend/designExtractor/SemanticErrorsValidator.h"
+#include "frontend/parser/Parser.h"
+#include "pkb/PKB.h"
 
 TEST_CASE("Design Extractor identifies semantically valid program as valid - computeAverage")
 {
@@ -78,3 +80,15 @@ TEST_CASE("Design Extractor identifies semantically invalid recursive program as
     Boolean isSemanticallyValid = seValidator.isProgramValid();
     REQUIRE(isSemanticallyValid == false);
 }
+
+TEST_CASE("Design Extractor identifies semantically invalid program with nested non-existent procedure call as invalid")
+{
+    resetPKB();
+    ParserReturnType<ProgramNode*> parsed = parseSimpleReturnNode("procedure main { read x; } procedure helper { "
+                                                                  "while (x > 0) { x = x - 1; if (x == 2) then { "
+                                                                  "call missing; } else { call main; } } }");
+    REQUIRE_FALSE(parsed.hasError());
+    SemanticErrorsValidator seValidator(*parsed.astNode);
+    REQUIRE(seValidator.isProgramValid() == false);
+    resetPKB();
+}
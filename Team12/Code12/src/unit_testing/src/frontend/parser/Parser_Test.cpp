@@ -197,3 +197,44 @@ TEST_CASE("Syntax error, mismatched brackets")
     ProgramNode* ast = parseSimpleReturnNode(getProgram7StringMismatchedBrackets_computeCentroid()).astNode;
     REQUIRE(ast == nullptr);
 }
+
+TEST_CASE("Parser parses multiple procedures from a buffer that is not null-terminated")
+{
+    String program = getProgram20String_multipleProceduresSpheresdf();
+    // append characters that are not part of the program
+    String buffer = program + "procedure";
+    ProgramNode* ast = parseSimpleReturnNode(buffer.data(), program.size()).astNode;
+    REQUIRE(ast != nullptr);
+    REQUIRE(*(ast) == *(getProgram20Tree_multipleProceduresSpheresdf()));
+}
+
+TEST_CASE("Syntax error, tokens after last procedure")
+{
+    String program = getProgram20String_multipleProceduresSpheresdf() + " x = 1;";
+    ParserReturnType<ProgramNode*> parsed = parseSimpleReturnNode(program);
+    REQUIRE(parsed.hasError());
+    REQUIRE(parsed.astNode == nullptr);
+}
+
+TEST_CASE("Syntax error, empty program")
+{
+    ParserReturnType<ProgramNode*> parsed = parseSimpleReturnNode("  \n ");
+    REQUIRE(parsed.hasError());
+}
+
+TEST_CASE("Parser parses deeply nested expressions")
+{
+    const int depth = 1000;
+    String expression = "a";
+    for (int i = 0; i < depth; i++) {
+        expression = "(" + expression + (i % 2 == 0 ? " + " : " * ") + std::to_string(i) + ")";
+    }
+    String condition = "a < b";
+    for (int i = 0; i < depth; i++) {
+        condition = "!(" + condition + ")";
+    }
+    String program = "procedure p { x = " + expression + "; while (" + condition + ") { y = y - 1; } }";
+    ParserReturnType<ProgramNode*> parsed = parseSimpleReturnNode(program);
+    REQUIRE_FALSE(parsed.hasError());
+    REQUIRE(parsed.astNode->totalNumberOfStatements == 3);
+}
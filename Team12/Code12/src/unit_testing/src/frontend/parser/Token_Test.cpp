@@ -0,0 +1,107 @@
+/**
+ * Unit tests for the SIMPLE tokeniser.
+ */
+
+#include "../../ast_utils/AstUtils.h"
+#include "catch.hpp"
+#include "frontend/parser/Token.h"
+#include "lexer/Lexer.h"
+
+using namespace frontend;
+
+Boolean areTokenListsEquivalent(const TokenList& first, const TokenList& second)
+{
+    if (first.size() != second.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < first.size(); i++) {
+        if (first.at(i).tokenTag != second.at(i).tokenTag || first.getTokenString(i) != second.getTokenString(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST_CASE("Single pass tokeniser matches tokenising of split program")
+{
+    String program = getProgram15String_complicatedConditional();
+    TokenList singlePass = tokeniseSimple(program);
+    TokenList fromFragments = tokeniseSimple(splitProgram(program));
+    REQUIRE(areTokenListsEquivalent(singlePass, fromFragments));
+
+    String computeProgram = getProgram1String_compute();
+    REQUIRE(areTokenListsEquivalent(tokeniseSimple(computeProgram), tokeniseSimple(splitProgram(computeProgram))));
+}
+
+TEST_CASE("Single pass tokeniser identifies tags and offsets")
+{
+    String program = "if(x>=10&&y!=z1){read read;}";
+    TokenList tokens = tokeniseSimple(program);
+    Vector<Tag> expectedTags{IfKeywordTag,   BracketOpenTag,    IdentifierTag,    GteTag,
+                             ConstantTag,    AndConditionalTag, IdentifierTag,    NeqTag,
+                             IdentifierTag,  BracketClosedTag,  BracesOpenTag,    ReadKeywordTag,
+                             ReadKeywordTag, SemicolonTag,      BracesClosedTag};
+    REQUIRE(tokens.size() == expectedTags.size());
+    for (size_t i = 0; i < expectedTags.size(); i++) {
+        REQUIRE(tokens.at(i).tokenTag == expectedTags.at(i));
+        if (!tokens.getTokenString(i).empty()) {
+            REQUIRE(program.substr(tokens.at(i).offset, tokens.at(i).length) == tokens.getTokenString(i));
+        }
+    }
+    REQUIRE(tokens.at(3).offset == 4);
+    REQUIRE(tokens.at(3).length == 2);
+    REQUIRE(tokens.getTokenString(4) == "10");
+    REQUIRE(tokens.getTokenString(8) == "z1");
+    // keywords can be used as names, so their strings are kept
+    REQUIRE(tokens.getTokenString(12) == "read");
+    // operators do not store their lexeme
+    REQUIRE(tokens.getTokenString(3).empty());
+}
+
+TEST_CASE("Tokeniser interns repeated identifiers and constants")
+{
+    TokenList tokens = tokeniseSimple("x = x + 1 * x - 1;");
+    REQUIRE(tokens.size() == 10);
+    REQUIRE(tokens.at(0).stringId == tokens.at(2).stringId);
+    REQUIRE(tokens.at(0).stringId == tokens.at(6).stringId);
+    REQUIRE(tokens.at(4).stringId == tokens.at(8).stringId);
+    REQUIRE(tokens.countInternedStrings() == 2);
+}
+
+TEST_CASE("Tokeniser marks invalid lexemes as unknown")
+{
+    TokenList tokens = tokeniseSimple("1abc @ x");
+    REQUIRE(tokens.size() == 3);
+    REQUIRE(tokens.at(0).tokenTag == UnknownTag);
+    REQUIRE(tokens.at(1).tokenTag == UnknownTag);
+    REQUIRE(tokens.at(2).tokenTag == IdentifierTag);
+
+    TokenList fragments = tokeniseSimple(StringVector{"x+y", "y"});
+    REQUIRE(fragments.at(0).tokenTag == UnknownTag);
+    REQUIRE(fragments.at(1).tokenTag == IdentifierTag);
+}
+
+TEST_CASE("Tokeniser computes matching brackets")
+{
+    TokenList tokens = tokeniseSimple("( ( a ) + ( b ) ) ) (");
+    REQUIRE(tokens.getMatchingBracket(0) == 8);
+    REQUIRE(tokens.getMatchingBracket(8) == 0);
+    REQUIRE(tokens.getMatchingBracket(1) == 3);
+    REQUIRE(tokens.getMatchingBracket(5) == 7);
+    REQUIRE(tokens.getMatchingBracket(9) == TokenList::NoMatchingToken);
+    REQUIRE(tokens.getMatchingBracket(10) == TokenList::NoMatchingToken);
+    REQUIRE(tokens.getMatchingBracket(2) == TokenList::NoMatchingToken);
+}
+
+TEST_CASE("Tokeniser finds previous operators outside of brackets")
+{
+    TokenList tokens = tokeniseSimple("a - b * ( c + d ) % e ) f");
+    REQUIRE(tokens.findPreviousAdditiveOperator(10) == 1);
+    REQUIRE(tokens.findPreviousMultiplicativeOperator(10) == 9);
+    REQUIRE(tokens.findPreviousMultiplicativeOperator(8) == 3);
+    REQUIRE(tokens.findPreviousAdditiveOperator(7) == 6);
+    REQUIRE(tokens.findPreviousAdditiveOperator(0) == TokenList::NoMatchingToken);
+    // unmatched closing bracket stops the search
+    REQUIRE(tokens.findPreviousAdditiveOperator(11) == TokenList::NoMatchingToken);
+    REQUIRE(tokens.findPreviousAdditiveOperator(12) == TokenList::NoMatchingToken);
+}
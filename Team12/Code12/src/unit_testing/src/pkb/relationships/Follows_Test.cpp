@@ -307,6 +307,21 @@ SCENARIO("Iteration 1 toy example Follows", "[follows][pkb]")
                 // select <p,s> such that Follows(p,s): None
                 REQUIRE(followsTable.getAllFollowsTupleStar(PrintStatement, AnyStatement).empty());
             }
+
+            THEN("views of the tuples contain the same tuples as the copies")
+            {
+                Vector<StatementType> types = {AnyStatement, ReadStatement, AssignmentStatement, PrintStatement};
+                for (StatementType before : types) {
+                    for (StatementType after : types) {
+                        REQUIRE(followsTable.viewAllFollowsTuple(before, after).toVector()
+                                == followsTable.getAllFollowsTuple(before, after));
+                        REQUIRE(followsTable.viewAllFollowsTupleStar(before, after).toVector()
+                                == followsTable.getAllFollowsTupleStar(before, after));
+                    }
+                }
+                REQUIRE(followsTable.viewAllFollowsTuple(IfStatement, WhileStatement).empty());
+                REQUIRE(followsTable.viewAllFollowsTupleStar(AnyStatement, CallStatement).size() == 0);
+            }
         }
     }
 }
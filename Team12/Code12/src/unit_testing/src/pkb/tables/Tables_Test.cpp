@@ -192,4 +192,25 @@ SCENARIO("Iteration 1 Tables Test")
             }
         }
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Attribute table looks up the names of call, read and print statements")
+{
+    AttributeTable attributeTable;
+    attributeTable.insertIntoAttributeTable(1, "steps");
+    attributeTable.insertIntoAttributeTable(2, "raymarch");
+    attributeTable.insertIntoAttributeTable(3, "depth");
+    attributeTable.insertIntoAttributeTable(8, "depth");
+    attributeTable.insertIntoAttributeTable(10, "spheresdf");
+
+    REQUIRE(attributeTable.getStatementAttribute(1) == "steps");
+    REQUIRE(attributeTable.getStatementAttribute(2) == "raymarch");
+    REQUIRE(attributeTable.getStatementAttribute(3) == "depth");
+    REQUIRE(attributeTable.getStatementAttribute(8) == "depth");
+    REQUIRE(attributeTable.getStatementAttribute(10) == "spheresdf");
+    // statements without a name, or not in the program
+    REQUIRE(attributeTable.getStatementAttribute(4).empty());
+    REQUIRE(attributeTable.getStatementAttribute(0).empty());
+    REQUIRE(attributeTable.getStatementAttribute(-1).empty());
+    REQUIRE(attributeTable.getStatementAttribute(1000000).empty());
+}
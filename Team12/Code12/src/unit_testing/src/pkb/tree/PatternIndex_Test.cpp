@@ -0,0 +1,80 @@
+/**
+ * Unit tests for the index of the expressions in assignment statements.
+ */
+
+#include "ast/AstLibrary.h"
+#include "catch.hpp"
+#include "pkb/tree/PatternIndex.h"
+
+TEST_CASE("Pattern index finds assignments by their whole expression and by subexpressions")
+{
+    // 1. a = x * y + z;  2. b = x * y;  3. c = z + x * y;  4. a = 1;
+    std::unique_ptr<Expression> first(
+        createPlusExpr(createTimesExpr(createRefExpr("x"), createRefExpr("y")), createRefExpr("z")));
+    std::unique_ptr<Expression> second(createTimesExpr(createRefExpr("x"), createRefExpr("y")));
+    std::unique_ptr<Expression> third(
+        createPlusExpr(createRefExpr("z"), createTimesExpr(createRefExpr("x"), createRefExpr("y"))));
+    std::unique_ptr<Expression> fourth(createRefExpr(1));
+    PatternIndex index;
+    index.addAssignment(1, "a", first.get());
+    index.addAssignment(2, "b", second.get());
+    index.addAssignment(3, "c", third.get());
+    index.addAssignment(4, "a", fourth.get());
+
+    REQUIRE(index.getAllAssigns() == Vector<StatementNumber>{1, 2, 3, 4});
+    REQUIRE(index.getAssignedVariable(3) == "c");
+
+    std::unique_ptr<Expression> timesQuery(createTimesExpr(createRefExpr("x"), createRefExpr("y")));
+    REQUIRE(index.getAssignsWithExpression(timesQuery.get()) == Vector<StatementNumber>{2});
+    REQUIRE(index.getAssignsWithSubexpression(timesQuery.get()) == Vector<StatementNumber>{1, 2, 3});
+
+    // addition is not commutative in patterns
+    std::unique_ptr<Expression> plusQuery(
+        createPlusExpr(createTimesExpr(createRefExpr("x"), createRefExpr("y")), createRefExpr("z")));
+    REQUIRE(index.getAssignsWithSubexpression(plusQuery.get()) == Vector<StatementNumber>{1});
+
+    std::unique_ptr<Expression> constantQuery(createRefExpr(1));
+    REQUIRE(index.getAssignsWithExpression(constantQuery.get()) == Vector<StatementNumber>{4});
+    std::unique_ptr<Expression> variableQuery(createRefExpr("z"));
+    REQUIRE(index.getAssignsWithSubexpression(variableQuery.get()) == Vector<StatementNumber>{1, 3});
+
+    // expressions with parts that are in no assignment match nothing
+    std::unique_ptr<Expression> missingQuery(createTimesExpr(createRefExpr("x"), createRefExpr("w")));
+    REQUIRE(index.getAssignsWithSubexpression(missingQuery.get()).empty());
+    std::unique_ptr<Expression> constantAsVariableQuery(createRefExpr("1"));
+    REQUIRE(index.getAssignsWithSubexpression(constantAsVariableQuery.get()).empty());
+}
+
+TEST_CASE("Pattern index finds statements by the variables assigned to and used in conditions")
+{
+    // 1. while (!(x > y) && (x == 1)) {  2. x = y;  3. if (z < 2) {  4. z = x;  } else {  5. x = 0; } }
+    std::unique_ptr<ConditionalExpression> whileCondition(
+        createAndExpr(createNotExpr(createGtExpr(createRefExpr("x"), createRefExpr("y"))),
+                      createEqExpr(createRefExpr("x"), createRefExpr(1))));
+    std::unique_ptr<ConditionalExpression> ifCondition(createLtExpr(createRefExpr("z"), createRefExpr(2)));
+    std::unique_ptr<Expression> second(createRefExpr("y"));
+    std::unique_ptr<Expression> fourth(createRefExpr("x"));
+    std::unique_ptr<Expression> fifth(createRefExpr(0));
+    PatternIndex index;
+    index.addContainer(1, WhileStatement, whileCondition.get());
+    index.addAssignment(2, "x", second.get());
+    index.addContainer(3, IfStatement, ifCondition.get());
+    index.addAssignment(4, "z", fourth.get());
+    index.addAssignment(5, "x", fifth.get());
+
+    REQUIRE(index.getAssignsModifying("x") == Vector<StatementNumber>{2, 5});
+    REQUIRE(index.getAssignsModifying("z") == Vector<StatementNumber>{4});
+    REQUIRE(index.getAssignsModifying("y").empty());
+    REQUIRE(index.getAssignsModifying("w").empty());
+
+    REQUIRE(index.getAllContainers(WhileStatement) == Vector<StatementNumber>{1});
+    REQUIRE(index.getAllContainers(IfStatement) == Vector<StatementNumber>{3});
+    REQUIRE(index.getContainersUsing(WhileStatement, "y") == Vector<StatementNumber>{1});
+    REQUIRE(index.getContainersUsing(IfStatement, "z") == Vector<StatementNumber>{3});
+    REQUIRE(index.getContainersUsing(IfStatement, "x").empty());
+    REQUIRE(index.getContainersUsing(WhileStatement, "w").empty());
+
+    // a variable used twice in a condition is listed once
+    REQUIRE(index.getControlVariables(1) == Vector<Name>{"x", "y"});
+    REQUIRE(index.getControlVariables(3) == Vector<Name>{"z"});
+}
@@ -0,0 +1,69 @@
+#include "catch.hpp"
+#include "pql/QueryCache.h"
+#include "pql/preprocessor/Preprocessor.h"
+
+TEST_CASE("Query cache normalises whitespace in queries")
+{
+    REQUIRE(QueryCache::normaliseQuery("stmt s; Select s") == "stmt s; Select s");
+    REQUIRE(QueryCache::normaliseQuery("  stmt s;\n\tSelect   s  ") == "stmt s; Select s");
+    REQUIRE(QueryCache::normaliseQuery("assign a; Select a pattern a(_, \"x  +\ty\")")
+            == "assign a; Select a pattern a(_, \"x + y\")");
+    REQUIRE(QueryCache::normaliseQuery(" \n ").empty());
+}
+
+TEST_CASE("Query cache preprocesses each query once")
+{
+    QueryCache queryCache(8);
+    String query = "stmt s; Select s such that Follows(s, 3)";
+
+    const AbstractQuery& plan = queryCache.getQueryPlan(query, true);
+    REQUIRE(plan == Preprocessor::processQuery(query));
+    REQUIRE(queryCache.getMisses() == 1);
+    REQUIRE(queryCache.getHits() == 0);
+
+    SECTION("Repeated queries are found in the cache")
+    {
+        const AbstractQuery& cachedPlan = queryCache.getQueryPlan(query, true);
+        REQUIRE(&cachedPlan == &plan);
+        queryCache.getQueryPlan("stmt s;\nSelect s such that  Follows(s, 3) ", true);
+        REQUIRE(queryCache.getHits() == 2);
+        REQUIRE(queryCache.getMisses() == 1);
+        REQUIRE(queryCache.size() == 1);
+    }
+
+    SECTION("Queries optimised and not optimised are cached separately")
+    {
+        queryCache.getQueryPlan(query, false);
+        REQUIRE(queryCache.getMisses() == 2);
+        REQUIRE(queryCache.size() == 2);
+    }
+
+    SECTION("Invalid queries are not cached")
+    {
+        const AbstractQuery& invalidPlan = queryCache.getQueryPlan("stmt s; Select t", true);
+        REQUIRE(invalidPlan.isInvalid());
+        queryCache.getQueryPlan("stmt s; Select t", true);
+        REQUIRE(queryCache.getMisses() == 3);
+        REQUIRE(queryCache.size() == 1);
+    }
+
+    SECTION("The cache is cleared once it is full")
+    {
+        for (int i = 1; i <= 8; i++) {
+            queryCache.getQueryPlan("stmt s; Select s such that Follows(s, " + std::to_string(i) + ")", true);
+        }
+        // Follows(s, 3) was already cached, so the ninth query clears the cache
+        REQUIRE(queryCache.size() == 8);
+        queryCache.getQueryPlan("stmt s; Select s such that Follows(s, 9)", true);
+        REQUIRE(queryCache.size() == 1);
+        REQUIRE(queryCache.getMisses() == 9);
+    }
+
+    SECTION("Clearing the cache resets the counters")
+    {
+        queryCache.clear();
+        REQUIRE(queryCache.size() == 0);
+        REQUIRE(queryCache.getHits() == 0);
+        REQUIRE(queryCache.getMisses() == 0);
+    }
+}
@@ -7,6 +7,7 @@
 
 #include <utility>
 
+#include "../../ast_utils/AstUtils.h"
 #include "../../cfg_utils/CfgUtils.h"
 #include "EvaluatorTestingUtils.h"
 #include "catch.hpp"
@@ -174,7 +175,7 @@ public:
 
 class AffectsBipFacadeStub: public AffectsBipFacade, public AffectsFacadeStub {
 private:
-    CfgNode* cfgNode;
+    const BipSupergraph* cfgBip;
 
 public:
     /**
@@ -191,9 +192,9 @@ public:
      */
     AffectsBipFacadeStub(std::unordered_map<Integer, std::unordered_set<String>> modifiedVariablesMap,
                          std::unordered_map<Integer, std::unordered_set<String>> usedVariablesMap,
-                         std::unordered_map<Integer, StatementType> statementTypes, CfgNode* cfgBip):
+                         std::unordered_map<Integer, StatementType> statementTypes, const BipSupergraph* cfgBip):
         AffectsFacadeStub(std::move(modifiedVariablesMap), std::move(usedVariablesMap), std::move(statementTypes)),
-        cfgNode(cfgBip)
+        cfgBip(cfgBip)
     {}
 
     Vector<String> getUsed(Integer stmtNum) override
@@ -211,19 +212,9 @@ public:
         return AffectsFacadeStub::getType(stmtNum);
     }
 
-    CfgNode* getCfg(const String&) override
+    const BipSupergraph* getCfgBip() override
     {
-        return cfgNode;
-    }
-
-    Vector<String> getProcedure(Integer stmtNum) override
-    {
-        return {"dummy"};
-    }
-
-    Vector<String> getRelevantProcedures() override
-    {
-        return {"dummy"};
+        return cfgBip;
     }
 };
 
@@ -239,7 +230,8 @@ AffectsFacadeStub* getFacadeProgram20NoCall()
 
 AffectsBipFacadeStub* getBipFacadeProgram20()
 {
-    return new AffectsBipFacadeStub(PROGRAM_20_MAPS_NO_CALL, getProgram20CfgBip_multipleProceduresSpheresdf().first);
+    return new AffectsBipFacadeStub(PROGRAM_20_MAPS_NO_CALL,
+                                    getProgramCfgBip(getProgram20Tree_multipleProceduresSpheresdf()));
 }
 
 TEST_CASE("Affects Search works over CFG of program 20")
@@ -370,3 +362,17 @@ TEST_CASE("Affects BIP * Search works over CFG BIP of program 20")
         requireVectorsHaveSameElements(results, {9, 12, 13, 15, 16, 17, 20, 21, 22, 23});
     }
 }
+
+TEST_CASE("AffectsBip summaries find every AffectsBip relationship of program 20")
+{
+    AffectsBipFacadeStub* facade = getBipFacadeProgram20();
+    AffectsBipSummaries summaries(*facade->getCfgBip(), *facade);
+    Vector<Pair<StatementNumber, StatementNumber>> affectsBip = summaries.findAllAffectsBip();
+    requireVectorsHaveSameElements(affectsBip, {{4, 9},   {5, 9},   {13, 9},  {13, 17}, {14, 14}, {15, 16}, {15, 21},
+                                                {16, 20}, {16, 21}, {16, 22}, {16, 23}, {17, 9},  {17, 12}, {17, 13},
+                                                {17, 17}, {21, 20}, {21, 21}, {21, 22}, {21, 23}, {22, 13}, {23, 15}});
+
+    requireVectorsHaveSameElements(summaries.findAffectsBipStar(16).toVector(), {9, 12, 13, 15, 16, 17, 20, 21, 22, 23});
+    REQUIRE_FALSE(summaries.findAffectsBipStar(9).any());
+    delete facade;
+}
@@ -107,6 +107,29 @@ TEST_CASE("Evaluator::evaluateQuery(AbstractQuery query) -> vacuously true PQL q
     REQUIRE(rawQueryResult == expectedRawQueryResult);
 }
 
+TEST_CASE("Evaluator::evaluateQuery(AbstractQuery query, size_t rowLimit) -> returns at most rowLimit results")
+{
+    // === Test set-up ===
+    resetPKB();
+    insertIntoStatementTable(23, ReadStatement);
+    insertIntoStatementTable(24, PrintStatement);
+    insertIntoStatementTable(29, WhileStatement);
+    AbstractQuery abstractQuery = AbstractQueryBuilder::create()
+                                      .addSelectSynonym("s")
+                                      .addSelectSynonym("s1")
+                                      .addDeclaration("s", "stmt")
+                                      .addDeclaration("s1", "stmt")
+                                      .build();
+
+    // === Execute test method ===
+    RawQueryResult limitedResult = evaluateQuery(abstractQuery, 2);
+    RawQueryResult fullResult = evaluateQuery(abstractQuery);
+
+    // === Expected test results ===
+    REQUIRE(limitedResult.count() == 2);
+    REQUIRE(fullResult.count() == 9);
+}
+
 TEST_CASE(
     "Evaluator::evaluateQuery(AbstractQuery query) -> valid query examples (multiple clauses) returns valid results")
 {
@@ -302,6 +302,21 @@ TEST_CASE("Results of two synonyms merges to give empty results")
     REQUIRE_FALSE(table.hasResults());
 }
 
+TEST_CASE("ResultsTable narrows the candidates of synonyms as results are stored")
+{
+    ResultsTable table(DeclarationTable{});
+    REQUIRE(table.getCandidates("s") == nullptr);
+    table.storeResultsOne("s", std::vector<std::string>({"1", "2", "3"}));
+    table.storeResultsTwo("s", "v",
+                          std::vector<std::pair<std::string, std::string>>({{"2", "x"}, {"4", "y"}, {"3", "z"}}));
+    REQUIRE(*table.getCandidates("s") == ResultsSet({"2", "3"}));
+    REQUIRE(*table.getCandidates("v") == ResultsSet({"x", "z"}));
+
+    // the candidates are narrowed before the results are merged
+    table.storeResultsOne("v", std::vector<std::string>({"y"}));
+    REQUIRE_FALSE(table.hasResults());
+}
+
 TEST_CASE("getResultsTwo returns expected relationships")
 {
     std::unique_ptr<ResultsTable> table = setUpResultsTableWithSameTestingGraph();
@@ -550,3 +565,26 @@ TEST_CASE("mergeTwoSynonyms merges second synonym first when required to")
     // done, since second synonym did not exist in graph yet
     requireVectorsHaveSameElements(resultsOne, {"202", "203"});
 }
+
+TEST_CASE("getResultsCursor enumerates unrelated synonyms without joining them")
+{
+    ResultsTable table(DeclarationTable{});
+    table.storeResultsTwo("a", "b", {{"1", "x"}, {"2", "y"}});
+    table.storeResultsOne("c", {"Cpp", "Java", "Rust"});
+
+    TupleCursor cursor = table.getResultsCursor({"c", "a", "b"});
+    REQUIRE(cursor.countRows() == 6);
+    NtupledResult results;
+    Vector<String> row;
+    while (cursor.next(row)) {
+        results.push_back(row);
+    }
+    requireVectorsHaveSameElements(results, {{"Cpp", "1", "x"},
+                                             {"Cpp", "2", "y"},
+                                             {"Java", "1", "x"},
+                                             {"Java", "2", "y"},
+                                             {"Rust", "1", "x"},
+                                             {"Rust", "2", "y"}});
+    // the results of c are still separate from those of a and b
+    REQUIRE_FALSE(table.hasRelationships("a", "c"));
+}
@@ -5,6 +5,7 @@
 #include "EvaluatorTestingUtils.h"
 #include "catch.hpp"
 #include "pkb/PKB.h"
+#include "pql/evaluator/relationships/CallsEvaluator.h"
 #include "pql/evaluator/relationships/FollowsEvaluator.h"
 #include "pql/evaluator/relationships/ModifiesEvaluator.h"
 #include "pql/evaluator/relationships/ParentEvaluator.h"
@@ -133,6 +134,17 @@ TEST_CASE("Follows star clauses are evaluated correctly")
             std::vector<std::pair<std::string, std::string>>({{"5", "4"}, {"5", "3"}, {"5", "2"}, {"5", "1"}}));
     }
 
+    SECTION("Both variables, left restricted by an earlier clause")
+    {
+        resTable.storeResultsOne("s", std::vector<std::string>({"2", "6"}));
+        Reference leftRef(SynonymRefType, "s", DesignEntity(StmtType));
+        Reference rightRef(SynonymRefType, "a", DesignEntity(AssignType));
+        evaluateFollowsClause(leftRef, rightRef, true, &resTable);
+        REQUIRE(*resTable.getCandidates("s") == ResultsSet({"2"}));
+        requireVectorsHaveSameElements(resTable.getResultsTwo("s", "a"),
+                                       std::vector<std::pair<std::string, std::string>>({{"2", "5"}}));
+    }
+
     SECTION("Both wildcards")
     {
         Reference leftRef(WildcardRefType, "_");
@@ -617,6 +629,84 @@ TEST_CASE("Uses clauses are evaluated correctly")
     }
 }
 
+TEST_CASE("Calls clauses are evaluated correctly")
+{
+    resetPKB();
+    addCallerRelationships("main", "render");
+    addCallerRelationships("render", "shade");
+    addCallerRelationshipsStar("main", "render");
+    addCallerRelationshipsStar("main", "shade");
+    addCallerRelationshipsStar("render", "shade");
+    DeclarationTable declTable{};
+    DesignEntity procDesignEntity(ProcedureType);
+    declTable.addDeclaration("p", procDesignEntity);
+    declTable.addDeclaration("q", procDesignEntity);
+    ResultsTable resTable(declTable);
+
+    SECTION("Both variables")
+    {
+        Reference leftRef(SynonymRefType, "p", DesignEntity(ProcedureType));
+        Reference rightRef(SynonymRefType, "q", DesignEntity(ProcedureType));
+        evaluateCallsClause(leftRef, rightRef, false, &resTable);
+        requireVectorsHaveSameElements(resTable.getResultsOne("p"), std::vector<std::string>({"main", "render"}));
+        requireVectorsHaveSameElements(resTable.getResultsOne("q"), std::vector<std::string>({"render", "shade"}));
+        requireVectorsHaveSameElements(
+            resTable.getResultsTwo("p", "q"),
+            std::vector<std::pair<std::string, std::string>>({{"main", "render"}, {"render", "shade"}}));
+    }
+
+    SECTION("Both variables (star)")
+    {
+        Reference leftRef(SynonymRefType, "p", DesignEntity(ProcedureType));
+        Reference rightRef(SynonymRefType, "q", DesignEntity(ProcedureType));
+        evaluateCallsClause(leftRef, rightRef, true, &resTable);
+        requireVectorsHaveSameElements(
+            resTable.getResultsTwo("p", "q"),
+            std::vector<std::pair<std::string, std::string>>(
+                {{"main", "render"}, {"main", "shade"}, {"render", "shade"}}));
+    }
+
+    SECTION("Same synonym on both sides")
+    {
+        Reference leftRef(SynonymRefType, "p", DesignEntity(ProcedureType));
+        Reference rightRef(SynonymRefType, "p", DesignEntity(ProcedureType));
+        evaluateCallsClause(leftRef, rightRef, true, &resTable);
+        REQUIRE_FALSE(resTable.hasResults());
+    }
+
+    SECTION("Left known, right variable (star)")
+    {
+        Reference leftRef(LiteralRefType, "main");
+        Reference rightRef(SynonymRefType, "q", DesignEntity(ProcedureType));
+        evaluateCallsClause(leftRef, rightRef, true, &resTable);
+        requireVectorsHaveSameElements(resTable.getResultsOne("q"), std::vector<std::string>({"render", "shade"}));
+    }
+
+    SECTION("Left variable, right known")
+    {
+        Reference leftRef(SynonymRefType, "p", DesignEntity(ProcedureType));
+        Reference rightRef(LiteralRefType, "shade");
+        evaluateCallsClause(leftRef, rightRef, false, &resTable);
+        requireVectorsHaveSameElements(resTable.getResultsOne("p"), std::vector<std::string>({"render"}));
+    }
+
+    SECTION("Both known")
+    {
+        Reference leftRef(LiteralRefType, "main");
+        Reference rightRef(LiteralRefType, "shade");
+        evaluateCallsClause(leftRef, rightRef, false, &resTable);
+        REQUIRE_FALSE(resTable.hasResults());
+    }
+
+    SECTION("Both known (star)")
+    {
+        Reference leftRef(LiteralRefType, "main");
+        Reference rightRef(LiteralRefType, "shade");
+        evaluateCallsClause(leftRef, rightRef, true, &resTable);
+        REQUIRE(resTable.hasResults());
+    }
+}
+
 TEST_CASE("Next* clauses are evaluated correctly")
 {
     /*
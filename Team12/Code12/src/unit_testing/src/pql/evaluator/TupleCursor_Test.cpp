@@ -0,0 +1,67 @@
+/**
+ * Unit tests for the TupleCursor in Query Evaluator,
+ * which enumerates the rows of query results lazily.
+ */
+#include "EvaluatorTestingUtils.h"
+#include "catch.hpp"
+#include "pql/evaluator/TupleCursor.h"
+
+NtupledResult readAllRows(TupleCursor& cursor)
+{
+    NtupledResult rows;
+    Vector<String> row;
+    while (cursor.next(row)) {
+        rows.push_back(row);
+    }
+    return rows;
+}
+
+TEST_CASE("TupleCursor enumerates combinations of groups with the last group changing fastest")
+{
+    TupleCursor cursor({{{"1", "a"}, {"2", "b"}}, {{"x"}, {"y"}, {"z"}}}, {{0, 0}, {1, 0}, {0, 1}});
+    REQUIRE(cursor.countRows() == 6);
+    REQUIRE(readAllRows(cursor)
+            == NtupledResult{{"1", "x", "a"},
+                             {"1", "y", "a"},
+                             {"1", "z", "a"},
+                             {"2", "x", "b"},
+                             {"2", "y", "b"},
+                             {"2", "z", "b"}});
+    // an exhausted cursor stays exhausted
+    Vector<String> row;
+    REQUIRE_FALSE(cursor.next(row));
+}
+
+TEST_CASE("TupleCursor has no rows if any group has no rows")
+{
+    TupleCursor cursor({{{"1"}, {"2"}}, {}}, {{0, 0}, {1, 0}});
+    Vector<String> row;
+    REQUIRE(cursor.countRows() == 0);
+    REQUIRE_FALSE(cursor.next(row));
+
+    TupleCursor emptyCursor;
+    REQUIRE(emptyCursor.countRows() == 0);
+    REQUIRE_FALSE(emptyCursor.next(row));
+}
+
+TEST_CASE("TupleCursor can read the same column more than once")
+{
+    TupleCursor cursor({{{"4"}, {"5"}}}, {{0, 0}, {0, 0}});
+    REQUIRE(readAllRows(cursor) == NtupledResult{{"4", "4"}, {"5", "5"}});
+}
+
+TEST_CASE("TupleCursor only creates the rows that are read")
+{
+    NtupledResult manyRows;
+    for (int i = 0; i < 1000; i++) {
+        manyRows.push_back({std::to_string(i)});
+    }
+    // 10^9 rows in total, which are never all stored
+    TupleCursor cursor({manyRows, manyRows, manyRows}, {{0, 0}, {1, 0}, {2, 0}});
+    REQUIRE(cursor.countRows() == 1000000000);
+    Vector<String> row;
+    REQUIRE(cursor.next(row));
+    REQUIRE(row == Vector<String>{"0", "0", "0"});
+    REQUIRE(cursor.next(row));
+    REQUIRE(row == Vector<String>{"0", "0", "1"});
+}
@@ -1176,14 +1176,13 @@ TEST_CASE("Select BOOLEAN semantically incorrect query")
     REQUIRE(abstractQuery.toReturnFalseResult());
 }
 
-//
-// TEST_CASE("Select BOOLEAN semantically then syntactically incorrect query")
-//{
-//    AbstractQuery abstractQuery = processQuery("read re; Select BOOLEAN such that Parent (re, _) with 5");
-//
-//    REQUIRE(abstractQuery.isInvalid());
-//    REQUIRE(!abstractQuery.toReturnFalseResult());
-//}
+TEST_CASE("Select BOOLEAN semantically then syntactically incorrect query")
+{
+    AbstractQuery abstractQuery = processQuery("read re; Select BOOLEAN such that Parent (re, _) with 5");
+
+    REQUIRE(abstractQuery.isInvalid());
+    REQUIRE(!abstractQuery.toReturnFalseResult());
+}
 
 TEST_CASE("No declarations Select BOOLEAN")
 {
@@ -1845,3 +1844,133 @@ TEST_CASE("Complex Queries 4")
 
     REQUIRE(equals);
 }
+
+/************************************************************************************/
+/*  Tokenization                                                                    */
+/************************************************************************************/
+
+TEST_CASE("Select tuple without whitespace after Select")
+{
+    AbstractQuery abstractQuery = processQuery("stmt s1, s2;Select<s1,s2>such that Follows(s1,s2)");
+
+    AbstractQuery expectedAbstractQuery
+        = AbstractQueryBuilder::create()
+              .addSelectSynonym("s1")
+              .addSelectSynonym("s2")
+              .addDeclaration("s1", "stmt")
+              .addDeclaration("s2", "stmt")
+              .addSuchThatClause(FollowsType, SynonymRefType, "s1", StmtType, SynonymRefType, "s2", StmtType)
+              .build();
+
+    bool equals = abstractQuery == expectedAbstractQuery;
+
+    REQUIRE(equals);
+}
+
+TEST_CASE("Unclosed tuple is a syntax error")
+{
+    AbstractQuery abstractQuery = processQuery("stmt s1, s2; Select <s1, s2 such that Follows (s1, s2)");
+
+    REQUIRE(abstractQuery.isInvalid());
+    REQUIRE(abstractQuery.getErrorType() == QuerySyntaxError);
+}
+
+TEST_CASE("Trailing comma in declaration is a syntax error")
+{
+    AbstractQuery abstractQuery = processQuery("stmt s1, ; Select s1");
+
+    REQUIRE(abstractQuery.isInvalid());
+    REQUIRE(abstractQuery.getErrorType() == QuerySyntaxError);
+}
+
+TEST_CASE("Unclosed quote is a syntax error")
+{
+    AbstractQuery abstractQuery = processQuery("assign a; Select BOOLEAN pattern a (\"x, _)");
+
+    REQUIRE(abstractQuery.isInvalid());
+    REQUIRE(!abstractQuery.toReturnFalseResult());
+}
+
+TEST_CASE("Wildcard as result is a syntax error")
+{
+    AbstractQuery abstractQuery = processQuery("stmt s; Select _");
+
+    REQUIRE(abstractQuery.isInvalid());
+    REQUIRE(abstractQuery.getErrorType() == QuerySyntaxError);
+}
+
+TEST_CASE("Literal as pattern expression is a syntax error")
+{
+    AbstractQuery abstractQuery = processQuery("assign a; Select a pattern a (_\"x\"_, _)");
+
+    REQUIRE(abstractQuery.isInvalid());
+    REQUIRE(abstractQuery.getErrorType() == QuerySyntaxError);
+}
+
+TEST_CASE("Whitespace within prog_line is a syntax error")
+{
+    AbstractQuery spacedQuery = processQuery("prog _ line n; Select n");
+    REQUIRE(spacedQuery.isInvalid());
+    REQUIRE(spacedQuery.getErrorType() == QuerySyntaxError);
+
+    AbstractQuery spacedAfterUnderscoreQuery = processQuery("prog_ line n; Select n");
+    REQUIRE(spacedAfterUnderscoreQuery.isInvalid());
+    REQUIRE(spacedAfterUnderscoreQuery.getErrorType() == QuerySyntaxError);
+
+    REQUIRE_FALSE(processQuery("prog_line n; Select n").isInvalid());
+}
+
+TEST_CASE("Whitespace within stmt# is a syntax error")
+{
+    AbstractQuery selectQuery = processQuery("stmt s; Select s.stmt #");
+    REQUIRE(selectQuery.isInvalid());
+    REQUIRE(selectQuery.getErrorType() == QuerySyntaxError);
+
+    AbstractQuery withQuery = processQuery("stmt s; Select s such that Follows (s, 2) with s.stmt # = 1");
+    REQUIRE(withQuery.isInvalid());
+    REQUIRE(withQuery.getErrorType() == QuerySyntaxError);
+
+    REQUIRE_FALSE(processQuery("stmt s; Select s . stmt#").isInvalid());
+}
+
+/************************************************************************************/
+/*  Placeholders                                                                    */
+/************************************************************************************/
+
+TEST_CASE("Placeholders are numbered in order")
+{
+    AbstractQuery abstractQuery = Preprocessor::processQueryWithPlaceholders(
+        R"(stmt s; variable v; Select s such that Next* (?, s) and Uses (s, "?") with s.stmt# = ?)");
+
+    AbstractQuery expectedAbstractQuery
+        = AbstractQueryBuilder::create()
+              .addSelectSynonym("s")
+              .addDeclaration("s", "stmt")
+              .addDeclaration("v", "variable")
+              .addSuchThatClause(NextStarType, IntegerRefType, "?1", NonExistentType, SynonymRefType, "s", StmtType)
+              .addSuchThatClause(UsesType, SynonymRefType, "s", StmtType, LiteralRefType, "?2", NonExistentType)
+              .addWithClause(AttributeRefType, "s", StmtType, StmtNumberType, IntegerRefType, "?3", NonExistentType,
+                             NoAttributeType)
+              .build();
+
+    bool equals = abstractQuery == expectedAbstractQuery;
+
+    REQUIRE(equals);
+}
+
+TEST_CASE("Placeholder of the wrong type is a semantic error")
+{
+    AbstractQuery abstractQuery
+        = Preprocessor::processQueryWithPlaceholders("procedure p; Select p such that Calls (?, p)");
+
+    REQUIRE(abstractQuery.isSemanticallyInvalid());
+}
+
+TEST_CASE("Placeholders are a syntax error without processQueryWithPlaceholders")
+{
+    AbstractQuery abstractQuery = processQuery("stmt s; Select s such that Next* (?, s)");
+    AbstractQuery literalAbstractQuery = processQuery(R"(stmt s; Select s such that Uses (s, "?"))");
+
+    REQUIRE(abstractQuery.isSyntacticallyInvalid());
+    REQUIRE(literalAbstractQuery.isSyntacticallyInvalid());
+}
@@ -0,0 +1,152 @@
+/**
+ * Unit tests for the QueryLexer, which splits a PQL
+ * query into tokens for the Preprocessor.
+ */
+
+#include "catch.hpp"
+#include "pql/preprocessor/QueryLexer.h"
+
+TEST_CASE("QueryLexer reads names, integers and symbols")
+{
+    String query = "stmt s1; Select s1 such that Follows*(s1, 12)";
+    QueryLexer lexer(query);
+
+    REQUIRE(lexer.isName("stmt"));
+    lexer.advance();
+    REQUIRE(lexer.getType() == NameQueryToken);
+    REQUIRE(lexer.getText() == "s1");
+    lexer.advance();
+    REQUIRE(lexer.isSymbol(';'));
+    lexer.advance();
+    REQUIRE(lexer.isName("Select"));
+    lexer.advance();
+    REQUIRE(lexer.isName("s1"));
+    lexer.advance();
+    REQUIRE(lexer.isName("such"));
+    lexer.advance();
+    REQUIRE(lexer.isName("that"));
+    lexer.advance();
+    REQUIRE(lexer.isName("Follows"));
+    lexer.advance();
+    REQUIRE(lexer.isSymbol('*'));
+    lexer.advance();
+    REQUIRE(lexer.isSymbol('('));
+    lexer.advance();
+    REQUIRE(lexer.isName("s1"));
+    lexer.advance();
+    REQUIRE(lexer.isSymbol(','));
+    lexer.advance();
+    REQUIRE(lexer.getType() == IntegerQueryToken);
+    REQUIRE(lexer.getText() == "12");
+    lexer.advance();
+    REQUIRE(lexer.isSymbol(')'));
+    lexer.advance();
+    REQUIRE(lexer.isAtEnd());
+}
+
+TEST_CASE("QueryLexer only matches whole names")
+{
+    String query = "Selects";
+    QueryLexer lexer(query);
+
+    REQUIRE_FALSE(lexer.isName("Select"));
+    REQUIRE(lexer.isName("Selects"));
+}
+
+TEST_CASE("QueryLexer splits names from symbols without whitespace")
+{
+    String query = "Select<s,v>";
+    QueryLexer lexer(query);
+
+    REQUIRE(lexer.isName("Select"));
+    lexer.advance();
+    REQUIRE(lexer.isSymbol('<'));
+    lexer.advance();
+    REQUIRE(lexer.isName("s"));
+    lexer.advance();
+    REQUIRE(lexer.isSymbol(','));
+    lexer.advance();
+    REQUIRE(lexer.isName("v"));
+    lexer.advance();
+    REQUIRE(lexer.isSymbol('>'));
+    lexer.advance();
+    REQUIRE(lexer.isAtEnd());
+}
+
+TEST_CASE("QueryLexer splits an integer followed by a name")
+{
+    String query = "12pattern";
+    QueryLexer lexer(query);
+
+    REQUIRE(lexer.getType() == IntegerQueryToken);
+    REQUIRE(lexer.getText() == "12");
+    lexer.advance();
+    REQUIRE(lexer.isName("pattern"));
+}
+
+TEST_CASE("QueryLexer reads an empty query as the end")
+{
+    String query = " \t\n ";
+    QueryLexer lexer(query);
+
+    REQUIRE(lexer.isAtEnd());
+    REQUIRE(lexer.getType() == EndQueryToken);
+}
+
+TEST_CASE("QueryLexer reads quoted characters without whitespace")
+{
+    String query = R"(_" x + y  * 2 "_)";
+    QueryLexer lexer(query);
+    lexer.advance();
+    String contents;
+
+    REQUIRE(lexer.readQuoted(contents));
+    REQUIRE(contents == "x+y*2");
+    REQUIRE(lexer.isSymbol('_'));
+    lexer.advance();
+    REQUIRE(lexer.isAtEnd());
+}
+
+TEST_CASE("QueryLexer reads an empty quote")
+{
+    String query = R"("" x)";
+    QueryLexer lexer(query);
+    String contents = "previous";
+
+    REQUIRE(lexer.readQuoted(contents));
+    REQUIRE(contents.empty());
+    REQUIRE(lexer.isName("x"));
+}
+
+TEST_CASE("QueryLexer moves to the end of an unclosed quote")
+{
+    String query = R"("x, y)";
+    QueryLexer lexer(query);
+    String contents;
+
+    REQUIRE_FALSE(lexer.readQuoted(contents));
+    REQUIRE(lexer.isAtEnd());
+}
+
+TEST_CASE("QueryLexer checks whether a token follows the previous token directly")
+{
+    String query = "prog_line  s.stmt #";
+    QueryLexer lexer(query);
+
+    REQUIRE(lexer.isName("prog"));
+    lexer.advance();
+    REQUIRE(lexer.isSymbol('_'));
+    REQUIRE(lexer.isAdjacentToPrevious());
+    lexer.advance();
+    REQUIRE(lexer.isName("line"));
+    REQUIRE(lexer.isAdjacentToPrevious());
+    lexer.advance();
+    REQUIRE(lexer.isName("s"));
+    REQUIRE_FALSE(lexer.isAdjacentToPrevious());
+    lexer.advance();
+    lexer.advance();
+    REQUIRE(lexer.isName("stmt"));
+    lexer.advance();
+    REQUIRE(lexer.isSymbol('#'));
+    REQUIRE_FALSE(lexer.isAdjacentToPrevious());
+}
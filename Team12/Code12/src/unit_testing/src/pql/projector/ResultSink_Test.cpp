@@ -0,0 +1,87 @@
+/*
+ * Unit tests for the result sinks in ResultSink.cpp (under pql/projector),
+ * and the projection of results into them by the Projector.
+ */
+
+#include <sstream>
+
+#include "Ui.h"
+#include "catch.hpp"
+#include "pql/projector/Projector.h"
+#include "pql/projector/ResultSink.h"
+
+class ErrorCountingUi: public Ui {
+public:
+    Integer errorCount = 0;
+    Void postUiError(InputError) override
+    {
+        errorCount++;
+    }
+};
+
+TEST_CASE("Projector::projectResults(RawQueryResult&, ResultSink&, Ui&) -> moves results into list unchanged")
+{
+    // === Test set-up ===
+    RawQueryResult rawQueryResult(Vector<String>{"3", "1 x", "2"});
+    std::list<String> results;
+    ListResultSink sink(results);
+    Projector projector;
+    ErrorCountingUi ui;
+
+    // === Execute test method ===
+    projector.projectResults(rawQueryResult, sink, ui);
+
+    // === Check expected test results ===
+    REQUIRE(results == std::list<String>{"3", "1 x", "2"});
+    REQUIRE(rawQueryResult.isEmpty());
+    REQUIRE(ui.errorCount == 0);
+}
+
+TEST_CASE("Projector::projectResults(RawQueryResult&, ResultSink&, Ui&) -> posts errors, still adds FALSE")
+{
+    // === Test set-up ===
+    RawQueryResult rawQueryResult = RawQueryResult::getFalseResultWithSemanticError("Undeclared synonym");
+    std::list<String> results;
+    ListResultSink sink(results);
+    Projector projector;
+    ErrorCountingUi ui;
+
+    // === Execute test method ===
+    projector.projectResults(rawQueryResult, sink, ui);
+
+    // === Check expected test results ===
+    REQUIRE(results == std::list<String>{"FALSE"});
+    REQUIRE(ui.errorCount == 1);
+}
+
+TEST_CASE("FormattedResultSink -> joins results for the autotester in order, sorts results for the UI")
+{
+    FormattedResultSink autotesterSink(AutotesterFormat);
+    FormattedResultSink uiSink(UiFormat);
+    for (const String& result : Vector<String>{"10", "9", "x"}) {
+        autotesterSink.addResult(result);
+        uiSink.addResult(result);
+    }
+    autotesterSink.finish();
+    uiSink.finish();
+
+    REQUIRE(autotesterSink.getFormattedQueryResult() == FormattedQueryResult("10, 9, x"));
+    REQUIRE(uiSink.getFormattedQueryResult() == FormattedQueryResult("9, 10, x"));
+}
+
+TEST_CASE("FormattedResultSink -> no results gives an empty FormattedQueryResult")
+{
+    FormattedResultSink sink(AutotesterFormat);
+    sink.finish();
+    REQUIRE(sink.getFormattedQueryResult() == FormattedQueryResult::emptyFormattedQueryResult());
+}
+
+TEST_CASE("StreamResultSink -> writes one result on each line")
+{
+    std::ostringstream stream;
+    StreamResultSink sink(stream);
+    sink.addResult("1 2");
+    sink.addResult("TRUE");
+    sink.finish();
+    REQUIRE(stream.str() == "1 2\nTRUE\n");
+}